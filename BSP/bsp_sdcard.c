@@ -14,7 +14,10 @@
 #include "stm32g4xx_ll_spi.h"
 #include "stm32g4xx_hal.h"
 #include "gpio.h"
+#include "../Service/log.h"
+#include "../Service/crc.h"
 #include <stdio.h>
+#include <string.h>
 /* Private defines -----------------------------------------------------------*/
 
 // SD卡命令定义
@@ -22,10 +25,12 @@
 #define SD_CMD1 1   ///< MMC初始化
 #define SD_CMD8 8   ///< SEND_IF_COND
 #define SD_CMD9 9   ///< 读CSD数据
+#define SD_CMD10 10 ///< 读CID数据
 #define SD_CMD12 12 ///< 停止数据传输
 #define SD_CMD16 16 ///< 设置扇区大小
 #define SD_CMD17 17 ///< 读单个扇区
 #define SD_CMD18 18 ///< 读多个扇区
+#define SD_CMD23 23 ///< ACMD23：多块写预擦除块数
 #define SD_CMD24 24 ///< 写单个扇区
 #define SD_CMD25 25 ///< 写多个扇区
 #define SD_CMD41 41 ///< ACMD41
@@ -37,13 +42,70 @@
 #define SD_RESPONSE_NO_ERROR 0x00
 #define SD_IN_IDLE_STATE 0x01
 #define SD_DATA_START_TOKEN 0xFE
+#define SD_MULTI_WRITE_TOKEN 0xFC ///< CMD25数据块起始令牌
+#define SD_STOP_TRAN_TOKEN 0xFD   ///< CMD25停止传输令牌
 #define SD_DATA_ACCEPTED 0x05
 
+#define SD_DMA_TIMEOUT_MS 50 ///< 单个数据块DMA传输超时（覆盖DIV256低速时钟）
+#define SD_CMD12_NCR 16      ///< CMD12填充字节后等待R1的最大字节数
+
+// SPI时钟调优参数
+#define SD_TUNE_SECTOR 0          ///< 校验用扇区（MBR/引导扇区，任何卡都存在）
+#define SD_TUNE_READS 4           ///< 每档分频的校验读取次数
+#define SD_TUNE_MAX_HZ 25000000U  ///< SPI模式默认速度上限
+#define SD_TUNE_SLOTS 4           ///< 按CID记忆的调优结果条数
+
+#ifndef BSP_SDCARD_VERIFY_CRC
+#define BSP_SDCARD_VERIFY_CRC 1 ///< 校验读数据块的CRC16（仅对发送有效CRC的卡生效）
+#endif
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief 传输统计原始计数（DWT周期）
+ */
+typedef struct {
+    uint32_t bytes_read;    ///< 累计读取字节数
+    uint32_t bytes_written; ///< 累计写入字节数
+    uint64_t read_cycles;   ///< 读操作总周期
+    uint64_t write_cycles;  ///< 写操作总周期
+    uint64_t dma_cycles;    ///< DMA数据阶段周期
+    uint32_t dma_blocks;    ///< DMA传输块数
+    uint32_t polled_blocks; ///< 轮询传输块数
+    uint32_t crc_errors;    ///< 数据块CRC校验失败次数
+    uint32_t dma_errors;    ///< DMA传输超时/出错次数
+} bsp_sdcard_perf_t;
+
+/**
+ * @brief 按卡CID记忆的调优结果
+ */
+typedef struct {
+    uint8_t  cid[16];   ///< 卡CID寄存器
+    uint32_t prescaler; ///< 调优得到的SPI分频
+    bool     valid;     ///< 条目有效
+} bsp_sdcard_tune_slot_t;
+
 /* Private variables ---------------------------------------------------------*/
 
 static bsp_sdcard_type_t   g_sd_type         = BSP_SDCARD_TYPE_UNKNOWN;
 static bsp_sdcard_status_t g_sd_status       = BSP_SDCARD_STATUS_NO_CARD;
 static bool                g_bsp_initialized = false; // BSP层初始化标志
+static bsp_sdcard_perf_t   g_sd_perf;                 // 传输统计
+static uint16_t            g_sd_data_crc;             // 最近一个数据块的卡端CRC16
+static bool                g_sd_crc_check;            // 读数据块时校验CRC16
+
+static bsp_sdcard_tune_slot_t g_sd_tune_slots[SD_TUNE_SLOTS]; // CID调优记录
+static uint8_t                g_sd_tune_next;                 // 下一个替换槽位
+
+/**
+ * @brief 调优候选分频（由慢到快）
+ */
+static const uint32_t g_sd_prescalers[] = {
+    LL_SPI_BAUDRATEPRESCALER_DIV128, LL_SPI_BAUDRATEPRESCALER_DIV64,
+    LL_SPI_BAUDRATEPRESCALER_DIV32,  LL_SPI_BAUDRATEPRESCALER_DIV16,
+    LL_SPI_BAUDRATEPRESCALER_DIV8,   LL_SPI_BAUDRATEPRESCALER_DIV4,
+    LL_SPI_BAUDRATEPRESCALER_DIV2,
+};
 
 /* Private function prototypes -----------------------------------------------*/
 
@@ -53,8 +115,15 @@ static inline uint8_t      _bsp_sdcard_spi_rw(uint8_t data);
 // SD卡命令函数
 static uint8_t _bsp_sdcard_send_cmd(uint8_t cmd, uint32_t arg, uint8_t crc);
 static uint8_t _bsp_sdcard_wait_ready(void);
+static uint8_t _bsp_sdcard_stop_read(void);
 static uint8_t _bsp_sdcard_receive_data(uint8_t* buf, uint16_t len);
 static uint8_t _bsp_sdcard_send_data(const uint8_t* buf, uint8_t token);
+static bool    _bsp_sdcard_data_phase(const uint8_t* tx, uint8_t* rx,
+                                      uint16_t len);
+static void    _bsp_sdcard_account(bool write, uint32_t bytes, uint32_t start);
+
+// SPI时钟调优
+static void _bsp_sdcard_tune_clock(void);
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -90,19 +159,65 @@ static inline uint8_t _bsp_sdcard_spi_rw(uint8_t data)
     return LL_SPI_ReceiveData8(SPI1);
 }
 
+/**
+ * @brief 数据块传输（优先走SPI DMA，发送缓冲为NULL时发送0xFF）
+ * @note DMA被其他设备占用时退回逐字节轮询
+ */
+static bool _bsp_sdcard_data_phase(const uint8_t* tx, uint8_t* rx, uint16_t len)
+{
+    if (bsp_spi_dma_lock(BSP_SPI_DMA_DEVICE_SD_CARD)) {
+        uint32_t             start = DWT->CYCCNT;
+        bsp_spi_dma_status_t status =
+            bsp_spi_dma_transmit_receive(tx, rx, len, SD_DMA_TIMEOUT_MS);
+        uint32_t             cycles = DWT->CYCCNT - start;
+        bsp_spi_dma_unlock(BSP_SPI_DMA_DEVICE_SD_CARD);
+        if (status != BSP_SPI_DMA_OK) {
+            g_sd_perf.dma_errors++;
+            return false;
+        }
+        g_sd_perf.dma_cycles += cycles;
+        g_sd_perf.dma_blocks++;
+        return true;
+    }
+
+    for (uint16_t i = 0; i < len; i++) {
+        uint8_t data = _bsp_sdcard_spi_rw(tx ? tx[i] : 0xFF);
+        if (rx) { rx[i] = data; }
+    }
+    g_sd_perf.polled_blocks++;
+    return true;
+}
+
+/**
+ * @brief 累加一次读写操作的字节数与耗时
+ * @param start 操作开始时的DWT周期计数
+ */
+static void _bsp_sdcard_account(bool write, uint32_t bytes, uint32_t start)
+{
+    uint32_t cycles = DWT->CYCCNT - start;
+
+    if (write) {
+        g_sd_perf.bytes_written += bytes;
+        g_sd_perf.write_cycles += cycles;
+    }
+    else {
+        g_sd_perf.bytes_read += bytes;
+        g_sd_perf.read_cycles += cycles;
+    }
+}
+
 /**
  * @brief 发送SD卡命令
  */
 static uint8_t _bsp_sdcard_send_cmd(uint8_t cmd, uint32_t arg, uint8_t crc)
 {
     uint8_t  r1;
-    uint16_t retry = 0;
+    uint16_t retry = 100;
 
     bsp_sdcard_deselect();
     bsp_sdcard_select();
 
     // 等待卡准备好
-    retry = 100;
     while (_bsp_sdcard_spi_rw(0xFF) != 0xFF && retry--)
         ;
 
@@ -114,10 +229,6 @@ static uint8_t _bsp_sdcard_send_cmd(uint8_t cmd, uint32_t arg, uint8_t crc)
     _bsp_sdcard_spi_rw(arg);
     _bsp_sdcard_spi_rw(crc);
 
-    if (cmd == SD_CMD12) {
-        _bsp_sdcard_spi_rw(0xFF); // CMD12需要额外的字节
-    }
-
     // 等待响应
     retry = 10000;
     do {
@@ -130,19 +241,47 @@ static uint8_t _bsp_sdcard_send_cmd(uint8_t cmd, uint32_t arg, uint8_t crc)
     return r1;
 }
 
-// /**
-//  * @brief 等待SD卡准备就绪
-//  */
-// static uint8_t _bsp_sdcard_wait_ready(void)
-// {
-//     uint32_t timeout = HAL_GetTick() + 500;
+/**
+ * @brief 等待SD卡准备就绪（多块传输结束后的busy等待）
+ */
+static uint8_t _bsp_sdcard_wait_ready(void)
+{
+    uint32_t timeout = HAL_GetTick() + 500;
+
+    do {
+        if (_bsp_sdcard_spi_rw(0xFF) == 0xFF) { return BSP_SDCARD_OK; }
+    } while (HAL_GetTick() < timeout);
+
+    return BSP_SDCARD_TIMEOUT;
+}
+
+/**
+ * @brief 停止多块读（CMD12）
+ * @note CMD12在数据流中发送，不切换CS也不等待空闲；发送后卡可能仍在输出数据，
+ *       先丢弃一个填充字节再轮询R1，R1带错误位时返回失败，最后等待busy结束
+ */
+static uint8_t _bsp_sdcard_stop_read(void)
+{
+    uint8_t r1;
+    uint8_t retry = SD_CMD12_NCR;
+
+    _bsp_sdcard_spi_rw(SD_CMD12 | 0x40);
+    _bsp_sdcard_spi_rw(0);
+    _bsp_sdcard_spi_rw(0);
+    _bsp_sdcard_spi_rw(0);
+    _bsp_sdcard_spi_rw(0);
+    _bsp_sdcard_spi_rw(0xFF);
+    _bsp_sdcard_spi_rw(0xFF); // 填充字节
+
+    do {
+        r1 = _bsp_sdcard_spi_rw(0xFF);
+    } while ((r1 & 0x80) && --retry);
 
-//     do {
-//         if (_bsp_sdcard_spi_rw(0xFF) == 0xFF) { return BSP_SDCARD_OK; }
-//     } while (HAL_GetTick() < timeout);
+    if (r1 & 0x80) { return BSP_SDCARD_TIMEOUT; }
+    if (_bsp_sdcard_wait_ready() != BSP_SDCARD_OK) { return BSP_SDCARD_TIMEOUT; }
 
-//     return BSP_SDCARD_TIMEOUT;
-// }
+    return (r1 == SD_RESPONSE_NO_ERROR) ? BSP_SDCARD_OK : BSP_SDCARD_ERROR;
+}
 
 /**
  * @brief 接收SD卡数据块
@@ -158,14 +297,17 @@ static uint8_t _bsp_sdcard_receive_data(uint8_t* buf, uint16_t len)
         if (HAL_GetTick() >= timeout) { return BSP_SDCARD_TIMEOUT; }
     } while (token != SD_DATA_START_TOKEN);
 
-    // 读取数据
-    for (uint16_t i = 0; i < len; i++) {
-        buf[i] = _bsp_sdcard_spi_rw(0xFF);
-    }
+    // 读取数据（DMA，发送端为0xFF）
+    if (!_bsp_sdcard_data_phase(NULL, buf, len)) { return BSP_SDCARD_ERROR; }
 
-    // 读取CRC（忽略）
-    _bsp_sdcard_spi_rw(0xFF);
-    _bsp_sdcard_spi_rw(0xFF);
+    // 读取CRC（卡端CRC可信时用CRC外设校验）
+    g_sd_data_crc = (uint16_t)_bsp_sdcard_spi_rw(0xFF) << 8;
+    g_sd_data_crc |= _bsp_sdcard_spi_rw(0xFF);
+
+    if (g_sd_crc_check && crc_crc16_ccitt(0, buf, len) != g_sd_data_crc) {
+        g_sd_perf.crc_errors++;
+        return BSP_SDCARD_ERROR;
+    }
 
     return BSP_SDCARD_OK;
 }
@@ -193,11 +335,9 @@ static uint8_t _bsp_sdcard_send_data(const uint8_t* buf, uint8_t token)
     // 发送数据起始令牌
     _bsp_sdcard_spi_rw(token);
 
-    if (token != 0xFD) { // 如果不是停止传输令牌
-        // 发送512字节数据
-        for (t = 0; t < 512; t++) {
-            _bsp_sdcard_spi_rw(buf[t]);
-        }
+    if (token != SD_STOP_TRAN_TOKEN) { // 如果不是停止传输令牌
+        // 发送512字节数据（DMA，接收端丢弃）
+        if (!_bsp_sdcard_data_phase(buf, NULL, 512)) { return 2; }
 
         // 发送CRC（忽略）
         _bsp_sdcard_spi_rw(0xFF);
@@ -225,6 +365,134 @@ static uint8_t _bsp_sdcard_send_data(const uint8_t* buf, uint8_t token)
     return 0; // 写入成功
 }
 
+/**
+ * @brief 分频寄存器值转换为SPI时钟频率
+ */
+static uint32_t _bsp_sdcard_prescaler_hz(uint32_t prescaler)
+{
+    return HAL_RCC_GetPCLK2Freq() / (2U << (prescaler >> SPI_CR1_BR_Pos));
+}
+
+/**
+ * @brief 以当前分频连续读取校验扇区
+ * @param ref_crc 低速读取得到的参考CRC16
+ * @param block 读缓冲区（512字节）
+ * @return uint32_t 吞吐（字节/秒），失败返回0
+ * @note 卡端CRC可信时读取过程已校验卡发送的CRC16
+ */
+static uint32_t _bsp_sdcard_tune_probe(uint16_t ref_crc, uint8_t* block)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles;
+
+    for (uint8_t n = 0; n < SD_TUNE_READS; n++) {
+        block[0] = (uint8_t)~block[0]; // 避免读失败时残留旧数据通过校验
+        if (bsp_sdcard_read_sector(SD_TUNE_SECTOR, block) != BSP_SDCARD_OK) {
+            return 0;
+        }
+        if (crc_crc16_ccitt(0, block, BSP_SDCARD_BLOCK_SIZE) != ref_crc) {
+            return 0;
+        }
+    }
+
+    cycles = DWT->CYCCNT - start;
+    if (cycles == 0) { return 0; }
+
+    return (uint32_t)((uint64_t)BSP_SDCARD_BLOCK_SIZE * SD_TUNE_READS *
+                      SystemCoreClock / cycles);
+}
+
+/**
+ * @brief 初始化后的SPI时钟调优
+ * @note 逐档降低分频，用CRC校验的扇区读取验证，选出最快的可靠档位；
+ *       结果按卡CID记录，同一张卡重新初始化时直接沿用
+ */
+static void _bsp_sdcard_tune_clock(void)
+{
+    static uint8_t block[BSP_SDCARD_BLOCK_SIZE]; // 静态缓冲区，避免占用栈
+    uint8_t        cid[16];
+    uint16_t       ref_crc;
+    uint32_t       best = LL_SPI_BAUDRATEPRESCALER_DIV256;
+    uint32_t       bps;
+    uint8_t        i;
+
+    // 读取CID（低速）
+    if (_bsp_sdcard_send_cmd(SD_CMD10, 0, 0xFF) != 0 ||
+        _bsp_sdcard_receive_data(cid, sizeof(cid)) != BSP_SDCARD_OK) {
+        bsp_sdcard_deselect();
+        LOG_WARN("SD tune: CID read failed, keep %lu kHz",
+                 (unsigned long)(_bsp_sdcard_prescaler_hz(best) / 1000));
+        return;
+    }
+    bsp_sdcard_deselect();
+
+    // 参考数据：低速读取校验扇区
+    if (bsp_sdcard_read_sector(SD_TUNE_SECTOR, block) != BSP_SDCARD_OK) {
+        LOG_WARN("SD tune: reference read failed, keep %lu kHz",
+                 (unsigned long)(_bsp_sdcard_prescaler_hz(best) / 1000));
+        return;
+    }
+    ref_crc = crc_crc16_ccitt(0, block, BSP_SDCARD_BLOCK_SIZE);
+
+    // CRC关闭时部分卡不发送有效CRC，此类卡不做数据块校验
+    g_sd_crc_check = BSP_SDCARD_VERIFY_CRC && (g_sd_data_crc == ref_crc);
+
+    // 已调优过的卡：验证一次后直接沿用
+    for (i = 0; i < SD_TUNE_SLOTS; i++) {
+        if (g_sd_tune_slots[i].valid &&
+            memcmp(g_sd_tune_slots[i].cid, cid, sizeof(cid)) == 0) {
+            bsp_spi_set_baudrate_prescaler(g_sd_tune_slots[i].prescaler);
+            bps = _bsp_sdcard_tune_probe(ref_crc, block);
+            if (bps) {
+                LOG_INFO("SD tune: known card, %lu kHz, %lu B/s",
+                         (unsigned long)(_bsp_sdcard_prescaler_hz(
+                                             g_sd_tune_slots[i].prescaler) /
+                                         1000),
+                         (unsigned long)bps);
+                bsp_sdcard_reset_stats();
+                return;
+            }
+            g_sd_tune_slots[i].valid = false; // 记录失效，重新调优
+            bsp_spi_set_baudrate_prescaler(best);
+            break;
+        }
+    }
+
+    // 逐档提速，遇到第一个失败档位即停止
+    for (i = 0; i < sizeof(g_sd_prescalers) / sizeof(g_sd_prescalers[0]); i++) {
+        uint32_t hz = _bsp_sdcard_prescaler_hz(g_sd_prescalers[i]);
+
+        if (hz > SD_TUNE_MAX_HZ) { break; }
+
+        bsp_spi_set_baudrate_prescaler(g_sd_prescalers[i]);
+        bps = _bsp_sdcard_tune_probe(ref_crc, block);
+        if (bps == 0) {
+            LOG_WARN("SD tune: %lu kHz failed", (unsigned long)(hz / 1000));
+            break;
+        }
+
+        LOG_INFO("SD tune: %lu kHz, %lu B/s", (unsigned long)(hz / 1000),
+                 (unsigned long)bps);
+        best = g_sd_prescalers[i];
+    }
+
+    bsp_spi_set_baudrate_prescaler(best);
+    bsp_sdcard_deselect();
+    _bsp_sdcard_spi_rw(0xFF); // 失败档位后补充时钟，让卡释放总线
+
+    // 记录到CID表（轮换替换）
+    memcpy(g_sd_tune_slots[g_sd_tune_next].cid, cid, sizeof(cid));
+    g_sd_tune_slots[g_sd_tune_next].prescaler = best;
+    g_sd_tune_slots[g_sd_tune_next].valid     = true;
+    g_sd_tune_next = (uint8_t)((g_sd_tune_next + 1) % SD_TUNE_SLOTS);
+
+    LOG_INFO("SD tune: selected %lu kHz",
+             (unsigned long)(_bsp_sdcard_prescaler_hz(best) / 1000));
+
+    // 调优读取不计入传输统计
+    bsp_sdcard_reset_stats();
+}
+
 /* Public functions ----------------------------------------------------------*/
 
 /**
@@ -245,6 +513,14 @@ bsp_sdcard_result_t bsp_sdcard_init(void)
     g_sd_type = BSP_SDCARD_TYPE_UNKNOWN;
     g_sd_status = BSP_SDCARD_STATUS_NO_CARD;
     g_bsp_initialized = false;
+    g_sd_crc_check    = false; // 时钟调优确认卡端CRC有效后开启
+
+    // 使能CRC外设（数据块CRC16校验）
+    crc_init();
+
+    // 使能DWT周期计数器（传输统计计时）
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 
     // 配置SPI参数（确保不被HAL配置覆盖）
     bsp_spi_set_data_width(LL_SPI_DATAWIDTH_8BIT);  // SD卡使用8位数据宽度
@@ -355,8 +631,8 @@ bsp_sdcard_result_t bsp_sdcard_init(void)
     g_sd_status       = BSP_SDCARD_STATUS_CARD_READY;
     g_bsp_initialized = true; // 标记已初始化
 
-    // 初始化成功后，可以提高SPI速度以提升性能（可选）
-    // bsp_spi_set_baudrate_prescaler(LL_SPI_BAUDRATEPRESCALER_DIV4);  // 或 DIV8, DIV16 等
+    // 初始化成功后，逐档提高SPI速度并选取最快的可靠分频
+    _bsp_sdcard_tune_clock();
 
     return BSP_SDCARD_OK;
 }
@@ -447,7 +723,8 @@ bool bsp_sdcard_check_alive(void)
  */
 bsp_sdcard_result_t bsp_sdcard_read_sector(uint32_t sector, uint8_t* buf)
 {
-    uint8_t r1;
+    uint8_t  r1;
+    uint32_t start = DWT->CYCCNT;
 
     if (buf == NULL) { return BSP_SDCARD_ERROR; }
 
@@ -461,8 +738,10 @@ bsp_sdcard_result_t bsp_sdcard_read_sector(uint32_t sector, uint8_t* buf)
     // 接收数据
     r1 = _bsp_sdcard_receive_data(buf, 512);
     bsp_sdcard_deselect();
+    if (r1 != BSP_SDCARD_OK) { return BSP_SDCARD_ERROR; }
 
-    return (r1 == BSP_SDCARD_OK) ? BSP_SDCARD_OK : BSP_SDCARD_ERROR;
+    _bsp_sdcard_account(false, 512, start);
+    return BSP_SDCARD_OK;
 }
 
 /**
@@ -470,7 +749,8 @@ bsp_sdcard_result_t bsp_sdcard_read_sector(uint32_t sector, uint8_t* buf)
  */
 bsp_sdcard_result_t bsp_sdcard_write_sector(uint32_t sector, const uint8_t* buf)
 {
-    uint8_t r1;
+    uint8_t  r1;
+    uint32_t start = DWT->CYCCNT;
 
     if (buf == NULL) { return BSP_SDCARD_ERROR; }
 
@@ -482,45 +762,96 @@ bsp_sdcard_result_t bsp_sdcard_write_sector(uint32_t sector, const uint8_t* buf)
     if (r1 == 0) { r1 = _bsp_sdcard_send_data(buf, 0xFE); }
 
     bsp_sdcard_deselect();
-    return (r1 == 0) ? BSP_SDCARD_OK : BSP_SDCARD_ERROR;
+    if (r1 != 0) { return BSP_SDCARD_ERROR; }
+
+    _bsp_sdcard_account(true, 512, start);
+    return BSP_SDCARD_OK;
 }
 
 /**
- * @brief 读取多个扇区
+ * @brief 读取多个扇区（CMD18连续读 + CMD12停止）
  */
 bsp_sdcard_result_t bsp_sdcard_read_multi_sector(uint32_t sector, uint8_t* buf,
                                                  uint32_t count)
 {
+    uint8_t  r1;
+    uint32_t start = DWT->CYCCNT;
+    uint32_t total = count;
+
     if (buf == NULL || count == 0) { return BSP_SDCARD_ERROR; }
+    if (count == 1) { return bsp_sdcard_read_sector(sector, buf); }
 
-    // 简化实现：逐个读取
-    for (uint32_t i = 0; i < count; i++) {
-        if (bsp_sdcard_read_sector(sector + i, buf + i * 512) !=
-            BSP_SDCARD_OK) {
-            return BSP_SDCARD_ERROR;
-        }
+    // 非SDHC卡需要转换地址
+    if (g_sd_type != BSP_SDCARD_TYPE_V2HC) { sector *= 512; }
+
+    // 发送连续读命令，之后每个扇区只需等待数据令牌
+    r1 = _bsp_sdcard_send_cmd(SD_CMD18, sector, 0xFF);
+    if (r1 != 0) {
+        bsp_sdcard_deselect();
+        return BSP_SDCARD_ERROR;
     }
 
+    while (count) {
+        if (_bsp_sdcard_receive_data(buf, 512) != BSP_SDCARD_OK) { break; }
+        buf += 512;
+        count--;
+    }
+
+    // 停止传输：CMD12的R1出错时已读数据也不可信
+    r1 = _bsp_sdcard_stop_read();
+    bsp_sdcard_deselect();
+    if (count != 0 || r1 != BSP_SDCARD_OK) { return BSP_SDCARD_ERROR; }
+
+    _bsp_sdcard_account(false, total * 512, start);
     return BSP_SDCARD_OK;
 }
 
 /**
- * @brief 写入多个扇区
+ * @brief 写入多个扇区（ACMD23预擦除 + CMD25连续写 + 停止令牌）
  */
 bsp_sdcard_result_t bsp_sdcard_write_multi_sector(uint32_t       sector,
                                                   const uint8_t* buf,
                                                   uint32_t       count)
 {
+    uint8_t  r1;
+    uint32_t start = DWT->CYCCNT;
+    uint32_t total = count;
+
     if (buf == NULL || count == 0) { return BSP_SDCARD_ERROR; }
+    if (count == 1) { return bsp_sdcard_write_sector(sector, buf); }
+
+    // 非SDHC卡需要转换地址
+    if (g_sd_type != BSP_SDCARD_TYPE_V2HC) { sector *= 512; }
 
-    // 逐个写入扇区
-    for (uint32_t i = 0; i < count; i++) {
-        if (bsp_sdcard_write_sector(sector + i, buf + i * 512) !=
-            BSP_SDCARD_OK) {
+    // SD卡支持ACMD23，告知块数以便卡预先擦除（MMC不支持）
+    if (g_sd_type != BSP_SDCARD_TYPE_MMC) {
+        if (_bsp_sdcard_send_cmd(SD_CMD55, 0, 0xFF) != 0 ||
+            _bsp_sdcard_send_cmd(SD_CMD23, count, 0xFF) != 0) {
+            bsp_sdcard_deselect();
             return BSP_SDCARD_ERROR;
         }
     }
 
+    r1 = _bsp_sdcard_send_cmd(SD_CMD25, sector, 0x01);
+    if (r1 != 0) {
+        bsp_sdcard_deselect();
+        return BSP_SDCARD_ERROR;
+    }
+
+    while (count) {
+        if (_bsp_sdcard_send_data(buf, SD_MULTI_WRITE_TOKEN) != 0) { break; }
+        buf += 512;
+        count--;
+    }
+
+    // 发送停止令牌，等待卡完成最后的编程
+    r1 = _bsp_sdcard_send_data(NULL, SD_STOP_TRAN_TOKEN);
+    _bsp_sdcard_spi_rw(0xFF); // 停止令牌后的填充字节
+    if (r1 == 0 && _bsp_sdcard_wait_ready() != BSP_SDCARD_OK) { r1 = 1; }
+    bsp_sdcard_deselect();
+    if (count != 0 || r1 != 0) { return BSP_SDCARD_ERROR; }
+
+    _bsp_sdcard_account(true, total * 512, start);
     return BSP_SDCARD_OK;
 }
 
@@ -540,6 +871,51 @@ bsp_sdcard_type_t bsp_sdcard_get_type(void)
     return g_sd_type;
 }
 
+/**
+ * @brief 获取数据传输统计
+ */
+void bsp_sdcard_get_stats(bsp_sdcard_stats_t* stats)
+{
+    uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+    uint64_t busy_cycles;
+
+    if (stats == NULL) { return; }
+
+    stats->bytes_read    = g_sd_perf.bytes_read;
+    stats->bytes_written = g_sd_perf.bytes_written;
+    stats->dma_blocks    = g_sd_perf.dma_blocks;
+    stats->polled_blocks = g_sd_perf.polled_blocks;
+    stats->crc_errors    = g_sd_perf.crc_errors;
+    stats->dma_errors    = g_sd_perf.dma_errors;
+
+    stats->read_bytes_per_sec =
+        g_sd_perf.read_cycles
+            ? (uint32_t)((uint64_t)g_sd_perf.bytes_read * SystemCoreClock /
+                         g_sd_perf.read_cycles)
+            : 0;
+    stats->write_bytes_per_sec =
+        g_sd_perf.write_cycles
+            ? (uint32_t)((uint64_t)g_sd_perf.bytes_written * SystemCoreClock /
+                         g_sd_perf.write_cycles)
+            : 0;
+
+    // DMA等待期间CPU处于睡眠，其余时间计为忙碌（命令、令牌、busy轮询）
+    busy_cycles = g_sd_perf.read_cycles + g_sd_perf.write_cycles;
+    busy_cycles = (busy_cycles > g_sd_perf.dma_cycles)
+                      ? busy_cycles - g_sd_perf.dma_cycles
+                      : 0;
+    stats->cpu_busy_us = (uint32_t)(busy_cycles / cycles_per_us);
+    stats->dma_wait_us = (uint32_t)(g_sd_perf.dma_cycles / cycles_per_us);
+}
+
+/**
+ * @brief 清零数据传输统计
+ */
+void bsp_sdcard_reset_stats(void)
+{
+    memset(&g_sd_perf, 0, sizeof(g_sd_perf));
+}
+
 /**
  * @brief 获取扇区总数
  */
@@ -67,6 +67,23 @@ typedef enum {
     BSP_SDCARD_TIMEOUT = 3  ///< 超时
 } bsp_sdcard_result_t;
 
+/**
+ * @brief SD卡数据传输统计
+ * @note 耗时基于DWT周期计数器，覆盖命令、令牌与数据阶段的完整读写操作
+ */
+typedef struct {
+    uint32_t bytes_read;          ///< 累计读取字节数
+    uint32_t bytes_written;       ///< 累计写入字节数
+    uint32_t read_bytes_per_sec;  ///< 读吞吐（字节/秒）
+    uint32_t write_bytes_per_sec; ///< 写吞吐（字节/秒）
+    uint32_t cpu_busy_us;         ///< 读写期间CPU忙碌时间（微秒，不含DMA等待）
+    uint32_t dma_wait_us;         ///< DMA数据阶段耗时（微秒，CPU睡眠）
+    uint32_t dma_blocks;          ///< 经DMA传输的数据块数
+    uint32_t polled_blocks;       ///< DMA被占用时轮询传输的数据块数
+    uint32_t crc_errors;          ///< 读数据块CRC16校验失败次数
+    uint32_t dma_errors;          ///< DMA传输超时/出错的数据块数（不计入dma_blocks）
+} bsp_sdcard_stats_t;
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -157,6 +174,17 @@ bsp_sdcard_type_t   bsp_sdcard_get_type(void);
  */
 uint32_t            bsp_sdcard_get_sector_count(void);
 
+/**
+ * @brief 获取数据传输统计
+ * @param stats 统计结构体指针
+ */
+void                bsp_sdcard_get_stats(bsp_sdcard_stats_t* stats);
+
+/**
+ * @brief 清零数据传输统计
+ */
+void                bsp_sdcard_reset_stats(void);
+
 /* Exported helper functions (for BSP layer) ---------------------------------*/
 
 /**
@@ -145,8 +145,16 @@ bsp_spi_dma_status_t bsp_spi_dma_transmit_receive(
     LL_DMA_EnableChannel(DMA1, LL_DMA_CHANNEL_2);  // TX
 
     // === 9. 等待传输完成（带超时） ===
+    // 等待期间CPU进入睡眠，由DMA完成中断或SysTick唤醒
+    // 关中断后再检查标志，避免标志在检查与WFI之间置位导致多睡一个tick
     uint32_t start_tick = HAL_GetTick();
     while (!g_dma_mgr.tx_complete || !g_dma_mgr.rx_complete) {
+        __disable_irq();
+        if (!g_dma_mgr.tx_complete || !g_dma_mgr.rx_complete) {
+            __WFI();
+        }
+        __enable_irq();
+
         if ((HAL_GetTick() - start_tick) > timeout_ms) {
             // 超时处理
             LL_DMA_DisableChannel(DMA1, LL_DMA_CHANNEL_1);
@@ -0,0 +1,282 @@
+/**
+ ******************************************************************************
+ * @file    bsp_uart.c
+ * @brief   BSP层USART2（STC8 ISP串口）接收驱动实现
+ * @note    FIFO阈值中断负责连续数据，接收超时中断负责阈值以下的尾巴；
+ *          中断里循环读空FIFO（读的过程中新到的帧一并取走），
+ *          921600波特率下每4字节约一次中断，8字节FIFO可容忍约5帧（~60us）的中断延迟
+ * @version V2.0.0
+ * @date    2025-01-XX
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "bsp_uart.h"
+
+#define LOG_MODULE  LOG_MODULE_UART
+#include "../Service/log.h"
+
+/* Private defines -----------------------------------------------------------*/
+
+#if (BSP_UART_RX_RING_SIZE & (BSP_UART_RX_RING_SIZE - 1)) != 0
+#error "BSP_UART_RX_RING_SIZE must be a power of 2"
+#endif
+
+#define BSP_UART_INSTANCE       USART2
+#define BSP_UART_RING_MASK      (BSP_UART_RX_RING_SIZE - 1)
+#define BSP_UART_READY_TIMEOUT  10      ///< 等待REACK/TEACK超时（毫秒）
+
+/* 与RDR中FIFO头部字节对应的接收错误 */
+#define BSP_UART_RX_ERRORS      (USART_ISR_PE | USART_ISR_FE | USART_ISR_NE)
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief 接收环形缓冲区（单生产者：中断，单消费者：主循环）
+ */
+typedef struct {
+    uint8_t           buf[BSP_UART_RX_RING_SIZE]; ///< 数据
+    volatile uint16_t head;                       ///< 写位置（只由中断修改）
+    volatile uint16_t tail;                       ///< 读位置（只由读取方修改）
+} bsp_uart_ring_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static bsp_uart_ring_t  g_rx_ring;
+static bsp_uart_stats_t g_uart_stats;
+static bool             g_err_burst;    ///< 处于连续出错中（本段已告警）
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 累加接收错误计数并清除错误标志
+ * @param isr 读到的ISR
+ */
+static void bsp_uart_count_errors(uint32_t isr)
+{
+    if (isr & USART_ISR_PE) {
+        g_uart_stats.parity_error++;
+    }
+    if (isr & USART_ISR_FE) {
+        g_uart_stats.frame_error++;
+    }
+    if (isr & USART_ISR_NE) {
+        g_uart_stats.noise_error++;
+    }
+    LL_USART_WriteReg(BSP_UART_INSTANCE, ICR, USART_ICR_PECF | USART_ICR_FECF | USART_ICR_NECF);
+}
+
+/**
+ * @brief 接收错误总数（溢出、校验/帧/噪声错误、环形缓冲区满丢弃）
+ */
+static uint32_t bsp_uart_error_total(void)
+{
+    return g_uart_stats.overrun + g_uart_stats.frame_error + g_uart_stats.noise_error +
+           g_uart_stats.parity_error + g_uart_stats.ring_dropped;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+ * @brief 按指定波特率重新配置USART2并开启接收中断
+ */
+bsp_status_t bsp_uart_init(uint32_t baudrate)
+{
+    USART_TypeDef* uart = BSP_UART_INSTANCE;
+    uint32_t       start;
+
+    NVIC_DisableIRQ(USART2_IRQn);
+
+    // BRR、FIFOEN、RTOEN只能在UE=0时修改；关闭UE同时清空FIFO和状态标志
+    LL_USART_Disable(uart);
+    LL_USART_SetBaudRate(uart, HAL_RCC_GetPCLK1Freq(), LL_USART_PRESCALER_DIV1,
+                         LL_USART_OVERSAMPLING_16, baudrate);
+#if BSP_UART_USE_FIFO
+    LL_USART_EnableFIFO(uart);
+    LL_USART_SetRXFIFOThreshold(uart, BSP_UART_RX_FIFO_THRESHOLD);
+    LL_USART_SetRxTimeout(uart, BSP_UART_RX_TIMEOUT_BITS);
+    LL_USART_EnableRxTimeout(uart);
+#else
+    LL_USART_DisableFIFO(uart);
+    LL_USART_DisableRxTimeout(uart);
+#endif
+    LL_USART_Enable(uart);
+
+    start = HAL_GetTick();
+    while (!LL_USART_IsActiveFlag_TEACK(uart) || !LL_USART_IsActiveFlag_REACK(uart)) {
+        if ((HAL_GetTick() - start) > BSP_UART_READY_TIMEOUT) {
+            return BSP_TIMEOUT;
+        }
+    }
+
+    // 中断关闭期间复位环形缓冲区
+    g_rx_ring.head = 0;
+    g_rx_ring.tail = 0;
+
+#if BSP_UART_USE_FIFO
+    LL_USART_DisableIT_RXNE_RXFNE(uart);
+    LL_USART_EnableIT_RXFT(uart);
+    LL_USART_EnableIT_RTO(uart);
+#else
+    LL_USART_EnableIT_RXNE_RXFNE(uart);
+#endif
+    LL_USART_EnableIT_PE(uart);
+    LL_USART_EnableIT_ERROR(uart);  // FE/NE/ORE
+    NVIC_EnableIRQ(USART2_IRQn);
+
+    return BSP_OK;
+}
+
+/**
+ * @brief 从环形缓冲区读取数据
+ */
+uint16_t bsp_uart_read(uint8_t* buf, uint16_t len)
+{
+    uint16_t head = g_rx_ring.head;
+    uint16_t tail = g_rx_ring.tail;
+    uint16_t n    = 0;
+
+    __DMB();  // 先取head，再读它之前写入的数据
+
+    while (n < len && tail != head) {
+        buf[n++] = g_rx_ring.buf[tail];
+        tail     = (tail + 1) & BSP_UART_RING_MASK;
+    }
+
+    __DMB();  // 数据读完才释放空间
+    g_rx_ring.tail = tail;
+
+    return n;
+}
+
+/**
+ * @brief 环形缓冲区中可读的字节数
+ */
+uint16_t bsp_uart_available(void)
+{
+    return (uint16_t)((g_rx_ring.head - g_rx_ring.tail) & BSP_UART_RING_MASK);
+}
+
+/**
+ * @brief 丢弃环形缓冲区中的数据
+ */
+void bsp_uart_flush_rx(void)
+{
+    g_rx_ring.tail = g_rx_ring.head;
+}
+
+/**
+ * @brief 发送数据
+ */
+void bsp_uart_write(const uint8_t* data, uint16_t len)
+{
+    USART_TypeDef* uart = BSP_UART_INSTANCE;
+
+    while (len--) {
+        while (!LL_USART_IsActiveFlag_TXE_TXFNF(uart)) {
+            // 等待TX FIFO有空位
+        }
+        LL_USART_TransmitData8(uart, *data++);
+    }
+
+    while (!LL_USART_IsActiveFlag_TC(uart)) {
+        // 等待最后一帧移出
+    }
+}
+
+/**
+ * @brief 读取接收统计
+ */
+void bsp_uart_get_stats(bsp_uart_stats_t* stats)
+{
+    __disable_irq();
+    *stats = g_uart_stats;
+    __enable_irq();
+}
+
+/**
+ * @brief 清零接收统计
+ */
+void bsp_uart_reset_stats(void)
+{
+    __disable_irq();
+    memset(&g_uart_stats, 0, sizeof(g_uart_stats));
+    g_err_burst = false;
+    __enable_irq();
+}
+
+/* Callback functions --------------------------------------------------------*/
+
+/**
+ * @brief USART2中断处理
+ * @note  ISR读一次判断全部标志，读空FIFO后才更新head；
+ *        错误字节直接丢弃并累加计数，每段连续出错只写一条告警日志
+ *        （log_write_module可在中断中调用，由主循环的log_process输出）
+ */
+void bsp_uart_irq_handler(void)
+{
+    USART_TypeDef* uart  = BSP_UART_INSTANCE;
+    uint32_t       isr   = LL_USART_ReadReg(uart, ISR);
+    uint16_t       head  = g_rx_ring.head;
+    uint16_t       next;
+    uint32_t       burst = 0;
+    uint32_t       errors = bsp_uart_error_total();
+    uint8_t        data;
+
+    g_uart_stats.irqs++;
+
+    // ORE：FIFO满时到达的那一帧已丢失，FIFO中的数据仍有效
+    if (isr & USART_ISR_ORE) {
+        g_uart_stats.overrun++;
+        LL_USART_WriteReg(uart, ICR, USART_ICR_ORECF);
+    }
+    if (isr & USART_ISR_RTOF) {
+        g_uart_stats.timeouts++;
+        LL_USART_WriteReg(uart, ICR, USART_ICR_RTOCF);
+    }
+
+    while (isr & USART_ISR_RXNE_RXFNE) {
+        if (isr & BSP_UART_RX_ERRORS) {
+            bsp_uart_count_errors(isr);
+            (void)LL_USART_ReceiveData8(uart);
+        } else {
+            data = LL_USART_ReceiveData8(uart);
+            next = (head + 1) & BSP_UART_RING_MASK;
+            if (next == g_rx_ring.tail) {
+                g_uart_stats.ring_dropped++;
+            } else {
+                g_rx_ring.buf[head] = data;
+                head = next;
+                burst++;
+            }
+        }
+        isr = LL_USART_ReadReg(uart, ISR);
+    }
+
+    // 没有对应字节的错误标志（不清除会反复进中断）
+    if (isr & BSP_UART_RX_ERRORS) {
+        bsp_uart_count_errors(isr);
+    }
+
+    __DMB();  // 数据写入后再发布head
+    g_rx_ring.head = head;
+
+    g_uart_stats.rx_bytes += burst;
+    if (burst > g_uart_stats.max_burst) {
+        g_uart_stats.max_burst = burst;
+    }
+
+    // 出错后首次告警，直到某次中断收到数据且无错误才结束这一段，避免噪声干扰时刷屏
+    if (bsp_uart_error_total() != errors) {
+        if (!g_err_burst) {
+            g_err_burst = true;
+            LOG_WARN("USART2 rx errors: ORE %lu FE %lu NE %lu PE %lu drop %lu",
+                     (unsigned long)g_uart_stats.overrun, (unsigned long)g_uart_stats.frame_error,
+                     (unsigned long)g_uart_stats.noise_error,
+                     (unsigned long)g_uart_stats.parity_error,
+                     (unsigned long)g_uart_stats.ring_dropped);
+        }
+    } else if (burst > 0) {
+        g_err_burst = false;
+    }
+}
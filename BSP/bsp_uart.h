@@ -0,0 +1,122 @@
+/**
+ ******************************************************************************
+ * @file    bsp_uart.h
+ * @brief   BSP层USART2（STC8 ISP串口）接收驱动接口
+ * @note    USART2工作在FIFO模式：RX FIFO达到阈值或接收超时才进中断，
+ *          中断里一次读空FIFO存入环形缓冲区；错误只累加计数，不在中断里打印
+ * @version V2.0.0
+ * @date    2025-01-XX
+ ******************************************************************************
+ */
+
+#ifndef BSP_UART_H
+#define BSP_UART_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "bsp_common.h"
+#include "stm32g4xx_ll_usart.h"
+
+/* Exported constants --------------------------------------------------------*/
+
+/* 0：关闭FIFO，逐字节RXNE中断（仅用于对比测试） */
+#ifndef BSP_UART_USE_FIFO
+#define BSP_UART_USE_FIFO           1
+#endif
+
+/* RX FIFO阈值中断（FIFO深度8）：1/2即4字节进一次中断，剩余4字节+移位寄存器留给中断延迟 */
+#ifndef BSP_UART_RX_FIFO_THRESHOLD
+#define BSP_UART_RX_FIFO_THRESHOLD  LL_USART_FIFOTHRESHOLD_1_2
+#endif
+
+/* 接收超时（位时间）：最后一帧结束后空闲这么久，把不足阈值的尾巴取走；22位约2帧 */
+#ifndef BSP_UART_RX_TIMEOUT_BITS
+#define BSP_UART_RX_TIMEOUT_BITS    22
+#endif
+
+/* 接收环形缓冲区大小（字节，须为2的幂） */
+#ifndef BSP_UART_RX_RING_SIZE
+#define BSP_UART_RX_RING_SIZE       256
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief 接收统计（中断中累加，bsp_uart_get_stats读取）
+ */
+typedef struct {
+    uint32_t rx_bytes;      ///< 存入环形缓冲区的字节数
+    uint32_t irqs;          ///< 中断次数
+    uint32_t timeouts;      ///< 接收超时中断次数（阈值以下的尾巴）
+    uint32_t max_burst;     ///< 单次中断读出的最大字节数
+    uint32_t overrun;       ///< 溢出（ORE）：FIFO满时又收到一帧，该帧丢失
+    uint32_t frame_error;   ///< 帧错误（FE），该字节丢弃
+    uint32_t noise_error;   ///< 噪声（NE），该字节丢弃
+    uint32_t parity_error;  ///< 校验错误（PE），该字节丢弃
+    uint32_t ring_dropped;  ///< 环形缓冲区满丢弃的字节数（上层读取太慢）
+} bsp_uart_stats_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief 按指定波特率重新配置USART2并开启接收中断
+ * @param baudrate 波特率（2400握手，下载阶段可提高到921600）
+ * @return bsp_status_t BSP_OK成功；BSP_TIMEOUT等待REACK/TEACK超时
+ * @note 数据位、校验沿用MX_USART2_UART_Init的配置（8数据位+偶校验）；
+ *       切换波特率时清空环形缓冲区，统计保留
+ */
+bsp_status_t bsp_uart_init(uint32_t baudrate);
+
+/**
+ * @brief 从环形缓冲区读取数据（不阻塞）
+ * @param buf 目标缓冲区
+ * @param len 最多读取的字节数
+ * @return uint16_t 实际读取的字节数
+ */
+uint16_t     bsp_uart_read(uint8_t* buf, uint16_t len);
+
+/**
+ * @brief 环形缓冲区中可读的字节数
+ */
+uint16_t     bsp_uart_available(void);
+
+/**
+ * @brief 丢弃环形缓冲区中的数据
+ */
+void         bsp_uart_flush_rx(void);
+
+/**
+ * @brief 发送数据（阻塞，直到最后一帧移出）
+ * @param data 数据
+ * @param len 长度
+ * @note 按TXFNF写TX FIFO，一次最多可连续写入8字节
+ */
+void         bsp_uart_write(const uint8_t* data, uint16_t len);
+
+/**
+ * @brief 读取接收统计
+ * @param stats 输出
+ */
+void         bsp_uart_get_stats(bsp_uart_stats_t* stats);
+
+/**
+ * @brief 清零接收统计
+ */
+void         bsp_uart_reset_stats(void);
+
+/* Exported callback functions -----------------------------------------------*/
+/* @note 以下函数由stm32g4xx_it.c中的中断处理器调用 */
+
+/**
+ * @brief USART2中断处理（在USART2_IRQHandler中调用）
+ */
+void         bsp_uart_irq_handler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BSP_UART_H
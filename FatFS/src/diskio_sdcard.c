@@ -5,11 +5,168 @@
  */
 
 #include "diskio.h"
+#include "diskio_sdcard.h"
 #include "../../BSP/bsp_sdcard.h"
+#include <string.h>
 
 /* Definitions of physical drive number for each drive */
 #define DEV_SD          0       /* SD card */
 
+#define SECTOR_SIZE     512
+
+/*--------------------------------------------------------------------------*/
+/* Sector cache                                                             */
+/*--------------------------------------------------------------------------*/
+/* Reads of single sectors (FAT, directory and partial file sectors) are
+   served from a small LRU cache; forward-sequential single-sector reads are
+   served from a separate read-ahead buffer filled by one CMD18. Writes go
+   to the card first and then update any cached copy (write-through), so
+   the cache never holds dirty data. Multi-sector reads bypass both. */
+
+#if DISKIO_CACHE_SECTORS
+typedef struct {
+    DWORD sector;   /* Cached LBA */
+    DWORD stamp;    /* Last access (larger is more recent) */
+    BYTE  valid;
+} cache_tag_t;
+
+static cache_tag_t s_cache_tag[DISKIO_CACHE_SECTORS];
+static BYTE        s_cache_data[DISKIO_CACHE_SECTORS][SECTOR_SIZE];
+static DWORD       s_cache_clock;
+#endif
+
+#if DISKIO_READAHEAD_SECTORS
+static BYTE  s_ra_data[DISKIO_READAHEAD_SECTORS][SECTOR_SIZE];
+static DWORD s_ra_base;     /* First LBA held in s_ra_data */
+static UINT  s_ra_count;    /* Valid sectors in s_ra_data (0: empty) */
+#endif
+
+static DWORD                s_last_sector = 0xFFFFFFFF; /* Last LBA read, for sequential detection */
+static diskio_cache_stats_t s_stats;
+
+#if DISKIO_CACHE_SECTORS
+/* Find a cached sector, returns slot index or -1 */
+static int cache_find(DWORD sector)
+{
+    int i;
+
+    for (i = 0; i < DISKIO_CACHE_SECTORS; i++) {
+        if (s_cache_tag[i].valid && s_cache_tag[i].sector == sector) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Store a sector in a free slot or the least recently used one */
+static void cache_insert(DWORD sector, const BYTE *data)
+{
+    int i, victim = 0;
+
+    for (i = 0; i < DISKIO_CACHE_SECTORS; i++) {
+        if (!s_cache_tag[i].valid) {
+            victim = i;
+            break;
+        }
+        if (s_cache_tag[i].stamp < s_cache_tag[victim].stamp) {
+            victim = i;
+        }
+    }
+
+    memcpy(s_cache_data[victim], data, SECTOR_SIZE);
+    s_cache_tag[victim].sector = sector;
+    s_cache_tag[victim].stamp  = ++s_cache_clock;
+    s_cache_tag[victim].valid  = 1;
+}
+#endif
+
+/* Serve a single-sector read from the cache or the read-ahead buffer */
+static int cache_read(DWORD sector, BYTE *buff)
+{
+#if DISKIO_CACHE_SECTORS
+    int i = cache_find(sector);
+
+    if (i >= 0) {
+        memcpy(buff, s_cache_data[i], SECTOR_SIZE);
+        s_cache_tag[i].stamp = ++s_cache_clock;
+        s_stats.hits++;
+        return 1;
+    }
+#endif
+#if DISKIO_READAHEAD_SECTORS
+    if (s_ra_count && sector >= s_ra_base && sector - s_ra_base < s_ra_count) {
+        memcpy(buff, s_ra_data[sector - s_ra_base], SECTOR_SIZE);
+        s_stats.readahead_hits++;
+        return 1;
+    }
+#endif
+    (void)sector;
+    (void)buff;
+    return 0;
+}
+
+/* Keep cached copies coherent with a write (ok=0: drop them instead) */
+static void cache_update(DWORD sector, const BYTE *buff, UINT count, int ok)
+{
+    UINT n;
+
+    for (n = 0; n < count; n++, sector++, buff += SECTOR_SIZE) {
+#if DISKIO_CACHE_SECTORS
+        int i = cache_find(sector);
+        if (i >= 0) {
+            if (ok) {
+                memcpy(s_cache_data[i], buff, SECTOR_SIZE);
+            } else {
+                s_cache_tag[i].valid = 0;
+            }
+        }
+#endif
+#if DISKIO_READAHEAD_SECTORS
+        if (s_ra_count && sector >= s_ra_base && sector - s_ra_base < s_ra_count) {
+            if (ok) {
+                memcpy(s_ra_data[sector - s_ra_base], buff, SECTOR_SIZE);
+            } else {
+                s_ra_count = 0;
+            }
+        }
+#endif
+    }
+    (void)ok;
+}
+
+/**
+ * @brief Drop all cached sectors
+ */
+void disk_cache_invalidate(void)
+{
+#if DISKIO_CACHE_SECTORS
+    memset(s_cache_tag, 0, sizeof(s_cache_tag));
+    s_cache_clock = 0;
+#endif
+#if DISKIO_READAHEAD_SECTORS
+    s_ra_count = 0;
+#endif
+    s_last_sector = 0xFFFFFFFF;
+}
+
+/**
+ * @brief Get sector cache statistics
+ */
+void disk_cache_get_stats(diskio_cache_stats_t* stats)
+{
+    if (stats) {
+        *stats = s_stats;
+    }
+}
+
+/**
+ * @brief Reset sector cache statistics
+ */
+void disk_cache_reset_stats(void)
+{
+    memset(&s_stats, 0, sizeof(s_stats));
+}
+
 /**
  * @brief Get Drive Status
  */
@@ -37,7 +194,9 @@ DSTATUS disk_initialize(BYTE pdrv)
     }
     
     // SD card should already be initialized before mounting
-    // This just checks status
+    // This just checks status; the card may have been swapped since the
+    // last mount, so start with an empty cache
+    disk_cache_invalidate();
     if (bsp_sdcard_is_inserted()) {
         return 0;  // Success
     }
@@ -61,18 +220,47 @@ DRESULT disk_read(
         return RES_PARERR;
     }
     
-    // Read single or multiple sectors
-    if (count == 1) {
-        result = bsp_sdcard_read_sector(sector, buff);
-    } else {
+    // Multi-sector reads (aligned file data) go straight to the card
+    if (count > 1) {
+        s_stats.bypass++;
+        s_last_sector = sector + count - 1;
         result = bsp_sdcard_read_multi_sector(sector, buff, count);
+        return (result == BSP_SDCARD_OK) ? RES_OK : RES_ERROR;
     }
-    
-    if (result == BSP_SDCARD_OK) {
+
+    if (cache_read(sector, buff)) {
+        s_last_sector = sector;
         return RES_OK;
     }
-    
-    return RES_ERROR;
+    s_stats.misses++;
+
+#if DISKIO_READAHEAD_SECTORS
+    // Forward-sequential miss: fetch the following sectors in one transfer
+    if (sector == s_last_sector + 1) {
+        s_last_sector = sector;
+        s_ra_count = 0;
+        if (bsp_sdcard_read_multi_sector(sector, s_ra_data[0],
+                                         DISKIO_READAHEAD_SECTORS) == BSP_SDCARD_OK) {
+            s_ra_base  = sector;
+            s_ra_count = DISKIO_READAHEAD_SECTORS;
+            s_stats.readahead_fills++;
+            memcpy(buff, s_ra_data[0], SECTOR_SIZE);
+            return RES_OK;
+        }
+        // Read-ahead can run past the end of the card; fall back to one sector
+    }
+#endif
+    s_last_sector = sector;
+
+    result = bsp_sdcard_read_sector(sector, buff);
+    if (result != BSP_SDCARD_OK) {
+        return RES_ERROR;
+    }
+
+#if DISKIO_CACHE_SECTORS
+    cache_insert(sector, buff);
+#endif
+    return RES_OK;
 }
 
 /**
@@ -100,7 +288,11 @@ DRESULT disk_write(
     } else {
         result = bsp_sdcard_write_multi_sector(sector, buff, count);
     }
-    
+
+    // Write-through: refresh cached copies, or drop them if the card
+    // content is now unknown
+    cache_update(sector, buff, count, result == BSP_SDCARD_OK);
+
     return (result == BSP_SDCARD_OK) ? RES_OK : RES_ERROR;
 }
 
@@ -0,0 +1,58 @@
+/**
+ * @file diskio_sdcard.h
+ * @brief SD card diskio extensions (sector cache configuration and statistics)
+ * @note The FatFs diskio interface itself is declared in diskio.h
+ */
+
+#ifndef _DISKIO_SDCARD_H
+#define _DISKIO_SDCARD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "integer.h"
+
+/* Number of 512-byte sectors kept in the LRU cache (0: disable the cache).
+/  Serves FAT chain walks and directory lookups that FatFs's single window
+/  keeps re-reading. */
+#ifndef DISKIO_CACHE_SECTORS
+#define DISKIO_CACHE_SECTORS        4
+#endif
+
+/* Number of sectors fetched by one read-ahead (0: disable read-ahead).
+/  Read-ahead kicks in when single-sector reads walk forward sequentially
+/  and is kept in its own buffer so streaming does not evict the LRU. */
+#ifndef DISKIO_READAHEAD_SECTORS
+#define DISKIO_READAHEAD_SECTORS    4
+#endif
+
+/* Cache statistics */
+typedef struct {
+    DWORD hits;             /* Single-sector reads served from the LRU cache */
+    DWORD misses;           /* Single-sector reads that went to the card */
+    DWORD readahead_hits;   /* Single-sector reads served from the read-ahead buffer */
+    DWORD readahead_fills;  /* Read-ahead multi-block transfers issued */
+    DWORD bypass;           /* Multi-sector reads passed straight to the card */
+} diskio_cache_stats_t;
+
+/**
+ * @brief Get sector cache statistics
+ */
+void disk_cache_get_stats(diskio_cache_stats_t* stats);
+
+/**
+ * @brief Reset sector cache statistics
+ */
+void disk_cache_reset_stats(void);
+
+/**
+ * @brief Drop all cached sectors (e.g. after the card was swapped)
+ */
+void disk_cache_invalidate(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
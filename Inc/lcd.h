@@ -157,6 +157,28 @@
 #define Horizontal     0x00
 #define Vertical       0x01
 
+/* Text grid used by LCD_DisplayStringLine (16x24 font) */
+#define LCD_TEXT_LINES     10
+#define LCD_TEXT_COLUMNS   20
+
+/* Background pixel streaming: TIM8 drives WR, DMA1 channel 4 feeds GPIOC->ODR */
+#ifndef LCD_USE_DMA
+#define LCD_USE_DMA        0
+#endif
+
+/* TIM8 ticks per pixel while streaming. TIM8 runs at 80 MHz (APB2 = SYSCLK):
+   10 ticks = 125 ns per pixel (8 Mpixel/s), WR low 62.5 ns and high 62.5 ns.
+   ILI932x write cycle >= 100 ns with WR low and high >= 50 ns, so 8 is the floor. */
+#ifndef LCD_DMA_PERIOD
+#define LCD_DMA_PERIOD     10
+#endif
+
+/* Count parallel bus cycles (LCD_GetBusStats). Off in firmware, where it
+   adds a counter update to every bus primitive; tools/lcd_emu turns it on. */
+#ifndef LCD_BUS_STATS
+#define LCD_BUS_STATS      0
+#endif
+
 
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
@@ -174,6 +196,16 @@ typedef const uint32_t uc32;  /*!< Read Only */
 typedef const uint16_t uc16;  /*!< Read Only */
 typedef const uint8_t uc8;   /*!< Read Only */
 
+/* Completion callback of a background transfer (interrupt context) */
+typedef void (*LCD_DMA_Callback)(void);
+
+/* Parallel bus cycle counters: one cycle is one WR or RD strobe */
+typedef struct
+{
+	u32 WriteCycles;
+	u32 ReadCycles;
+} LCD_BusStats;
+
 
 
 void LCD_Init(void);
@@ -185,10 +217,12 @@ void LCD_SetCursor(u8 Xpos, u16 Ypos);
 void LCD_DrawChar(u8 Xpos, u16 Ypos, uc16 *c);
 void LCD_DisplayChar(u8 Line, u16 Column, u8 Ascii);
 void LCD_DisplayStringLine(u8 Line, u8 *ptr);
+void LCD_TextCacheInvalidate(void);
 void LCD_SetDisplayWindow(u8 Xpos, u16 Ypos, u8 Height, u16 Width);
 void LCD_WindowModeDisable(void);
 void LCD_DrawLine(u8 Xpos, u16 Ypos, u16 Length, u8 Direction);
 void LCD_DrawRect(u8 Xpos, u16 Ypos, u8 Height, u16 Width);
+void LCD_FillRect(u8 Xpos, u16 Ypos, u8 Height, u16 Width, u16 Color);
 void LCD_DrawCircle(u8 Xpos, u16 Ypos, u16 Radius);
 void LCD_DrawMonoPict(uc32 *Pict);
 void LCD_WriteBMP(u32 BmpAddress);
@@ -200,8 +234,23 @@ void LCD_WriteReg(u8 LCD_Reg, u16 LCD_RegValue);
 u16 LCD_ReadReg(u8 LCD_Reg);
 void LCD_WriteRAM_Prepare(void);
 void LCD_WriteRAM(u16 RGB_Code);
+void LCD_WriteRAM_Burst(const u16 *Pixels, u32 Count);
+void LCD_FillRAM(u16 Color, u32 Count);
 u16 LCD_ReadRAM(void);
 void LCD_PowerOn(void);
+#if LCD_USE_DMA
+void LCD_DMA_Init(void);
+u8 LCD_DMA_WriteRAM(const u16 *Pixels, u32 Count, LCD_DMA_Callback Done);
+u8 LCD_DMA_FillRAM(u16 Color, u32 Count, LCD_DMA_Callback Done);
+u8 LCD_ClearAsync(u16 Color, LCD_DMA_Callback Done);
+u8 LCD_DMA_IsBusy(void);
+void LCD_DMA_Wait(void);
+void LCD_DMA_UpdateCallback(void);
+#endif
+#if LCD_BUS_STATS
+void LCD_GetBusStats(LCD_BusStats *Stats);
+void LCD_ResetBusStats(void);
+#endif
 void LCD_DisplayOn(void);
 void LCD_DisplayOff(void);
 
@@ -0,0 +1,173 @@
+/**
+  ******************************************************************************
+  * @file    crc.c
+  * @brief   CRC计算服务实现文件
+  *          CRC32（镜像完整性）与CRC16-CCITT（SD数据块）
+  * @note    STM32G4上使用CRC外设，主机构建使用查表实现
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "crc.h"
+#include <string.h>
+
+#if CRC_USE_HW
+#include "main.h"
+#endif
+
+/* Private defines -----------------------------------------------------------*/
+
+#define CRC32_POLY          0x04C11DB7U     /* IEEE 802.3 */
+#define CRC32_POLY_REFLECT  0xEDB88320U     /* 反射形式（查表实现） */
+#define CRC16_POLY          0x1021U         /* CCITT */
+
+#if CRC_USE_HW
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 向CRC外设写入数据
+ * @note  整字按大端拼装写入，外设按字节输入反转配置处理，剩余字节逐字节写入
+ */
+static void crc_hw_feed(const uint8_t *data, uint32_t len)
+{
+    uint32_t word;
+
+    while (len >= 4) {
+        memcpy(&word, data, 4);
+        CRC->DR = __REV(word);
+        data += 4;
+        len -= 4;
+    }
+    while (len--) {
+        *(__IO uint8_t *)&CRC->DR = *data++;
+    }
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief 初始化CRC服务
+ */
+void crc_init(void)
+{
+    __HAL_RCC_CRC_CLK_ENABLE();
+}
+
+/**
+ * @brief 计算CRC32
+ * @note  外设内部状态为未反射形式：以__RBIT(~crc)作为初值续算，
+ *        输出反转后即为反射形式的状态
+ */
+uint32_t crc_crc32(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    CRC->POL  = CRC32_POLY;
+    CRC->INIT = __RBIT(~crc);
+    CRC->CR   = CRC_CR_REV_OUT | CRC_CR_REV_IN_0 | CRC_CR_RESET; /* 32位，输入按字节反转 */
+
+    crc_hw_feed(data, len);
+
+    return ~CRC->DR;
+}
+
+/**
+ * @brief 计算CRC16-CCITT
+ */
+uint16_t crc_crc16_ccitt(uint16_t crc, const uint8_t *data, uint32_t len)
+{
+    CRC->POL  = CRC16_POLY;
+    CRC->INIT = crc;
+    CRC->CR   = CRC_CR_POLYSIZE_0 | CRC_CR_RESET; /* 16位，不反转 */
+
+    crc_hw_feed(data, len);
+
+    return (uint16_t)CRC->DR;
+}
+
+#else /* !CRC_USE_HW */
+
+/* Private variables ---------------------------------------------------------*/
+
+/**
+ * @brief 查表实现的CRC表（首次使用时生成）
+ */
+static uint32_t s_crc32_table[256];
+static uint16_t s_crc16_table[256];
+static uint8_t  s_tables_ready = 0;
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 生成CRC表
+ */
+static void crc_build_tables(void)
+{
+    uint32_t i, c;
+    uint16_t h;
+    int k;
+
+    for (i = 0; i < 256; i++) {
+        c = i;
+        for (k = 0; k < 8; k++) {
+            c = (c & 1) ? (c >> 1) ^ CRC32_POLY_REFLECT : (c >> 1);
+        }
+        s_crc32_table[i] = c;
+
+        h = (uint16_t)(i << 8);
+        for (k = 0; k < 8; k++) {
+            h = (h & 0x8000) ? (uint16_t)((h << 1) ^ CRC16_POLY) : (uint16_t)(h << 1);
+        }
+        s_crc16_table[i] = h;
+    }
+
+    s_tables_ready = 1;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief 初始化CRC服务
+ */
+void crc_init(void)
+{
+    if (!s_tables_ready) {
+        crc_build_tables();
+    }
+}
+
+/**
+ * @brief 计算CRC32
+ */
+uint32_t crc_crc32(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    if (!s_tables_ready) {
+        crc_build_tables();
+    }
+
+    crc = ~crc;
+    while (len--) {
+        crc = s_crc32_table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+/**
+ * @brief 计算CRC16-CCITT
+ */
+uint16_t crc_crc16_ccitt(uint16_t crc, const uint8_t *data, uint32_t len)
+{
+    if (!s_tables_ready) {
+        crc_build_tables();
+    }
+
+    while (len--) {
+        crc = (uint16_t)((crc << 8) ^ s_crc16_table[((crc >> 8) ^ *data++) & 0xFF]);
+    }
+
+    return crc;
+}
+
+#endif /* CRC_USE_HW */
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    crc.h
+  * @brief   CRC计算服务头文件
+  *          CRC32（镜像完整性）与CRC16-CCITT（SD数据块）
+  * @note    STM32G4上使用CRC外设，主机构建使用查表实现；
+  *          两种实现结果一致，均可分段累加计算
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __CRC_H__
+#define __CRC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Configuration -------------------------------------------------------------*/
+
+/* 使用CRC外设（STM32G4默认启用，主机构建为查表实现） */
+#ifndef CRC_USE_HW
+#if defined(STM32G4xx) || defined(STM32G431xx)
+#define CRC_USE_HW                  1
+#else
+#define CRC_USE_HW                  0
+#endif
+#endif
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief 初始化CRC服务（使能CRC外设时钟）
+ * @note  主机构建为空操作；CRC外设为单实例，只能在主循环上下文中使用
+ */
+void crc_init(void);
+
+/**
+ * @brief 计算CRC32（IEEE 802.3，与zlib crc32()一致）
+ * @param crc 之前的结果（首段传0）
+ * @param data 数据
+ * @param len 数据长度
+ * @return 累加后的CRC32
+ * @note  crc_crc32(crc_crc32(0, a, n), b, m) 等于a、b拼接后的CRC32
+ */
+uint32_t crc_crc32(uint32_t crc, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief 计算CRC16-CCITT（多项式0x1021，初值0，与SD数据令牌CRC一致）
+ * @param crc 之前的结果（首段传0）
+ * @param data 数据
+ * @param len 数据长度
+ * @return 累加后的CRC16
+ */
+uint16_t crc_crc16_ccitt(uint16_t crc, const uint8_t *data, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CRC_H__ */
@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    cycle_stats.c
+  * @brief   耗时统计实现文件
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "cycle_stats.h"
+#include "main.h"
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 每微秒的周期数
+ */
+static uint32_t cycle_stats_per_us(void)
+{
+    uint32_t n = SystemCoreClock / 1000000U;
+
+    return n ? n : 1;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief 使能DWT周期计数器
+ */
+void cycle_stats_enable(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief 读取当前周期计数
+ */
+uint32_t cycle_stats_start(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief 记录一次操作
+ */
+uint32_t cycle_stats_add(cycle_stats_t *stats, uint32_t start)
+{
+    uint32_t cycles = DWT->CYCCNT - start;
+
+    stats->count++;
+    stats->cycles += cycles;
+    if (cycles > stats->max) {
+        stats->max = cycles;
+    }
+    return cycles;
+}
+
+/**
+ * @brief 平均耗时（微秒）
+ */
+uint32_t cycle_stats_avg_us(const cycle_stats_t *stats)
+{
+    return stats->count ? stats->cycles / stats->count / cycle_stats_per_us() : 0;
+}
+
+/**
+ * @brief 最大耗时（微秒）
+ */
+uint32_t cycle_stats_max_us(const cycle_stats_t *stats)
+{
+    return stats->max / cycle_stats_per_us();
+}
+
+/**
+ * @brief 累计耗时（微秒）
+ */
+uint32_t cycle_stats_total_us(const cycle_stats_t *stats)
+{
+    return stats->cycles / cycle_stats_per_us();
+}
@@ -0,0 +1,73 @@
+/**
+  ******************************************************************************
+  * @file    cycle_stats.h
+  * @brief   耗时统计头文件
+  *          用DWT周期计数器统计一类操作的次数、累计与最大耗时
+  * @note    用法：start = cycle_stats_start(); ... cycle_stats_add(&stats, start);
+  *          关闭时用cycle_stats_avg_us/cycle_stats_max_us换算为微秒输出
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __CYCLE_STATS_H__
+#define __CYCLE_STATS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief 一类操作的耗时统计（DWT周期）
+ */
+typedef struct {
+    uint32_t count;                     /**< 次数 */
+    uint32_t cycles;                    /**< 累计耗时 */
+    uint32_t max;                       /**< 单次最大耗时 */
+} cycle_stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief 使能DWT周期计数器（可重复调用）
+ */
+void cycle_stats_enable(void);
+
+/**
+ * @brief 读取当前周期计数，作为一次操作的起点
+ */
+uint32_t cycle_stats_start(void);
+
+/**
+ * @brief 记录一次操作
+ * @param stats 统计
+ * @param start cycle_stats_start()的返回值
+ * @return 本次耗时（周期）
+ */
+uint32_t cycle_stats_add(cycle_stats_t *stats, uint32_t start);
+
+/**
+ * @brief 平均耗时（微秒），没有记录时为0
+ */
+uint32_t cycle_stats_avg_us(const cycle_stats_t *stats);
+
+/**
+ * @brief 最大耗时（微秒）
+ */
+uint32_t cycle_stats_max_us(const cycle_stats_t *stats);
+
+/**
+ * @brief 累计耗时（微秒）
+ */
+uint32_t cycle_stats_total_us(const cycle_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CYCLE_STATS_H__ */
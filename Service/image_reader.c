@@ -0,0 +1,154 @@
+/**
+  ******************************************************************************
+  * @file    image_reader.c
+  * @brief   固件镜像读取服务实现文件
+  *          按偏移随机读取SD卡上的固件镜像
+  * @note    打开时构建FatFs快速定位表（CLMT），定位不再遍历FAT链；
+  *          从头顺序读取时同步累加整个镜像的CRC32
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "image_reader.h"
+#include "crc.h"
+#include "log.h"
+#include "main.h"
+#include <string.h>
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 定位到镜像偏移并记录耗时
+ */
+static FRESULT image_reader_seek(image_reader_t *reader, uint32_t offset)
+{
+    uint32_t start = cycle_stats_start();
+    FRESULT  res   = f_lseek(&reader->file, offset);
+
+    cycle_stats_add(&reader->seeks, start);
+    return res;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief 打开镜像文件并构建快速定位表
+ */
+FRESULT image_reader_open(image_reader_t *reader, const char *path)
+{
+    FRESULT res;
+
+    if (reader == NULL || path == NULL) {
+        return FR_INVALID_PARAMETER;
+    }
+
+    memset(reader, 0, sizeof(*reader));
+
+    res = f_open(&reader->file, path, FA_READ);
+    if (res != FR_OK) {
+        return res;
+    }
+
+    reader->size   = (uint32_t)f_size(&reader->file);
+    reader->opened = true;
+
+    /* 一次性构建CLMT，之后f_lseek/f_read按表换算簇号 */
+    reader->clmt[0]    = IMAGE_READER_CLMT_SIZE;
+    reader->file.cltbl = reader->clmt;
+    res = f_lseek(&reader->file, CREATE_LINKMAP);
+    if (res == FR_OK) {
+        reader->fast_seek = true;
+        LOG_DEBUG("image: %s %lu bytes, %lu fragment(s)", path,
+                  (unsigned long)reader->size,
+                  (unsigned long)((reader->clmt[0] - 2) / 2));
+        return FR_OK;
+    }
+
+    /* 碎片过多：退回普通定位（逐簇遍历FAT链） */
+    reader->file.cltbl = NULL;
+    if (res == FR_NOT_ENOUGH_CORE) {
+        LOG_WARN("image: %s needs CLMT of %lu, fast seek disabled", path,
+                 (unsigned long)reader->clmt[0]);
+        return FR_OK;
+    }
+
+    f_close(&reader->file);
+    reader->opened = false;
+    return res;
+}
+
+/**
+ * @brief 从指定偏移读取镜像数据
+ */
+FRESULT image_reader_read_at(image_reader_t *reader, uint32_t offset,
+                             uint8_t *buf, uint32_t len, uint32_t *br)
+{
+    FRESULT res;
+    UINT    n = 0;
+
+    if (br != NULL) {
+        *br = 0;
+    }
+    if (reader == NULL || !reader->opened || buf == NULL) {
+        return FR_INVALID_PARAMETER;
+    }
+
+    if (offset != (uint32_t)f_tell(&reader->file)) {
+        res = image_reader_seek(reader, offset);
+        if (res != FR_OK) {
+            return res;
+        }
+    }
+
+    res = f_read(&reader->file, buf, len, &n);
+    if (br != NULL) {
+        *br = n;
+    }
+
+    /* 接续已校验部分的读取顺带累加CRC32（重读、跳读不影响） */
+    if (res == FR_OK && offset == reader->crc_next) {
+        reader->crc32 = crc_crc32(reader->crc32, buf, n);
+        reader->crc_next += n;
+    }
+
+    return res;
+}
+
+/**
+ * @brief 获取整个镜像的CRC32
+ */
+bool image_reader_get_crc32(const image_reader_t *reader, uint32_t *crc)
+{
+    if (reader == NULL || crc == NULL || reader->crc_next != reader->size) {
+        return false;
+    }
+
+    *crc = reader->crc32;
+    return true;
+}
+
+/**
+ * @brief 关闭镜像文件
+ */
+FRESULT image_reader_close(image_reader_t *reader)
+{
+    if (reader == NULL || !reader->opened) {
+        return FR_INVALID_PARAMETER;
+    }
+
+    if (reader->seeks.count) {
+        LOG_DEBUG("image: %lu seek(s), avg %lu us, max %lu us (%s)",
+                  (unsigned long)reader->seeks.count,
+                  (unsigned long)cycle_stats_avg_us(&reader->seeks),
+                  (unsigned long)cycle_stats_max_us(&reader->seeks),
+                  reader->fast_seek ? "CLMT" : "FAT chain");
+    }
+    if (reader->crc_next == reader->size) {
+        LOG_DEBUG("image: crc32 %08lX", (unsigned long)reader->crc32);
+    }
+
+    reader->opened = false;
+    return f_close(&reader->file);
+}
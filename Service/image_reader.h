@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    image_reader.h
+  * @brief   固件镜像读取服务头文件
+  *          按偏移随机读取SD卡上的固件镜像
+  * @note    打开时构建FatFs快速定位表（CLMT），定位不再遍历FAT链；
+  *          从头顺序读取时同步累加整个镜像的CRC32
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __IMAGE_READER_H__
+#define __IMAGE_READER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "../FatFS/src/ff.h"
+#include "cycle_stats.h"
+
+/* Configuration -------------------------------------------------------------*/
+
+/* 快速定位表长度（DWORD个数）：可容纳 (N - 2) / 2 个碎片 */
+#ifndef IMAGE_READER_CLMT_SIZE
+#define IMAGE_READER_CLMT_SIZE      34
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief 镜像读取器
+ */
+typedef struct {
+    FIL                  file;                          /**< FatFs文件对象 */
+    DWORD                clmt[IMAGE_READER_CLMT_SIZE];  /**< 快速定位表 */
+    uint32_t             size;                          /**< 镜像大小（字节） */
+    bool                 fast_seek;                     /**< CLMT构建成功 */
+    bool                 opened;                        /**< 已打开 */
+    cycle_stats_t        seeks;                         /**< 定位次数与耗时 */
+    uint32_t             crc32;                         /**< 已累加部分的CRC32 */
+    uint32_t             crc_next;                      /**< CRC32已覆盖到的偏移 */
+} image_reader_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief 打开镜像文件并构建快速定位表
+ * @param reader 读取器
+ * @param path 文件路径
+ * @return FR_OK成功，其余为FatFs错误码
+ * @note  碎片过多导致CLMT不足时退回普通定位，不视为错误
+ */
+FRESULT image_reader_open(image_reader_t *reader, const char *path);
+
+/**
+ * @brief 从指定偏移读取镜像数据
+ * @param reader 读取器
+ * @param offset 镜像内偏移
+ * @param buf 数据缓冲区
+ * @param len 读取长度
+ * @param br 实际读取字节数（到达文件末尾时小于len）
+ * @return FR_OK成功，其余为FatFs错误码
+ * @note  偏移等于当前文件指针时不执行定位（顺序读取）；
+ *        读取起点恰好接续CRC32已覆盖部分时，顺带累加CRC32
+ */
+FRESULT image_reader_read_at(image_reader_t *reader, uint32_t offset,
+                             uint8_t *buf, uint32_t len, uint32_t *br);
+
+/**
+ * @brief 获取整个镜像的CRC32
+ * @param reader 读取器
+ * @param crc 输出CRC32（与zlib crc32()一致）
+ * @return true 镜像已从头到尾连续读过，CRC32有效
+ * @note  镜像数据在读取过程中顺带校验，无需再次读文件
+ */
+bool image_reader_get_crc32(const image_reader_t *reader, uint32_t *crc);
+
+/**
+ * @brief 关闭镜像文件
+ * @param reader 读取器
+ * @return FR_OK成功，其余为FatFs错误码
+ */
+FRESULT image_reader_close(image_reader_t *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IMAGE_READER_H__ */
@@ -0,0 +1,163 @@
+/**
+  ******************************************************************************
+  * @file    lcd_progress.c
+  * @brief   LCD烧录进度条实现文件
+  *          作为stc_progress_cb_t回调显示编程进度
+  * @note    进度条按列增量填充：每次回调只写新覆盖的几列像素（一次窗口填充）；
+  *          文本经LCD文本缓存只重绘变化的字符，并按间隔限频
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lcd_progress.h"
+#include "lcd.h"
+#include "log.h"
+#include "main.h"
+#include <string.h>
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 进度换算为已填充列数与百分比
+ * @note  乘法按64位计算：current * width在current超过2^32 / width（宽320时约13.4MB）后会溢出32位
+ */
+static void lcd_progress_scale(const lcd_progress_t *bar, uint32_t current, uint32_t total,
+                               uint16_t *columns, uint8_t *percent)
+{
+    if (current >= total) {
+        *columns = bar->cfg.width;
+        *percent = 100;
+        return;
+    }
+
+    *columns = (uint16_t)((uint64_t)current * bar->cfg.width / total);
+    *percent = (uint8_t)((uint64_t)current * 100U / total);
+}
+
+/**
+ * @brief 刷新文本行：标签左对齐，百分比右对齐，补齐整行
+ */
+static void lcd_progress_draw_text(lcd_progress_t *bar, uint8_t percent)
+{
+    char     line[LCD_TEXT_COLUMNS + 1];
+    uint32_t n = 0;
+    const char *label = bar->cfg.label;
+
+    memset(line, ' ', LCD_TEXT_COLUMNS);
+    line[LCD_TEXT_COLUMNS] = '\0';
+
+    while (label != NULL && *label != '\0' && n < LCD_PROGRESS_LABEL_MAX) {
+        line[n++] = *label++;
+    }
+
+    line[LCD_TEXT_COLUMNS - 1] = '%';
+    line[LCD_TEXT_COLUMNS - 2] = (char)('0' + percent % 10);
+    if (percent >= 10) {
+        line[LCD_TEXT_COLUMNS - 3] = (char)('0' + (percent / 10) % 10);
+    }
+    if (percent >= 100) {
+        line[LCD_TEXT_COLUMNS - 4] = '1';
+    }
+
+    LCD_DisplayStringLine(bar->cfg.text_line, (u8 *)line);
+
+    bar->percent      = percent;
+    bar->last_text_ms = HAL_GetTick();
+    bar->stats.text_updates++;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief 初始化进度条并绘制空进度条
+ */
+void lcd_progress_init(lcd_progress_t *bar, const lcd_progress_config_t *cfg)
+{
+    if (bar == NULL || cfg == NULL) {
+        return;
+    }
+
+    memset(bar, 0, sizeof(*bar));
+    bar->cfg = *cfg;
+
+    /* 回调计时不依赖bsp_sdcard_init已使能DWT */
+    cycle_stats_enable();
+
+    if (bar->cfg.text_interval_ms == 0) {
+        bar->cfg.text_interval_ms = LCD_PROGRESS_TEXT_INTERVAL_MS;
+    }
+
+    LCD_FillRect(bar->cfg.x, bar->cfg.y, bar->cfg.height, bar->cfg.width, bar->cfg.back_color);
+    if (bar->cfg.text_line != LCD_PROGRESS_NO_TEXT) {
+        lcd_progress_draw_text(bar, 0);
+    }
+    bar->stats.text_updates = 0;
+}
+
+/**
+ * @brief 进度回调
+ * @note  常见情况（1~2列新像素、文本未到刷新时刻）只有一次十几像素的窗口填充
+ */
+void lcd_progress_update(uint32_t current, uint32_t total, void *user_data)
+{
+    lcd_progress_t *bar = (lcd_progress_t *)user_data;
+    uint32_t start = cycle_stats_start();
+    uint16_t columns;
+    uint8_t  percent;
+
+    if (bar == NULL || total == 0) {
+        return;
+    }
+
+    lcd_progress_scale(bar, current, total, &columns, &percent);
+    bar->latest = percent;
+
+    if (columns > bar->filled) {
+        LCD_FillRect(bar->cfg.x, bar->cfg.y - bar->filled, bar->cfg.height,
+                     columns - bar->filled, bar->cfg.bar_color);
+        bar->stats.columns += columns - bar->filled;
+        bar->filled = columns;
+    } else if (columns < bar->filled) {
+        /* 进度回退（未重新初始化就开始新一轮）：擦除多出的部分 */
+        LCD_FillRect(bar->cfg.x, bar->cfg.y - columns, bar->cfg.height,
+                     bar->filled - columns, bar->cfg.back_color);
+        bar->filled = columns;
+    }
+
+    /* 百分比变化且距上次刷新已超过间隔才重绘；100%总是立即显示 */
+    if (bar->cfg.text_line != LCD_PROGRESS_NO_TEXT && percent != bar->percent &&
+        (percent == 100 ||
+         HAL_GetTick() - bar->last_text_ms >= bar->cfg.text_interval_ms)) {
+        lcd_progress_draw_text(bar, percent);
+    }
+
+    cycle_stats_add(&bar->stats.calls, start);
+}
+
+/**
+ * @brief 结束显示：刷新最终文本并输出耗时统计
+ */
+void lcd_progress_finish(lcd_progress_t *bar)
+{
+    if (bar == NULL) {
+        return;
+    }
+
+    /* 补上限频跳过的最后一次百分比（烧录中途失败时） */
+    if (bar->cfg.text_line != LCD_PROGRESS_NO_TEXT && bar->latest != bar->percent) {
+        lcd_progress_draw_text(bar, bar->latest);
+    }
+
+    if (bar->stats.calls.count) {
+        LOG_DEBUG("progress: %lu call(s), %lu column(s), %lu text update(s), "
+                  "total %lu us, avg %lu us, max %lu us",
+                  (unsigned long)bar->stats.calls.count,
+                  (unsigned long)bar->stats.columns,
+                  (unsigned long)bar->stats.text_updates,
+                  (unsigned long)cycle_stats_total_us(&bar->stats.calls),
+                  (unsigned long)cycle_stats_avg_us(&bar->stats.calls),
+                  (unsigned long)cycle_stats_max_us(&bar->stats.calls));
+    }
+}
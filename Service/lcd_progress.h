@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file    lcd_progress.h
+  * @brief   LCD烧录进度条头文件
+  *          作为stc_progress_cb_t回调显示编程进度
+  * @note    每次回调只填充新覆盖的像素列，百分比文本按时间间隔限频刷新；
+  *          回调耗时用DWT统计，结束时输出，用于确认显示不拖慢烧录
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __LCD_PROGRESS_H__
+#define __LCD_PROGRESS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "cycle_stats.h"
+
+/* Configuration -------------------------------------------------------------*/
+
+/* 百分比文本默认最小刷新间隔（毫秒） */
+#ifndef LCD_PROGRESS_TEXT_INTERVAL_MS
+#define LCD_PROGRESS_TEXT_INTERVAL_MS   250
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+#define LCD_PROGRESS_NO_TEXT            0xFF    /**< text_line取此值时不显示文本 */
+#define LCD_PROGRESS_LABEL_MAX          14      /**< 标签最大字符数（一行20字符，留6个给百分比） */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief 进度条配置
+ * @note  坐标与LCD_DrawRect一致：x为顶行（0~239），y为最左列（319为屏幕左边缘）
+ */
+typedef struct {
+    uint8_t     x;                      /**< 顶行 */
+    uint16_t    y;                      /**< 最左列 */
+    uint8_t     height;                 /**< 高度（像素） */
+    uint16_t    width;                  /**< 宽度（像素） */
+    uint16_t    bar_color;              /**< 已完成部分颜色 */
+    uint16_t    back_color;             /**< 未完成部分颜色 */
+    uint8_t     text_line;              /**< 文本行（Line0~Line9），LCD_PROGRESS_NO_TEXT不显示 */
+    const char *label;                  /**< 文本标签，可为NULL */
+    uint32_t    text_interval_ms;       /**< 文本最小刷新间隔，0取默认值 */
+} lcd_progress_config_t;
+
+/**
+ * @brief 回调统计
+ */
+typedef struct {
+    cycle_stats_t calls;                /**< 回调次数与耗时 */
+    uint32_t      columns;                   /**< 绘制的像素列数 */
+    uint32_t      text_updates;         /**< 文本刷新次数 */
+} lcd_progress_stats_t;
+
+/**
+ * @brief 进度条
+ */
+typedef struct {
+    lcd_progress_config_t cfg;          /**< 配置 */
+    uint16_t             filled;        /**< 已填充的像素列数 */
+    uint8_t              percent;       /**< 已显示的百分比 */
+    uint8_t              latest;        /**< 最近一次回调的百分比 */
+    uint32_t             last_text_ms;  /**< 上次刷新文本的时刻 */
+    lcd_progress_stats_t stats;         /**< 耗时统计 */
+} lcd_progress_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief 初始化进度条并绘制空进度条
+ * @param bar 进度条对象
+ * @param cfg 配置（复制保存，label指向的字符串须保持有效）
+ */
+void lcd_progress_init(lcd_progress_t *bar, const lcd_progress_config_t *cfg);
+
+/**
+ * @brief 进度回调（stc_progress_cb_t）
+ * @param current 已完成字节数
+ * @param total 总字节数
+ * @param user_data 进度条对象（lcd_progress_t*）
+ * @note  用法：stc_context_set_progress_callback(&ctx, lcd_progress_update, &bar)
+ */
+void lcd_progress_update(uint32_t current, uint32_t total, void *user_data);
+
+/**
+ * @brief 结束显示：刷新最终文本并输出耗时统计
+ * @param bar 进度条对象
+ */
+void lcd_progress_finish(lcd_progress_t *bar);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LCD_PROGRESS_H__ */
@@ -11,11 +11,39 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "log.h"
+#include "main.h"
 #include <string.h>
 #include <stdio.h>
 
 /* Private defines -----------------------------------------------------------*/
 
+/* 二进制记录最大长度：头字节 + 编号 + 时间差与参数（每个LEB128最多5字节） */
+#define LOG_BIN_RECORD_MAX  (1 + 2 + 5 * (1 + LOG_BIN_MAX_ARGS))
+
+#define LOG_RING_MASK       (LOG_RING_SLOTS - 1U)
+
+#if (LOG_RING_SLOTS & LOG_RING_MASK) != 0
+#error "LOG_RING_SLOTS must be a power of 2"
+#endif
+
+/* 槽状态 */
+#define LOG_SLOT_FREE       0U      /**< 空闲或已预留未开始写 */
+#define LOG_SLOT_WRITING    1U      /**< 写入中 */
+#define LOG_SLOT_READY      2U      /**< 已写完，等待输出 */
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief 环形队列槽：一条格式化好的文本日志或一条二进制记录
+ */
+typedef struct {
+    volatile uint32_t state;        /**< LOG_SLOT_xxx */
+    uint32_t tick;                  /**< 二进制记录的时刻（输出时换算为时间差） */
+    uint16_t len;                   /**< data中的有效字节数 */
+    uint8_t  binary;                /**< 1为二进制记录（不含时间差） */
+    char     data[LOG_BUFFER_SIZE];
+} log_slot_t;
+
 /* Private variables ---------------------------------------------------------*/
 
 /**
@@ -34,14 +62,38 @@ static log_output_handle_t s_output_handles[LOG_MAX_OUTPUT_HANDLES];
 static uint8_t s_output_count = 0;
 
 /**
- * @brief 日志缓冲区（用于非printf格式输出）
+ * @brief 日志环形队列
+ * @note  写入方（任意上下文）用LDREX/STREX对head做CAS预留槽位，写完后把槽置为READY；
+ *        输出方按预留顺序取出READY的槽，遇到仍在写入的槽就停下（写入方提交后自己接着输出）。
+ *        head、tail都是自由递增的计数，tail只由持有s_drain_owner的一方推进
+ */
+static log_slot_t s_ring[LOG_RING_SLOTS];
+static volatile uint32_t s_ring_head = 0;       /**< 下一个预留位置 */
+static volatile uint32_t s_ring_tail = 0;       /**< 下一个输出位置 */
+static volatile uint32_t s_drain_owner = 0;     /**< 1表示有一方正在输出 */
+
+/**
+ * @brief 日志统计（计数用LDREX/STREX原子递增）
  */
-static char s_log_buffer[LOG_BUFFER_SIZE];
+static log_stats_t s_stats;
+
+/**
+ * @brief 上一条二进制记录的时刻（记录中只存时间差，只由输出方访问）
+ */
+static uint32_t s_bin_last_tick = 0;
 
 /* Private function prototypes -----------------------------------------------*/
 static const char *log_get_level_string(log_level_t level);
 static uint32_t log_get_tick(void);
 static void log_format_message(log_level_t level, const char *format, va_list args, char *buffer, uint32_t buffer_size);
+static uint32_t log_bin_put_varint(uint8_t *buf, uint32_t pos, uint32_t value);
+static void log_vwrite(log_module_t module, log_level_t level, const char *format, va_list args);
+static void log_atomic_inc(volatile uint32_t *addr);
+static log_slot_t *log_ring_reserve(log_module_t module, log_level_t level);
+static void log_ring_commit(log_slot_t *slot);
+static void log_ring_drain(void);
+static void log_output_slot(const log_slot_t *slot);
+static void log_output_printf(log_output_printf_func_t func, const char *format, ...);
 
 /* Exported functions --------------------------------------------------------*/
 
@@ -52,6 +104,12 @@ void log_init(void)
 {
     s_min_level = LOG_LEVEL_DEBUG;
     s_output_count = 0;
+    s_bin_last_tick = 0;
+    s_ring_head = 0;
+    s_ring_tail = 0;
+    s_drain_owner = 0;
+    memset(s_ring, 0, sizeof(s_ring));
+    memset(&s_stats, 0, sizeof(s_stats));
     memset(s_output_handles, 0, sizeof(s_output_handles));
 }
 
@@ -200,83 +258,94 @@ int log_unregister_output(log_output_handle_t *handle)
  */
 void log_write(log_level_t level, const char *format, ...)
 {
+    va_list args;
+
+    va_start(args, format);
+    log_vwrite(LOG_MODULE_APP, level, format, args);
+    va_end(args);
+}
+
+/**
+ * @brief 写入日志并指定所属模块（printf风格）
+ */
+void log_write_module(log_module_t module, log_level_t level, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    log_vwrite(module, level, format, args);
+    va_end(args);
+}
+
+/**
+ * @brief 写入二进制日志
+ * @note  不格式化字符串，只编码记录并交给原始数据输出接口；printf格式输出接口不接收二进制记录
+ */
+void log_write_bin(log_module_t module, log_level_t level, const char *format, uint32_t nargs, ...)
+{
+    log_slot_t *slot;
+    uint8_t    *record;
+    uint32_t    id, pos;
+    va_list     args;
+
     // 级别过滤
     if (level < s_min_level || level > LOG_LEVEL_ERROR)
     {
         return;
     }
 
-    // 参数检查
-    if (format == NULL || s_output_count == 0)
+    if (format == NULL || s_output_count == 0 || nargs > LOG_BIN_MAX_ARGS || module >= LOG_MODULE_COUNT)
     {
         return;
     }
 
-    va_list args;
-    va_start(args, format);
-
-    // 处理原始数据输出接口（需要先sprintf格式化）
-    int has_raw_output = 0;
-    for (uint8_t i = 0; i < s_output_count; i++)
+    slot = log_ring_reserve(module, level);
+    if (slot == NULL)
     {
-        if (s_output_handles[i].output_type == LOG_OUTPUT_TYPE_RAW)
-        {
-            has_raw_output = 1;
-            break;
-        }
+        return;
     }
 
-    if (has_raw_output)
-    {
-        // 复制va_list（因为printf格式输出还需要使用）
-        va_list args_copy;
-        va_copy(args_copy, args);
+    // 时间差在输出时按输出顺序计算，槽中只存头、编号与参数
+    id     = ((uint32_t)format - LOG_BIN_FMT_BASE) >> 2;
+    record = (uint8_t *)slot->data;
+    record[0] = (uint8_t)(LOG_BIN_RECORD_MARK | (nargs << 2) | (uint32_t)level);
+    record[1] = (uint8_t)id;
+    record[2] = (uint8_t)(id >> 8);
+    pos = 3;
 
-        // 格式化日志消息
-        log_format_message(level, format, args_copy, s_log_buffer, LOG_BUFFER_SIZE);
+    va_start(args, nargs);
+    while (nargs--)
+    {
+        pos = log_bin_put_varint(record, pos, va_arg(args, uint32_t));
+    }
+    va_end(args);
 
-        va_end(args_copy);
+    slot->tick   = log_get_tick();
+    slot->len    = (uint16_t)pos;
+    slot->binary = 1;
+    log_ring_commit(slot);
+}
 
-        // 输出到所有原始数据输出接口
-        for (uint8_t i = 0; i < s_output_count; i++)
-        {
-            if (s_output_handles[i].output_type == LOG_OUTPUT_TYPE_RAW &&
-                s_output_handles[i].output_func.raw_func != NULL)
-            {
-                s_output_handles[i].output_func.raw_func((const uint8_t *)s_log_buffer, strlen(s_log_buffer));
-            }
-        }
+/**
+ * @brief 输出队列中已写完的日志
+ */
+void log_process(void)
+{
+    if (__get_IPSR() == 0U)
+    {
+        log_ring_drain();
     }
+}
 
-    // 处理printf格式输出接口
-    for (uint8_t i = 0; i < s_output_count; i++)
+/**
+ * @brief 获取日志统计
+ */
+void log_get_stats(log_stats_t *stats)
+{
+    if (stats != NULL)
     {
-        if (s_output_handles[i].output_type == LOG_OUTPUT_TYPE_PRINTF &&
-            s_output_handles[i].output_func.printf_func != NULL)
-        {
-            // 创建格式化字符串（包含级别前缀和时间戳）
-            const char *level_str = log_get_level_string(level);
-            char full_format[LOG_BUFFER_SIZE];
-            
-#if LOG_ENABLE_TIMESTAMP
-            uint32_t timestamp = log_get_tick();
-            snprintf(full_format, LOG_BUFFER_SIZE, "[%08lu] %s %s\r\n", timestamp, level_str, format);
-#else
-            snprintf(full_format, LOG_BUFFER_SIZE, "%s %s\r\n", level_str, format);
-#endif
-
-            // 复制va_list（因为va_list只能使用一次）
-            va_list args_copy;
-            va_copy(args_copy, args);
-
-            // 使用printf格式输出
-            s_output_handles[i].output_func.printf_func(full_format, args_copy);
-
-            va_end(args_copy);
-        }
+        *stats = s_stats;
     }
-
-    va_end(args);
 }
 
 #if LOG_ENABLE_PRINTF_REDIRECT
@@ -286,31 +355,11 @@ void log_write(log_level_t level, const char *format, ...)
 int log_printf_redirect(const char *format, ...)
 {
     va_list args;
-    va_start(args, format);
-    
-    // 创建格式化字符串
-    char full_format[LOG_BUFFER_SIZE];
-#if LOG_ENABLE_TIMESTAMP
-    uint32_t timestamp = log_get_tick();
-    snprintf(full_format, LOG_BUFFER_SIZE, "[%08lu] [INFO] %s\r\n", timestamp, format);
-#else
-    snprintf(full_format, LOG_BUFFER_SIZE, "[INFO] %s\r\n", format);
-#endif
-
-    // 输出到所有printf格式输出接口
-    for (uint8_t i = 0; i < s_output_count; i++)
-    {
-        if (s_output_handles[i].output_type == LOG_OUTPUT_TYPE_PRINTF &&
-            s_output_handles[i].output_func.printf_func != NULL)
-        {
-            va_list args_copy;
-            va_copy(args_copy, args);
-            s_output_handles[i].output_func.printf_func(full_format, args_copy);
-            va_end(args_copy);
-        }
-    }
 
+    va_start(args, format);
+    log_vwrite(LOG_MODULE_APP, LOG_LEVEL_INFO, format, args);
     va_end(args);
+
     return 0;
 }
 #endif
@@ -346,6 +395,209 @@ static uint32_t log_get_tick(void)
     return HAL_GetTick();
 }
 
+/**
+ * @brief 写入LEB128变长整数（每字节7位，最高位表示后面还有字节）
+ * @return 写入后的位置
+ */
+static uint32_t log_bin_put_varint(uint8_t *buf, uint32_t pos, uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        buf[pos++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buf[pos++] = (uint8_t)value;
+
+    return pos;
+}
+
+/**
+ * @brief 格式化一条文本日志到队列
+ */
+static void log_vwrite(log_module_t module, log_level_t level, const char *format, va_list args)
+{
+    log_slot_t *slot;
+
+    // 级别过滤
+    if (level < s_min_level || level > LOG_LEVEL_ERROR)
+    {
+        return;
+    }
+
+    // 参数检查
+    if (format == NULL || s_output_count == 0 || module >= LOG_MODULE_COUNT)
+    {
+        return;
+    }
+
+    slot = log_ring_reserve(module, level);
+    if (slot == NULL)
+    {
+        return;
+    }
+
+    // 直接格式化进槽，不经过共享缓冲区
+    log_format_message(level, format, args, slot->data, LOG_BUFFER_SIZE);
+    slot->len    = (uint16_t)strlen(slot->data);
+    slot->binary = 0;
+    log_ring_commit(slot);
+}
+
+/**
+ * @brief 原子递增（LDREX/STREX，期间被中断打断时STREX失败并重试）
+ */
+static void log_atomic_inc(volatile uint32_t *addr)
+{
+    uint32_t value;
+
+    do
+    {
+        value = __LDREXW(addr) + 1U;
+    } while (__STREXW(value, addr) != 0U);
+}
+
+/**
+ * @brief 预留一个槽
+ * @return 槽指针，队列满时返回NULL并计入丢弃统计
+ */
+static log_slot_t *log_ring_reserve(log_module_t module, log_level_t level)
+{
+    uint32_t head, pending;
+
+    do
+    {
+        head    = __LDREXW(&s_ring_head);
+        pending = head - s_ring_tail;
+        if (pending >= LOG_RING_SLOTS)
+        {
+            __CLREX();
+            log_atomic_inc(&s_stats.dropped_level[level]);
+            log_atomic_inc(&s_stats.dropped_module[module]);
+            return NULL;
+        }
+    } while (__STREXW(head + 1U, &s_ring_head) != 0U);
+
+    log_atomic_inc(&s_stats.written);
+    // 峰值只作参考，并发更新时可能少记
+    if (pending + 1U > s_stats.max_pending)
+    {
+        s_stats.max_pending = pending + 1U;
+    }
+
+    s_ring[head & LOG_RING_MASK].state = LOG_SLOT_WRITING;
+    return &s_ring[head & LOG_RING_MASK];
+}
+
+/**
+ * @brief 提交写完的槽，线程上下文中顺带输出
+ * @note  中断中只提交，由被打断的log_write或主循环中的log_process输出，
+ *        避免在中断里执行阻塞的输出接口
+ */
+static void log_ring_commit(log_slot_t *slot)
+{
+    __DMB();
+    slot->state = LOG_SLOT_READY;
+
+    if (__get_IPSR() == 0U)
+    {
+        log_ring_drain();
+    }
+}
+
+/**
+ * @brief 按预留顺序输出READY的槽
+ * @note  s_drain_owner保证同一时刻只有一方调用输出接口（输出接口因此不需要可重入）；
+ *        释放后再检查一次，避免与刚提交的一方互相错过
+ */
+static void log_ring_drain(void)
+{
+    log_slot_t *slot;
+
+    do
+    {
+        if (__LDREXW(&s_drain_owner) != 0U)
+        {
+            __CLREX();
+            return;
+        }
+        if (__STREXW(1U, &s_drain_owner) != 0U)
+        {
+            continue;
+        }
+        __DMB();
+
+        for (;;)
+        {
+            slot = &s_ring[s_ring_tail & LOG_RING_MASK];
+            if (slot->state != LOG_SLOT_READY)
+            {
+                break;
+            }
+            __DMB();
+            log_output_slot(slot);
+            slot->state = LOG_SLOT_FREE;
+            __DMB();
+            s_ring_tail++;
+        }
+
+        __DMB();
+        s_drain_owner = 0;
+        __DMB();
+    } while (s_ring[s_ring_tail & LOG_RING_MASK].state == LOG_SLOT_READY);
+}
+
+/**
+ * @brief 把一个槽交给所有输出接口
+ * @note  二进制记录在此补上时间差，只送原始数据输出接口
+ */
+static void log_output_slot(const log_slot_t *slot)
+{
+    uint8_t  record[LOG_BIN_RECORD_MAX];
+    uint32_t len;
+
+    if (slot->binary)
+    {
+        memcpy(record, slot->data, 3);
+        len = log_bin_put_varint(record, 3, slot->tick - s_bin_last_tick);
+        memcpy(&record[len], &slot->data[3], slot->len - 3U);
+        len += slot->len - 3U;
+        s_bin_last_tick = slot->tick;
+    }
+
+    for (uint8_t i = 0; i < s_output_count; i++)
+    {
+        if (s_output_handles[i].output_type == LOG_OUTPUT_TYPE_RAW &&
+            s_output_handles[i].output_func.raw_func != NULL)
+        {
+            if (slot->binary)
+            {
+                s_output_handles[i].output_func.raw_func(record, len);
+            }
+            else
+            {
+                s_output_handles[i].output_func.raw_func((const uint8_t *)slot->data, slot->len);
+            }
+        }
+        else if (s_output_handles[i].output_type == LOG_OUTPUT_TYPE_PRINTF &&
+                 s_output_handles[i].output_func.printf_func != NULL && !slot->binary)
+        {
+            log_output_printf(s_output_handles[i].output_func.printf_func, "%s", slot->data);
+        }
+    }
+}
+
+/**
+ * @brief 以可变参数形式调用printf格式输出接口
+ */
+static void log_output_printf(log_output_printf_func_t func, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    func(format, args);
+    va_end(args);
+}
+
 /**
  * @brief 格式化日志消息（用于原始数据输出）
  */
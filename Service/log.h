@@ -41,11 +41,34 @@ extern "C" {
 #define LOG_MAX_OUTPUT_HANDLES      4
 #endif
 
-/* 日志消息缓冲区大小（用于非printf格式输出） */
+/* 日志消息缓冲区大小（环形队列每个槽的容量，超长消息截断） */
 #ifndef LOG_BUFFER_SIZE
 #define LOG_BUFFER_SIZE             256
 #endif
 
+/* 日志环形队列槽数（2的幂）：log_write把消息格式化进槽后由log_process/线程上下文的log_write输出，
+ * 中断中可安全调用；队列满时丢弃并按级别、模块计数 */
+#ifndef LOG_RING_SLOTS
+#define LOG_RING_SLOTS              8
+#endif
+
+/* 二进制日志：LOG_DEBUG等宏只记录格式串编号与原始参数，由主机端工具解码
+ * （Service/tools/logbin.py），只输出到原始数据输出接口 */
+#ifndef LOG_ENABLE_BINARY
+#define LOG_ENABLE_BINARY           0
+#endif
+
+/* 格式串编号的基地址（格式串所在Flash的起始地址） */
+#ifndef LOG_BIN_FMT_BASE
+#define LOG_BIN_FMT_BASE            0x08000000UL
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+#define LOG_BIN_MAX_ARGS            7           /**< 二进制日志每条最多参数个数 */
+#define LOG_BIN_FMT_MARK            "\x1E"      /**< 格式串前缀，主机端据此从固件中提取格式表 */
+#define LOG_BIN_RECORD_MARK         0xA0        /**< 记录头高3位，与ASCII文本区分 */
+
 /* Exported types ------------------------------------------------------------*/
 
 /**
@@ -58,6 +81,34 @@ typedef enum {
     LOG_LEVEL_ERROR = 3     /**< 错误信息 */
 } log_level_t;
 
+/**
+ * @brief 日志模块（用于丢弃计数）
+ * @note  源文件在包含log.h之前定义LOG_MODULE来指定LOG_DEBUG等宏所属的模块
+ */
+typedef enum {
+    LOG_MODULE_APP = 0,     /**< 应用/主循环（默认） */
+    LOG_MODULE_UART,        /**< 串口驱动与中断 */
+    LOG_MODULE_DMA,         /**< DMA事件 */
+    LOG_MODULE_SD,          /**< SD卡与文件系统 */
+    LOG_MODULE_ISP,         /**< STC ISP协议 */
+    LOG_MODULE_LCD,         /**< LCD显示 */
+    LOG_MODULE_COUNT
+} log_module_t;
+
+#ifndef LOG_MODULE
+#define LOG_MODULE                  LOG_MODULE_APP
+#endif
+
+/**
+ * @brief 日志统计
+ */
+typedef struct {
+    uint32_t written;                               /**< 进入队列的消息数 */
+    uint32_t dropped_level[LOG_LEVEL_ERROR + 1];    /**< 队列满丢弃数（按级别） */
+    uint32_t dropped_module[LOG_MODULE_COUNT];      /**< 队列满丢弃数（按模块） */
+    uint32_t max_pending;                           /**< 队列中待输出消息数的峰值 */
+} log_stats_t;
+
 /**
  * @brief 日志输出类型枚举
  */
@@ -141,19 +192,87 @@ int log_unregister_output(log_output_handle_t *handle);
  * @param level 日志级别
  * @param format 格式化字符串（printf风格）
  * @param ... 可变参数
- * @note  日志格式：[时间戳] [级别] 消息
+ * @note  日志格式：[时间戳] [级别] 消息；归入LOG_MODULE_APP，其余同log_write_module
  */
 void log_write(log_level_t level, const char *format, ...);
 
+/**
+ * @brief 写入日志并指定所属模块（printf风格）
+ * @param module 日志模块
+ * @param level 日志级别
+ * @param format 格式化字符串（printf风格）
+ * @param ... 可变参数
+ * @note  可在中断中调用：只格式化进环形队列的槽（CAS预留，不关中断），
+ *        由线程上下文的log_write或log_process按预留顺序交给输出接口
+ */
+void log_write_module(log_module_t module, log_level_t level, const char *format, ...);
+
+/**
+ * @brief 写入二进制日志（通常通过LOG_BIN宏调用）
+ * @param module 日志模块
+ * @param level 日志级别
+ * @param format 带LOG_BIN_FMT_MARK前缀、4字节对齐的格式串（其地址即消息编号）
+ * @param nargs 参数个数（0 ~ LOG_BIN_MAX_ARGS）
+ * @param ... 参数，每个按32位整数记录（%s记录字符串地址，不支持浮点与64位整数）
+ * @note  记录格式：头字节（0xA0 | 参数个数<<2 | 级别）、16位编号（小端）、
+ *        距上一条记录的毫秒数与各参数（均为LEB128变长整数）
+ */
+void log_write_bin(log_module_t module, log_level_t level, const char *format, uint32_t nargs, ...);
+
+/**
+ * @brief 输出队列中已写完的日志
+ * @note  在主循环中周期调用，中断里写入的日志由此输出；中断中调用时不做任何事
+ */
+void log_process(void);
+
+/**
+ * @brief 获取日志统计（写入数、按级别/模块的丢弃数）
+ * @param stats 输出统计
+ */
+void log_get_stats(log_stats_t *stats);
+
 /* Exported macros -----------------------------------------------------------*/
 
+/**
+ * @brief 统计可变参数个数（0 ~ 16，超过LOG_BIN_MAX_ARGS时LOG_BIN在调用处编译报错）
+ */
+#define LOG_BIN_NARGS(...)   LOG_BIN_NARGS_(0, ##__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, \
+                                            8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_BIN_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, \
+                       _15, _16, N, ...)  N
+
+/**
+ * @brief 二进制日志宏
+ * @note  fmt须为字符串字面量：每个调用点生成一个4字节对齐的静态格式串，
+ *        (地址 - LOG_BIN_FMT_BASE) / 4即为消息编号，不在运行时格式化
+ * @note  %s只记录指针：参数须指向Flash中的字符串常量，指向RAM的字符串（如文件路径、接收缓冲）
+ *        主机端解码为<ram 0x...>，需要其内容时直接调用log_write输出文本
+ */
+#define LOG_BIN(level, fmt, ...)                                                    \
+    do {                                                                            \
+        typedef char log_bin_too_many_args_                                         \
+            [(LOG_BIN_NARGS(__VA_ARGS__) <= LOG_BIN_MAX_ARGS) ? 1 : -1]             \
+            __attribute__((unused));                                                \
+        static const char log_bin_fmt_[] __attribute__((aligned(4), used)) =        \
+            LOG_BIN_FMT_MARK fmt;                                                   \
+        log_write_bin(LOG_MODULE, (level), log_bin_fmt_,                            \
+                      LOG_BIN_NARGS(__VA_ARGS__), ##__VA_ARGS__);                   \
+    } while (0)
+
 /**
  * @brief 便捷日志宏（推荐使用）
  */
-#define LOG_DEBUG(fmt, ...)  log_write(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
-#define LOG_INFO(fmt, ...)   log_write(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
-#define LOG_WARN(fmt, ...)   log_write(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
-#define LOG_ERROR(fmt, ...)  log_write(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#if LOG_ENABLE_BINARY
+#define LOG_DEBUG(fmt, ...)  LOG_BIN(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#define LOG_INFO(fmt, ...)   LOG_BIN(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#define LOG_WARN(fmt, ...)   LOG_BIN(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#define LOG_ERROR(fmt, ...)  LOG_BIN(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(fmt, ...)  log_write_module(LOG_MODULE, LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#define LOG_INFO(fmt, ...)   log_write_module(LOG_MODULE, LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#define LOG_WARN(fmt, ...)   log_write_module(LOG_MODULE, LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#define LOG_ERROR(fmt, ...)  log_write_module(LOG_MODULE, LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#endif
 
 /**
  * @brief 条件编译：Release模式禁用DEBUG日志
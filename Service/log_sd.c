@@ -0,0 +1,312 @@
+/**
+  ******************************************************************************
+  * @file    log_sd.c
+  * @brief   SD卡日志输出实现文件
+  *          日志行攒成整扇区后写入预分配的循环日志文件
+  * @note    文件创建、扇区CRC与读写由sector_file.c完成，本文件只负责
+  *          扇区缓冲、按序号循环覆盖和掉电后恢复写入位置
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#define LOG_MODULE  LOG_MODULE_SD
+#include "log_sd.h"
+#include "log.h"
+#include "main.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+typedef char log_sd_hdr_size_check[(sizeof(log_sd_sector_hdr_t) == LOG_SD_HDR_SIZE) ? 1 : -1];
+typedef char log_sd_sector_size_check[(sizeof(log_sd_sector_t) == LOG_SD_SECTOR_SIZE) ? 1 : -1];
+typedef char log_sd_hdr_layout_check[(offsetof(log_sd_sector_hdr_t, len) == offsetof(sector_file_hdr_t, count) &&
+                                      offsetof(log_sd_sector_hdr_t, log_id) == offsetof(sector_file_hdr_t, log_id) &&
+                                      offsetof(log_sd_sector_hdr_t, seq) == offsetof(sector_file_hdr_t, seq)) ? 1 : -1];
+
+#if LOG_SD_BUFFERS < 2
+#error "LOG_SD_BUFFERS must be at least 2"
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+
+static const sector_file_format_t s_format = {
+    LOG_SD_MAGIC, LOG_SD_VERSION, LOG_SD_PAYLOAD_SIZE, offsetof(log_sd_sector_hdr_t, crc32),
+};
+
+/**
+ * @brief 已打开的日志对象（原始数据输出接口没有用户参数）
+ */
+static log_sd_t *s_sink = NULL;
+
+/* Private function prototypes -----------------------------------------------*/
+static int log_sd_output(const uint8_t *data, uint32_t len);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 开始填充一个新缓冲
+ */
+static void log_sd_start_buffer(log_sd_t *lsd, log_sd_sector_t *sec)
+{
+    sec->hdr.len = 0;
+    sec->hdr.seq = lsd->next_seq++;
+    lsd->flushed_len = 0;
+}
+
+/**
+ * @brief 读取扇区并检查有效性
+ * @param sec 读取缓冲（使用stage）
+ * @param check_id 是否要求log_id与当前日志一致
+ * @return true 扇区有效且位于其序号对应的位置
+ */
+static bool log_sd_load_sector(log_sd_t *lsd, uint32_t index, bool check_id)
+{
+    return sector_file_read(&lsd->sf, index, &lsd->stage, check_id) &&
+           (lsd->stage.hdr.seq % lsd->sf.capacity) == index;
+}
+
+/**
+ * @brief 恢复写入位置
+ * @note  第i个扇区总是存放序号seq % 容量 == i的数据，本圈写过的扇区满足
+ *        seq == 首扇区seq + i，构成前缀，二分查找最后一个；首扇区无效但末扇区
+ *        有效说明掉电时正在回绕写首扇区，从首扇区继续
+ */
+static void log_sd_recover(log_sd_t *lsd)
+{
+    uint32_t lo, hi, mid, seq0;
+
+    if (!log_sd_load_sector(lsd, 0, false)) {
+        if (log_sd_load_sector(lsd, lsd->sf.capacity - 1, false)) {
+            lsd->sf.log_id = lsd->stage.hdr.log_id;
+            lsd->next_seq  = lsd->stage.hdr.seq + 1;
+        }
+        /* 否则为空日志或其他文件残留的数据，使用新标识 */
+        return;
+    }
+    lsd->sf.log_id = lsd->stage.hdr.log_id;
+    seq0 = lsd->stage.hdr.seq;
+
+    lo = 0;                 /* 已知属于本圈 */
+    hi = lsd->sf.capacity;  /* 已知不属于本圈（文件末尾） */
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if (log_sd_load_sector(lsd, mid, true) && lsd->stage.hdr.seq == seq0 + mid) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    lsd->next_seq = seq0 + lo + 1;
+}
+
+/**
+ * @brief 将扇区写入seq对应的位置
+ * @note  只修改扇区头，数据区由调用者保证写卡期间不变；失败时缓冲保留，下次调用时重试
+ */
+static FRESULT log_sd_write_sector(log_sd_t *lsd, log_sd_sector_t *sec)
+{
+    return sector_file_write(&lsd->sf, sec->hdr.seq % lsd->sf.capacity, sec);
+}
+
+/**
+ * @brief 写出缓冲
+ * @param partial 是否同时写出正在填充的缓冲
+ */
+static FRESULT log_sd_write_pending(log_sd_t *lsd, bool partial)
+{
+    log_sd_sector_t *cur;
+    FRESULT res;
+
+    /* 写满的缓冲不再被追加，直接写出 */
+    while (lsd->done != lsd->fill) {
+        res = log_sd_write_sector(lsd, &lsd->buffers[lsd->done % LOG_SD_BUFFERS]);
+        if (res != FR_OK) {
+            return res;
+        }
+        lsd->done++;
+    }
+
+    if (!partial) {
+        return FR_OK;
+    }
+
+    /* 未满的缓冲写卡期间可能被追加（FatFs/SD驱动内部的日志），复制一份再写；
+     * 之后写满时同一序号再写一次，覆盖这次的内容 */
+    cur = &lsd->buffers[lsd->fill % LOG_SD_BUFFERS];
+    if (cur->hdr.len <= lsd->flushed_len) {
+        return FR_OK;
+    }
+    memcpy(&lsd->stage, cur, LOG_SD_SECTOR_SIZE);
+
+    res = log_sd_write_sector(lsd, &lsd->stage);
+    /* 写卡期间缓冲写满并切换时，新缓冲还没有写出过 */
+    cur = &lsd->buffers[lsd->fill % LOG_SD_BUFFERS];
+    if (res == FR_OK && lsd->stage.hdr.seq == cur->hdr.seq) {
+        lsd->flushed_len = lsd->stage.hdr.len;
+    }
+
+    return res;
+}
+
+/**
+ * @brief 原始数据输出接口：把日志行复制到扇区缓冲
+ * @note  由日志服务在线程上下文中调用（见log.c），不访问SD卡；
+ *        剩余缓冲放不下整行时丢弃该行，不写入半行
+ */
+static int log_sd_output(const uint8_t *data, uint32_t len)
+{
+    log_sd_t        *lsd = s_sink;
+    log_sd_sector_t *cur;
+    uint32_t         space, n;
+
+    if (lsd == NULL || !lsd->opened) {
+        return -1;
+    }
+
+    cur   = &lsd->buffers[lsd->fill % LOG_SD_BUFFERS];
+    space = (LOG_SD_PAYLOAD_SIZE - cur->hdr.len) +
+            (LOG_SD_BUFFERS - 1 - (lsd->fill - lsd->done)) * LOG_SD_PAYLOAD_SIZE;
+    if (len > space) {
+        lsd->stats.dropped++;
+        return -2;
+    }
+
+    while (len > 0) {
+        if (cur->hdr.len == LOG_SD_PAYLOAD_SIZE) {
+            lsd->fill++;
+            cur = &lsd->buffers[lsd->fill % LOG_SD_BUFFERS];
+            log_sd_start_buffer(lsd, cur);
+        }
+        n = LOG_SD_PAYLOAD_SIZE - cur->hdr.len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(&cur->data[cur->hdr.len], data, n);
+        cur->hdr.len += (uint16_t)n;
+        data += n;
+        len  -= n;
+    }
+
+    /* 刚好写满时立即交给log_sd_poll，不等下一行 */
+    if (cur->hdr.len == LOG_SD_PAYLOAD_SIZE && (lsd->fill + 1 - lsd->done) < LOG_SD_BUFFERS) {
+        lsd->fill++;
+        log_sd_start_buffer(lsd, &lsd->buffers[lsd->fill % LOG_SD_BUFFERS]);
+    }
+
+    lsd->last_output_ms = HAL_GetTick();
+    lsd->stats.lines++;
+
+    return 0;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief 打开（不存在时创建并预分配）日志文件，并注册为日志输出接口
+ */
+FRESULT log_sd_open(log_sd_t *lsd, const char *path)
+{
+    log_output_handle_t handle;
+    FRESULT res;
+    bool    created = false;
+
+    if (lsd == NULL || path == NULL || s_sink != NULL) {
+        return FR_INVALID_PARAMETER;
+    }
+
+    memset(lsd, 0, sizeof(*lsd));
+
+    res = sector_file_open(&lsd->sf, path, LOG_SD_FILE_SIZE, &s_format, &created);
+    if (res != FR_OK) {
+        return res;
+    }
+
+    if (!created) {
+        log_sd_recover(lsd);
+    }
+    log_sd_start_buffer(lsd, &lsd->buffers[0]);
+
+    handle.output_type          = LOG_OUTPUT_TYPE_RAW;
+    handle.output_func.raw_func = log_sd_output;
+    handle.user_data            = lsd;
+
+    lsd->opened = true;
+    s_sink      = lsd;
+    if (log_register_output(&handle) != 0) {
+        lsd->opened = false;
+        s_sink      = NULL;
+        sector_file_close(&lsd->sf);
+        return FR_TOO_MANY_OPEN_FILES;
+    }
+
+    LOG_INFO("logsd: %s, sector %lu/%lu", path,
+             (unsigned long)(lsd->buffers[0].hdr.seq % lsd->sf.capacity),
+             (unsigned long)lsd->sf.capacity);
+
+    return FR_OK;
+}
+
+/**
+ * @brief 后台处理
+ */
+FRESULT log_sd_poll(log_sd_t *lsd)
+{
+    if (lsd == NULL || !lsd->opened) {
+        return FR_OK;
+    }
+
+    return log_sd_write_pending(lsd,
+                                HAL_GetTick() - lsd->last_output_ms >= LOG_SD_IDLE_FLUSH_MS);
+}
+
+/**
+ * @brief 立即写出缓冲中的全部日志
+ */
+FRESULT log_sd_flush(log_sd_t *lsd)
+{
+    if (lsd == NULL || !lsd->opened) {
+        return FR_INVALID_PARAMETER;
+    }
+
+    return log_sd_write_pending(lsd, true);
+}
+
+/**
+ * @brief 注销输出接口，写出剩余日志并关闭文件
+ */
+FRESULT log_sd_close(log_sd_t *lsd)
+{
+    log_output_handle_t handle;
+    FRESULT res;
+    FRESULT res_close;
+
+    if (lsd == NULL || !lsd->opened) {
+        return FR_INVALID_PARAMETER;
+    }
+
+    if (lsd->sf.writes.count) {
+        LOG_DEBUG("logsd: %lu line(s), %lu dropped, %lu sector write(s), avg %lu us, max %lu us",
+                  (unsigned long)lsd->stats.lines,
+                  (unsigned long)lsd->stats.dropped,
+                  (unsigned long)lsd->sf.writes.count,
+                  (unsigned long)cycle_stats_avg_us(&lsd->sf.writes),
+                  (unsigned long)cycle_stats_max_us(&lsd->sf.writes));
+    }
+
+    handle.output_type          = LOG_OUTPUT_TYPE_RAW;
+    handle.output_func.raw_func = log_sd_output;
+    handle.user_data            = lsd;
+    (void)log_unregister_output(&handle);
+
+    res = log_sd_write_pending(lsd, true);
+
+    lsd->opened = false;
+    s_sink      = NULL;
+    res_close   = sector_file_close(&lsd->sf);
+
+    return (res != FR_OK) ? res : res_close;
+}
@@ -0,0 +1,138 @@
+/**
+  ******************************************************************************
+  * @file    log_sd.h
+  * @brief   SD卡日志输出头文件
+  *          作为原始数据输出接口注册到日志服务，日志行攒成整扇区后写入SD卡
+  * @note    日志文件用f_expand一次性预分配为连续簇，按扇区循环覆盖最旧的数据；
+  *          输出接口只复制到RAM扇区缓冲，写卡在主循环的log_sd_poll中进行，
+  *          不会在log_write中等待FatFs；主机端用Service/tools/log_sd2txt.py还原文本
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __LOG_SD_H__
+#define __LOG_SD_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sector_file.h"
+
+/* Configuration -------------------------------------------------------------*/
+
+/* 日志文件预分配大小（字节，须为512的整数倍）：写满后从头循环覆盖 */
+#ifndef LOG_SD_FILE_SIZE
+#define LOG_SD_FILE_SIZE            (1024UL * 1024UL)
+#endif
+
+/* RAM扇区缓冲个数（>= 2）：写卡期间新日志写入下一个缓冲，全部占满时丢弃新日志 */
+#ifndef LOG_SD_BUFFERS
+#define LOG_SD_BUFFERS              2
+#endif
+
+/* 最后一条日志后空闲多久写出未满的扇区（毫秒） */
+#ifndef LOG_SD_IDLE_FLUSH_MS
+#define LOG_SD_IDLE_FLUSH_MS        2000
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+#define LOG_SD_SECTOR_SIZE          SECTOR_FILE_SECTOR_SIZE
+#define LOG_SD_HDR_SIZE             20
+#define LOG_SD_PAYLOAD_SIZE         (LOG_SD_SECTOR_SIZE - LOG_SD_HDR_SIZE)
+#define LOG_SD_MAGIC                0x474F4C53U /**< "SLOG" */
+#define LOG_SD_VERSION              1
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief 扇区头（20字节，小端，布局与主机转换工具一致）
+ * @note  前16字节与sector_file_hdr_t一致（len即count）；crc32覆盖整个扇区，计算时crc32字段按0处理
+ */
+typedef struct {
+    uint32_t magic;                     /**< LOG_SD_MAGIC */
+    uint16_t version;                   /**< LOG_SD_VERSION */
+    uint16_t len;                       /**< 有效日志字节数 */
+    uint32_t log_id;                    /**< 日志文件标识（创建时生成，区分残留数据） */
+    uint32_t seq;                       /**< 扇区序号，自由递增；写入第seq % 容量个扇区 */
+    uint32_t crc32;                     /**< 扇区CRC32 */
+} log_sd_sector_hdr_t;
+
+/**
+ * @brief 扇区：日志字节流按序号顺序拼接，日志行可跨扇区
+ */
+typedef struct {
+    log_sd_sector_hdr_t hdr;
+    uint8_t             data[LOG_SD_PAYLOAD_SIZE];
+} log_sd_sector_t;
+
+/**
+ * @brief 写入统计（写扇区的次数与耗时见sf.writes，含未满扇区的重写）
+ */
+typedef struct {
+    uint32_t lines;                     /**< 写入缓冲的日志条数 */
+    uint32_t dropped;                   /**< 缓冲全满丢弃的日志条数 */
+} log_sd_stats_t;
+
+/**
+ * @brief SD卡日志
+ * @note  buffers为环形：fill为正在填充的缓冲计数，done为已写出的缓冲计数，
+ *        [done, fill)之间是写满待写出的缓冲，只由log_sd_poll读取
+ */
+typedef struct {
+    sector_file_t     sf;                       /**< 预分配扇区文件 */
+    log_sd_sector_t   buffers[LOG_SD_BUFFERS];  /**< 扇区缓冲 */
+    log_sd_sector_t   stage;                    /**< 未满扇区的写出副本（写卡期间缓冲仍可追加） */
+    uint32_t          next_seq;                 /**< 下一个缓冲的扇区序号 */
+    volatile uint32_t fill;                     /**< 正在填充的缓冲计数 */
+    volatile uint32_t done;                     /**< 已写出的缓冲计数 */
+    uint16_t          flushed_len;              /**< 正在填充的缓冲已写出的字节数 */
+    uint32_t          last_output_ms;           /**< 最后一次写入缓冲的时刻 */
+    bool              opened;                   /**< 已打开 */
+    log_sd_stats_t    stats;                    /**< 写入统计 */
+} log_sd_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief 打开（不存在时创建并预分配）日志文件，并注册为日志输出接口
+ * @param lsd 日志对象（同一时刻只能打开一个）
+ * @param path 文件路径
+ * @return FR_OK成功；卡上没有足够的连续空间时返回FR_DENIED；
+ *         日志输出句柄已满时返回FR_TOO_MANY_OPEN_FILES
+ * @note  已有日志按扇区CRC二分查找最后写入的扇区，从其下一个扇区继续
+ */
+FRESULT log_sd_open(log_sd_t *lsd, const char *path);
+
+/**
+ * @brief 后台处理，在主循环中周期调用
+ * @param lsd 日志对象
+ * @return FR_OK成功，其余为FatFs错误码
+ * @note  写出所有写满的缓冲；距最后一条日志超过LOG_SD_IDLE_FLUSH_MS时写出未满的缓冲
+ */
+FRESULT log_sd_poll(log_sd_t *lsd);
+
+/**
+ * @brief 立即写出缓冲中的全部日志
+ * @param lsd 日志对象
+ * @return FR_OK成功，其余为FatFs错误码
+ */
+FRESULT log_sd_flush(log_sd_t *lsd);
+
+/**
+ * @brief 注销输出接口，写出剩余日志并关闭文件
+ * @param lsd 日志对象
+ * @return FR_OK成功，其余为FatFs错误码
+ */
+FRESULT log_sd_close(log_sd_t *lsd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOG_SD_H__ */
@@ -16,13 +16,15 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "log.h"
+#include "log_uart_adapter.h"
 #include "main.h"
 #include "stm32g4xx_ll_usart.h"
+#include "stm32g4xx_ll_dma.h"
 #include <stdio.h>
 #include <stdarg.h>
 
 /* USER CODE BEGIN Includes */
-
+#include <string.h>
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -32,6 +34,13 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define LOG_UART_DMA_CHANNEL    LL_DMA_CHANNEL_5
+#define LOG_UART_DMA_IRQn       DMA1_Channel5_IRQn
+#define LOG_UART_RING_MASK      (LOG_UART_DMA_RING_SIZE - 1U)
+
+#if (LOG_UART_DMA_RING_SIZE & LOG_UART_RING_MASK) != 0
+#error "LOG_UART_DMA_RING_SIZE must be a power of 2"
+#endif
 
 /* USER CODE END PD */
 
@@ -45,6 +54,18 @@ static log_output_handle_t s_uart_log_handle;
 
 /* USER CODE BEGIN PV */
 
+/**
+ * @brief DMA发送环形缓冲区
+ * @note  head只由生产者（log.c中持有输出权的一方）推进，tail与in_flight只由DMA中断修改；
+ *        两者都是自由递增的计数，差值即占用字节数，不需要锁。
+ *        DMA只在中断中启动：生产者发现DMA空闲时挂起DMA中断来触发发送
+ */
+static uint8_t s_tx_ring[LOG_UART_DMA_RING_SIZE];
+static volatile uint32_t s_tx_head = 0;         /**< 写入位置（生产者） */
+static volatile uint32_t s_tx_tail = 0;         /**< 发送位置（中断） */
+static volatile uint32_t s_tx_in_flight = 0;    /**< 正在发送的字节数，0表示DMA空闲（中断） */
+static log_uart_dma_stats_t s_tx_stats;
+
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -52,6 +73,8 @@ static int log_uart_output_raw(const uint8_t *data, uint32_t len);
 static int log_uart_output_printf(const char *format, va_list args);
 
 /* USER CODE BEGIN PFP */
+static int log_uart_output_dma(const uint8_t *data, uint32_t len);
+static void log_uart_dma_start(void);
 
 /* USER CODE END PFP */
 
@@ -184,5 +207,196 @@ static int log_uart_output_printf(const char *format, va_list args)
 
 /* USER CODE BEGIN 1 */
 
+/**
+ * @brief 初始化UART日志输出适配器（DMA异步发送方式）
+ */
+int log_uart_adapter_init_dma(void)
+{
+    s_tx_head = 0;
+    s_tx_tail = 0;
+    s_tx_in_flight = 0;
+    memset(&s_tx_stats, 0, sizeof(s_tx_stats));
+
+    // DMA1通道5：内存到USART1->TDR，字节传输，普通模式
+    LL_DMA_DisableChannel(DMA1, LOG_UART_DMA_CHANNEL);
+    LL_DMA_SetPeriphRequest(DMA1, LOG_UART_DMA_CHANNEL, LL_DMAMUX_REQ_USART1_TX);
+    LL_DMA_SetDataTransferDirection(DMA1, LOG_UART_DMA_CHANNEL, LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    LL_DMA_SetChannelPriorityLevel(DMA1, LOG_UART_DMA_CHANNEL, LL_DMA_PRIORITY_LOW);
+    LL_DMA_SetMode(DMA1, LOG_UART_DMA_CHANNEL, LL_DMA_MODE_NORMAL);
+    LL_DMA_SetPeriphIncMode(DMA1, LOG_UART_DMA_CHANNEL, LL_DMA_PERIPH_NOINCREMENT);
+    LL_DMA_SetMemoryIncMode(DMA1, LOG_UART_DMA_CHANNEL, LL_DMA_MEMORY_INCREMENT);
+    LL_DMA_SetPeriphSize(DMA1, LOG_UART_DMA_CHANNEL, LL_DMA_PDATAALIGN_BYTE);
+    LL_DMA_SetMemorySize(DMA1, LOG_UART_DMA_CHANNEL, LL_DMA_MDATAALIGN_BYTE);
+    LL_DMA_SetPeriphAddress(DMA1, LOG_UART_DMA_CHANNEL,
+                            LL_USART_DMA_GetRegAddr(USART1, LL_USART_DMA_REG_DATA_TRANSMIT));
+    LL_DMA_ClearFlag_TC5(DMA1);
+    LL_DMA_ClearFlag_TE5(DMA1);
+    LL_DMA_EnableIT_TC(DMA1, LOG_UART_DMA_CHANNEL);
+    LL_DMA_EnableIT_TE(DMA1, LOG_UART_DMA_CHANNEL);
+
+    // 最低优先级：日志发送不抢占SPI/UART烧录相关中断
+    NVIC_SetPriority(LOG_UART_DMA_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), 3, 0));
+    NVIC_EnableIRQ(LOG_UART_DMA_IRQn);
+
+    LL_USART_EnableDMAReq_TX(USART1);
+
+    s_uart_log_handle.output_type = LOG_OUTPUT_TYPE_RAW;
+    s_uart_log_handle.output_func.raw_func = log_uart_output_dma;
+    s_uart_log_handle.user_data = NULL;
+
+    return log_register_output(&s_uart_log_handle);
+}
+
+/**
+ * @brief 等待DMA发送完缓冲区中的日志
+ */
+int log_uart_adapter_flush(uint32_t timeout_ms)
+{
+    uint32_t start = HAL_GetTick();
+
+    while (s_tx_tail != s_tx_head || s_tx_in_flight != 0)
+    {
+        if (HAL_GetTick() - start >= timeout_ms)
+        {
+            return -1;
+        }
+    }
+
+    // 等待最后一个字节移出移位寄存器
+    while (!LL_USART_IsActiveFlag_TC(USART1))
+    {
+        if (HAL_GetTick() - start >= timeout_ms)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief 读取DMA发送统计
+ */
+void log_uart_adapter_get_stats(log_uart_dma_stats_t *stats)
+{
+    if (stats != NULL)
+    {
+        *stats = s_tx_stats;
+    }
+}
+
+/**
+ * @brief USART1 TX DMA中断处理
+ * @note  传输完成时释放已发送的数据，再发送缓冲区中剩余的数据；
+ *        生产者挂起本中断时没有标志置位，直接尝试启动发送
+ */
+void log_uart_adapter_dma_irq_handler(void)
+{
+    if (LL_DMA_IsActiveFlag_TC5(DMA1))
+    {
+        LL_DMA_ClearFlag_TC5(DMA1);
+        s_tx_stats.sent_bytes += s_tx_in_flight;
+        s_tx_tail += s_tx_in_flight;
+        s_tx_in_flight = 0;
+    }
+
+    if (LL_DMA_IsActiveFlag_TE5(DMA1))
+    {
+        // 传输错误：丢弃这一段，继续发送后面的数据
+        LL_DMA_ClearFlag_TE5(DMA1);
+        s_tx_stats.dma_errors++;
+        s_tx_tail += s_tx_in_flight;
+        s_tx_in_flight = 0;
+    }
+
+    if (s_tx_in_flight == 0)
+    {
+        log_uart_dma_start();
+    }
+}
+
+/**
+ * @brief 启动下一段DMA发送（只在DMA中断中调用）
+ * @note  每次发送到缓冲区末尾为止，回绕部分在下一次传输完成中断中发送
+ */
+static void log_uart_dma_start(void)
+{
+    uint32_t tail = s_tx_tail;
+    uint32_t pending = s_tx_head - tail;
+    uint32_t index = tail & LOG_UART_RING_MASK;
+    uint32_t len;
+
+    if (pending == 0)
+    {
+        return;
+    }
+
+    len = LOG_UART_DMA_RING_SIZE - index;
+    if (len > pending)
+    {
+        len = pending;
+    }
+
+    s_tx_in_flight = len;
+
+    LL_DMA_DisableChannel(DMA1, LOG_UART_DMA_CHANNEL);
+    LL_DMA_SetMemoryAddress(DMA1, LOG_UART_DMA_CHANNEL, (uint32_t)&s_tx_ring[index]);
+    LL_DMA_SetDataLength(DMA1, LOG_UART_DMA_CHANNEL, len);
+    LL_DMA_EnableChannel(DMA1, LOG_UART_DMA_CHANNEL);
+}
+
+/**
+ * @brief UART DMA输出函数：复制到环形缓冲区后立即返回
+ * @param data 要输出的数据（已格式化的字符串）
+ * @param len 数据长度
+ * @return 成功返回0，缓冲区不足（整行丢弃）返回-2
+ */
+static int log_uart_output_dma(const uint8_t *data, uint32_t len)
+{
+    uint32_t head = s_tx_head;
+    uint32_t used = head - s_tx_tail;
+    uint32_t index = head & LOG_UART_RING_MASK;
+    uint32_t first;
+
+    if (data == NULL || len == 0)
+    {
+        return -1;
+    }
+
+    // 放不下整行时丢弃，避免输出半行
+    if (len > LOG_UART_DMA_RING_SIZE - used)
+    {
+        s_tx_stats.dropped_lines++;
+        s_tx_stats.dropped_bytes += len;
+        return -2;
+    }
+
+    first = LOG_UART_DMA_RING_SIZE - index;
+    if (first > len)
+    {
+        first = len;
+    }
+    memcpy(&s_tx_ring[index], data, first);
+    memcpy(&s_tx_ring[0], data + first, len - first);
+
+    // 数据写完后再发布head，中断看到的head之前的数据都已完整
+    __DMB();
+    s_tx_head = head + len;
+
+    used += len;
+    if (used > s_tx_stats.peak_used)
+    {
+        s_tx_stats.peak_used = used;
+    }
+
+    // DMA空闲时挂起DMA中断，由中断启动发送
+    if (s_tx_in_flight == 0)
+    {
+        NVIC_SetPendingIRQ(LOG_UART_DMA_IRQn);
+    }
+
+    return 0;
+}
+
 /* USER CODE END 1 */
 
@@ -24,17 +24,34 @@ extern "C" {
 #include "log.h"
 
 /* USER CODE BEGIN Includes */
+#include <stdint.h>
 
 /* USER CODE END Includes */
 
 /* Exported types ------------------------------------------------------------*/
 /* USER CODE BEGIN ET */
 
+/**
+ * @brief DMA发送统计
+ */
+typedef struct {
+    uint32_t sent_bytes;        /**< 已由DMA发出的字节数 */
+    uint32_t dropped_lines;     /**< 环形缓冲区满时丢弃的日志行数 */
+    uint32_t dropped_bytes;     /**< 丢弃的字节数 */
+    uint32_t peak_used;         /**< 环形缓冲区最高占用（字节） */
+    uint32_t dma_errors;        /**< DMA传输错误次数 */
+} log_uart_dma_stats_t;
+
 /* USER CODE END ET */
 
 /* Exported constants --------------------------------------------------------*/
 /* USER CODE BEGIN EC */
 
+/* DMA发送环形缓冲区大小（字节，须为2的幂） */
+#ifndef LOG_UART_DMA_RING_SIZE
+#define LOG_UART_DMA_RING_SIZE      1024
+#endif
+
 /* USER CODE END EC */
 
 /* Exported macro ------------------------------------------------------------*/
@@ -63,6 +80,34 @@ int log_uart_adapter_deinit(void);
 
 /* USER CODE BEGIN EFP */
 
+/**
+ * @brief 初始化UART日志输出适配器（DMA异步发送方式）
+ * @return 成功返回0，失败返回非0
+ * @note  日志行复制到环形缓冲区后立即返回，由USART1 TX DMA（DMA1通道5）在后台发出；
+ *        缓冲区放不下整行时丢弃该行并计数。须在MX_DMA_Init与MX_USART1_UART_Init之后调用；
+ *        环形缓冲区为单生产者：log.c只在持有输出权的一方调用输出接口，中断中的日志经日志队列转交
+ */
+int log_uart_adapter_init_dma(void);
+
+/**
+ * @brief 等待DMA发送完缓冲区中的日志
+ * @param timeout_ms 超时时间（毫秒）
+ * @return 发完返回0，超时返回非0
+ * @note  用于复位、进入低功耗或故障处理前
+ */
+int log_uart_adapter_flush(uint32_t timeout_ms);
+
+/**
+ * @brief 读取DMA发送统计
+ * @param stats 统计输出
+ */
+void log_uart_adapter_get_stats(log_uart_dma_stats_t *stats);
+
+/**
+ * @brief USART1 TX DMA中断处理（在DMA1_Channel5_IRQHandler中调用）
+ */
+void log_uart_adapter_dma_irq_handler(void);
+
 /* USER CODE END EFP */
 
 #ifdef __cplusplus
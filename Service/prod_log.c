@@ -0,0 +1,250 @@
+/**
+  ******************************************************************************
+  * @file    prod_log.c
+  * @brief   生产记录服务实现文件
+  *          每个烧录目标一条二进制记录，批量追加写入SD卡
+  * @note    每批一个扇区，文件创建、扇区CRC与读写由sector_file.c完成，
+  *          本文件只负责攒批、顺序追加和掉电后恢复写入位置
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "prod_log.h"
+#include "log.h"
+#include "main.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+typedef char prod_log_record_size_check[(sizeof(prod_log_record_t) == 32) ? 1 : -1];
+typedef char prod_log_batch_size_check[(sizeof(prod_log_batch_t) == PROD_LOG_SECTOR_SIZE) ? 1 : -1];
+typedef char prod_log_hdr_layout_check[(offsetof(prod_log_batch_hdr_t, count) == offsetof(sector_file_hdr_t, count) &&
+                                        offsetof(prod_log_batch_hdr_t, log_id) == offsetof(sector_file_hdr_t, log_id) &&
+                                        offsetof(prod_log_batch_hdr_t, batch_seq) == offsetof(sector_file_hdr_t, seq)) ? 1 : -1];
+
+#if (PROD_LOG_FLUSH_RECORDS < 1) || (PROD_LOG_FLUSH_RECORDS > PROD_LOG_RECORDS_PER_BATCH)
+#error "PROD_LOG_FLUSH_RECORDS must be 1 ~ PROD_LOG_RECORDS_PER_BATCH"
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+
+static const sector_file_format_t s_format = {
+    PROD_LOG_MAGIC, PROD_LOG_VERSION, PROD_LOG_RECORDS_PER_BATCH,
+    offsetof(prod_log_batch_hdr_t, crc32),
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 清空批次缓冲，准备接收下一批记录
+ */
+static void prod_log_reset_batch(prod_log_t *plog)
+{
+    memset(&plog->batch, 0, sizeof(plog->batch));
+    plog->batch.hdr.first_seq = plog->next_seq;
+    plog->flush_pending       = false;
+}
+
+/**
+ * @brief 读取批次并检查有效性
+ * @param check_id 是否要求log_id与当前日志一致
+ * @return true 批次有效且位于其序号对应的扇区
+ */
+static bool prod_log_load_batch(prod_log_t *plog, uint32_t index, bool check_id)
+{
+    return sector_file_read(&plog->sf, index, &plog->batch, check_id) &&
+           plog->batch.hdr.batch_seq == index;
+}
+
+/**
+ * @brief 恢复写入位置
+ * @note  批次按扇区顺序写入，有效批次构成前缀，二分查找最后一个有效批次；
+ *        掉电时写了一半的批次CRC不符，从该扇区起重新写
+ */
+static void prod_log_recover(prod_log_t *plog)
+{
+    uint32_t lo, hi, mid;
+
+    if (!prod_log_load_batch(plog, 0, false)) {
+        /* 首批无效：空日志或其他文件残留的数据，使用新标识 */
+        return;
+    }
+    plog->sf.log_id = plog->batch.hdr.log_id;
+
+    lo = 0;                 /* 已知有效 */
+    hi = plog->sf.capacity; /* 已知无效（文件末尾） */
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if (prod_log_load_batch(plog, mid, true)) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    (void)prod_log_load_batch(plog, lo, true);
+    plog->next_batch = lo + 1;
+    plog->next_seq   = plog->batch.hdr.first_seq + plog->batch.hdr.count;
+}
+
+/**
+ * @brief 将当前批次写入所在扇区
+ * @note  失败时批次保留在RAM中，下次写出时重试
+ */
+static FRESULT prod_log_write_batch(prod_log_t *plog)
+{
+    FRESULT res;
+
+    if (plog->next_batch >= plog->sf.capacity) {
+        return FR_DENIED;
+    }
+
+    plog->batch.hdr.batch_seq = plog->next_batch;
+    res = sector_file_write(&plog->sf, plog->next_batch, &plog->batch);
+    if (res != FR_OK) {
+        return res;
+    }
+
+    plog->next_batch++;
+    prod_log_reset_batch(plog);
+    return FR_OK;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief 打开（不存在时创建并预分配）生产记录日志
+ */
+FRESULT prod_log_open(prod_log_t *plog, const char *path)
+{
+    FRESULT res;
+    bool    created = false;
+
+    if (plog == NULL || path == NULL) {
+        return FR_INVALID_PARAMETER;
+    }
+
+    memset(plog, 0, sizeof(*plog));
+
+    res = sector_file_open(&plog->sf, path, PROD_LOG_FILE_SIZE, &s_format, &created);
+    if (res != FR_OK) {
+        return res;
+    }
+
+    if (!created) {
+        prod_log_recover(plog);
+    }
+    prod_log_reset_batch(plog);
+    plog->opened = true;
+
+    LOG_INFO("prodlog: %s, %lu record(s), %lu/%lu batches", path,
+             (unsigned long)plog->next_seq, (unsigned long)plog->next_batch,
+             (unsigned long)plog->sf.capacity);
+
+    return FR_OK;
+}
+
+/**
+ * @brief 追加一条记录
+ */
+FRESULT prod_log_append(prod_log_t *plog, const prod_log_record_t *rec)
+{
+    prod_log_record_t *dst;
+    uint32_t start = cycle_stats_start();
+    FRESULT  res;
+
+    if (plog == NULL || !plog->opened || rec == NULL) {
+        return FR_INVALID_PARAMETER;
+    }
+
+    /* 批次已满（prod_log_poll未及时调用或上次写卡失败）：只有这时才在追加中写卡 */
+    if (plog->batch.hdr.count >= PROD_LOG_RECORDS_PER_BATCH) {
+        plog->stats.append_writes++;
+        res = prod_log_write_batch(plog);
+        if (res != FR_OK) {
+            return res;
+        }
+    }
+    if (plog->next_batch >= plog->sf.capacity) {
+        return FR_DENIED;
+    }
+
+    dst = &plog->batch.records[plog->batch.hdr.count++];
+    memcpy(dst, rec, sizeof(*dst));
+    dst->seq          = plog->next_seq++;
+    dst->timestamp_ms = HAL_GetTick();
+
+    plog->last_append_ms = dst->timestamp_ms;
+
+    if (plog->batch.hdr.count >= PROD_LOG_FLUSH_RECORDS) {
+        plog->flush_pending = true;
+    }
+
+    cycle_stats_add(&plog->stats.append, start);
+    return FR_OK;
+}
+
+/**
+ * @brief 空闲处理
+ */
+FRESULT prod_log_poll(prod_log_t *plog)
+{
+    if (plog == NULL || !plog->opened || plog->batch.hdr.count == 0) {
+        return FR_OK;
+    }
+    if (!plog->flush_pending &&
+        HAL_GetTick() - plog->last_append_ms < PROD_LOG_IDLE_FLUSH_MS) {
+        return FR_OK;
+    }
+
+    return prod_log_write_batch(plog);
+}
+
+/**
+ * @brief 立即写出当前批次
+ */
+FRESULT prod_log_flush(prod_log_t *plog)
+{
+    if (plog == NULL || !plog->opened) {
+        return FR_INVALID_PARAMETER;
+    }
+    if (plog->batch.hdr.count == 0) {
+        return FR_OK;
+    }
+
+    return prod_log_write_batch(plog);
+}
+
+/**
+ * @brief 写出剩余记录并关闭日志
+ */
+FRESULT prod_log_close(prod_log_t *plog)
+{
+    FRESULT res;
+    FRESULT res_close;
+
+    if (plog == NULL || !plog->opened) {
+        return FR_INVALID_PARAMETER;
+    }
+
+    res = prod_log_flush(plog);
+
+    if (plog->sf.writes.count) {
+        LOG_DEBUG("prodlog: %lu record(s) in %lu batch(es), avg %lu us, max %lu us",
+                  (unsigned long)plog->stats.append.count,
+                  (unsigned long)plog->sf.writes.count,
+                  (unsigned long)cycle_stats_avg_us(&plog->sf.writes),
+                  (unsigned long)cycle_stats_max_us(&plog->sf.writes));
+        LOG_DEBUG("prodlog: append max %lu us, %lu synchronous write(s)",
+                  (unsigned long)cycle_stats_max_us(&plog->stats.append),
+                  (unsigned long)plog->stats.append_writes);
+    }
+
+    plog->opened = false;
+    res_close = sector_file_close(&plog->sf);
+
+    return (res != FR_OK) ? res : res_close;
+}
@@ -0,0 +1,163 @@
+/**
+  ******************************************************************************
+  * @file    prod_log.h
+  * @brief   生产记录服务头文件
+  *          每个烧录目标一条二进制记录，批量追加写入SD卡
+  * @note    日志文件用f_expand一次性预分配为连续簇，记录在RAM中攒批，
+  *          每批占一个扇区并带CRC32，掉电后按批次CRC恢复写入位置；
+  *          主机端用Service/tools/prod_log2csv.py转换为CSV
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __PROD_LOG_H__
+#define __PROD_LOG_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sector_file.h"
+
+/* Configuration -------------------------------------------------------------*/
+
+/* 日志文件预分配大小（字节，须为512的整数倍）：1MB约3万条记录 */
+#ifndef PROD_LOG_FILE_SIZE
+#define PROD_LOG_FILE_SIZE          (1024UL * 1024UL)
+#endif
+
+/* 攒够多少条记录由prod_log_poll写一次卡（1 ~ PROD_LOG_RECORDS_PER_BATCH） */
+#ifndef PROD_LOG_FLUSH_RECORDS
+#define PROD_LOG_FLUSH_RECORDS      PROD_LOG_RECORDS_PER_BATCH
+#endif
+
+/* 最后一条记录后空闲多久写出未满的批次（毫秒） */
+#ifndef PROD_LOG_IDLE_FLUSH_MS
+#define PROD_LOG_IDLE_FLUSH_MS      2000
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+#define PROD_LOG_SECTOR_SIZE        SECTOR_FILE_SECTOR_SIZE
+#define PROD_LOG_RECORDS_PER_BATCH  15          /**< 32字节批次头 + 15 x 32字节记录 */
+#define PROD_LOG_MAGIC              0x474F4C50U /**< "PLOG" */
+#define PROD_LOG_VERSION            1
+#define PROD_LOG_UID_SIZE           7           /**< 与STC_UID_SIZE一致 */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief 生产记录（32字节，小端，布局与主机转换工具一致）
+ * @note  seq与timestamp_ms由prod_log_append()填写；耗时超过65535ms时按65535填写
+ */
+typedef struct {
+    uint32_t seq;                       /**< 记录序号（从0递增） */
+    uint32_t timestamp_ms;              /**< 记录时刻（HAL_GetTick） */
+    uint32_t image_crc32;               /**< 固件镜像CRC32 */
+    uint8_t  uid[PROD_LOG_UID_SIZE];    /**< 目标芯片UID */
+    int8_t   result;                    /**< 烧录结果（STC_OK / STC_ERR_*） */
+    uint16_t magic;                     /**< 目标型号Magic */
+    uint16_t handshake_ms;              /**< 握手耗时 */
+    uint16_t erase_ms;                  /**< 擦除耗时 */
+    uint16_t program_ms;                /**< 编程耗时 */
+    uint16_t options_ms;                /**< 写选项耗时 */
+    uint16_t total_ms;                  /**< 总耗时 */
+} prod_log_record_t;
+
+/**
+ * @brief 批次头（32字节）
+ * @note  前16字节与sector_file_hdr_t一致（batch_seq即seq）；crc32覆盖整个扇区，计算时crc32字段按0处理
+ */
+typedef struct {
+    uint32_t magic;                     /**< PROD_LOG_MAGIC */
+    uint16_t version;                   /**< PROD_LOG_VERSION */
+    uint16_t count;                     /**< 本批记录条数 */
+    uint32_t log_id;                    /**< 日志文件标识（创建时生成，区分残留数据） */
+    uint32_t batch_seq;                 /**< 批次序号，等于所在扇区序号 */
+    uint32_t first_seq;                 /**< 本批第一条记录序号 */
+    uint32_t reserved[2];
+    uint32_t crc32;                     /**< 扇区CRC32 */
+} prod_log_batch_hdr_t;
+
+/**
+ * @brief 批次（一个扇区）
+ */
+typedef struct {
+    prod_log_batch_hdr_t hdr;
+    prod_log_record_t    records[PROD_LOG_RECORDS_PER_BATCH];
+} prod_log_batch_t;
+
+/**
+ * @brief 写入统计（写批次的次数与耗时见sf.writes）
+ */
+typedef struct {
+    cycle_stats_t append;               /**< 本次打开后的追加次数与耗时 */
+    uint32_t      append_writes;        /**< 批次已满、在追加中同步写卡的次数 */
+} prod_log_stats_t;
+
+/**
+ * @brief 生产记录日志
+ */
+typedef struct {
+    sector_file_t    sf;                        /**< 预分配扇区文件（每扇区一个批次） */
+    prod_log_batch_t batch;                     /**< 当前批次缓冲 */
+    uint32_t         next_batch;                /**< 下一批次的扇区序号 */
+    uint32_t         next_seq;                  /**< 下一条记录序号 */
+    uint32_t         last_append_ms;            /**< 最后一次追加的时刻 */
+    bool             flush_pending;             /**< 已攒够PROD_LOG_FLUSH_RECORDS条，等待prod_log_poll写出 */
+    bool             opened;                    /**< 已打开 */
+    prod_log_stats_t stats;                     /**< 写入统计 */
+} prod_log_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief 打开（不存在时创建并预分配）生产记录日志
+ * @param plog 日志对象
+ * @param path 文件路径
+ * @return FR_OK成功；卡上没有足够的连续空间时返回FR_DENIED
+ * @note  已有日志按批次CRC二分查找最后一个有效批次，从其后继续追加
+ */
+FRESULT prod_log_open(prod_log_t *plog, const char *path);
+
+/**
+ * @brief 追加一条记录
+ * @param plog 日志对象
+ * @param rec 记录（seq与timestamp_ms由本函数填写）
+ * @return FR_OK成功；日志已满返回FR_DENIED
+ * @note  只复制到RAM批次，攒够PROD_LOG_FLUSH_RECORDS条时标记待写，由prod_log_poll写卡；
+ *        只有批次已满（prod_log_poll没来得及写出）时才在本函数中同步写一个扇区
+ */
+FRESULT prod_log_append(prod_log_t *plog, const prod_log_record_t *rec);
+
+/**
+ * @brief 空闲处理，在主循环中周期调用
+ * @param plog 日志对象
+ * @return FR_OK成功，其余为FatFs错误码
+ * @note  有待写批次时立即写出；否则距最后一条记录超过PROD_LOG_IDLE_FLUSH_MS时写出未满的批次
+ */
+FRESULT prod_log_poll(prod_log_t *plog);
+
+/**
+ * @brief 立即写出当前批次
+ * @param plog 日志对象
+ * @return FR_OK成功，其余为FatFs错误码
+ */
+FRESULT prod_log_flush(prod_log_t *plog);
+
+/**
+ * @brief 写出剩余记录并关闭日志
+ * @param plog 日志对象
+ * @return FR_OK成功，其余为FatFs错误码
+ */
+FRESULT prod_log_close(prod_log_t *plog);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PROD_LOG_H__ */
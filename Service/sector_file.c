@@ -0,0 +1,177 @@
+/**
+  ******************************************************************************
+  * @file    sector_file.c
+  * @brief   预分配扇区文件实现文件
+  * @note    整扇区对齐写入时FatFs直接写卡，不经过文件缓冲；
+  *          文件大小在创建时已确定，写扇区后不需要f_sync更新目录项
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sector_file.h"
+#include "crc.h"
+#include "log.h"
+#include "main.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+typedef char sector_file_hdr_size_check[(sizeof(sector_file_hdr_t) == 16) ? 1 : -1];
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 生成文件标识
+ * @note  混合芯片UID、系统节拍和周期计数，同一张卡上重建的文件标识不同
+ */
+static uint32_t sector_file_new_id(void)
+{
+    uint32_t seed[5];
+
+    seed[0] = HAL_GetTick();
+    seed[1] = DWT->CYCCNT;
+    memcpy(&seed[2], (const void *)UID_BASE, 12);
+
+    return crc_crc32(0, (const uint8_t *)seed, sizeof(seed));
+}
+
+/**
+ * @brief 定位到扇区
+ */
+static FRESULT sector_file_seek(sector_file_t *sf, uint32_t index)
+{
+    FSIZE_t ofs = (FSIZE_t)index * SECTOR_FILE_SECTOR_SIZE;
+
+    if (f_tell(&sf->file) == ofs) {
+        return FR_OK;
+    }
+    return f_lseek(&sf->file, ofs);
+}
+
+/**
+ * @brief 计算扇区CRC32（crc32字段按0处理，返回时该字段为0）
+ */
+static uint32_t sector_file_crc(const sector_file_t *sf, void *sector)
+{
+    memset((uint8_t *)sector + sf->format->crc_offset, 0, sizeof(uint32_t));
+    return crc_crc32(0, (const uint8_t *)sector, SECTOR_FILE_SECTOR_SIZE);
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief 打开（不存在时创建并预分配）扇区文件
+ */
+FRESULT sector_file_open(sector_file_t *sf, const char *path, FSIZE_t size,
+                         const sector_file_format_t *format, bool *created)
+{
+    FRESULT res;
+
+    if (sf == NULL || path == NULL || format == NULL || created == NULL) {
+        return FR_INVALID_PARAMETER;
+    }
+
+    memset(sf, 0, sizeof(*sf));
+    sf->format = format;
+    *created   = false;
+
+    res = f_open(&sf->file, path, FA_OPEN_ALWAYS | FA_READ | FA_WRITE);
+    if (res != FR_OK) {
+        return res;
+    }
+
+    /* 新文件：一次性分配连续簇并写入FAT和目录项，之后写扇区不再改动元数据 */
+    if (f_size(&sf->file) == 0) {
+        res = f_expand(&sf->file, size, 1);
+        if (res == FR_OK) {
+            res = f_sync(&sf->file);
+        }
+        if (res != FR_OK) {
+            LOG_WARN("sector file: %s preallocation failed (%d)", path, (int)res);
+            f_close(&sf->file);
+            return res;
+        }
+        *created = true;
+    }
+
+    sf->capacity = (uint32_t)(f_size(&sf->file) / SECTOR_FILE_SECTOR_SIZE);
+    if (sf->capacity == 0) {
+        f_close(&sf->file);
+        return FR_DENIED;
+    }
+
+    /* 连续文件的CLMT只需一个片段，扇区定位不再遍历FAT链 */
+    sf->clmt[0]    = SECTOR_FILE_CLMT_SIZE;
+    sf->file.cltbl = sf->clmt;
+    if (f_lseek(&sf->file, CREATE_LINKMAP) != FR_OK) {
+        sf->file.cltbl = NULL;
+    }
+
+    sf->log_id = sector_file_new_id();
+    return FR_OK;
+}
+
+/**
+ * @brief 读取扇区并检查有效性
+ */
+bool sector_file_read(sector_file_t *sf, uint32_t index, void *sector, bool check_id)
+{
+    sector_file_hdr_t *hdr = (sector_file_hdr_t *)sector;
+    uint32_t crc;
+    UINT     br;
+
+    if (sector_file_seek(sf, index) != FR_OK ||
+        f_read(&sf->file, sector, SECTOR_FILE_SECTOR_SIZE, &br) != FR_OK ||
+        br != SECTOR_FILE_SECTOR_SIZE) {
+        return false;
+    }
+
+    if (hdr->magic != sf->format->magic || hdr->version != sf->format->version ||
+        hdr->count == 0 || hdr->count > sf->format->max_count ||
+        (check_id && hdr->log_id != sf->log_id)) {
+        return false;
+    }
+
+    memcpy(&crc, (const uint8_t *)sector + sf->format->crc_offset, sizeof(crc));
+    return sector_file_crc(sf, sector) == crc;
+}
+
+/**
+ * @brief 填写魔数、版本、log_id与CRC后写入扇区
+ */
+FRESULT sector_file_write(sector_file_t *sf, uint32_t index, void *sector)
+{
+    sector_file_hdr_t *hdr = (sector_file_hdr_t *)sector;
+    uint32_t start = cycle_stats_start();
+    uint32_t crc;
+    FRESULT  res;
+    UINT     bw;
+
+    hdr->magic   = sf->format->magic;
+    hdr->version = sf->format->version;
+    hdr->log_id  = sf->log_id;
+    crc = sector_file_crc(sf, sector);
+    memcpy((uint8_t *)sector + sf->format->crc_offset, &crc, sizeof(crc));
+
+    res = sector_file_seek(sf, index);
+    if (res == FR_OK) {
+        res = f_write(&sf->file, sector, SECTOR_FILE_SECTOR_SIZE, &bw);
+    }
+    if (res == FR_OK && bw != SECTOR_FILE_SECTOR_SIZE) {
+        res = FR_DENIED;
+    }
+    if (res == FR_OK) {
+        cycle_stats_add(&sf->writes, start);
+    }
+    return res;
+}
+
+/**
+ * @brief 关闭扇区文件
+ */
+FRESULT sector_file_close(sector_file_t *sf)
+{
+    return f_close(&sf->file);
+}
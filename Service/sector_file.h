@@ -0,0 +1,116 @@
+/**
+  ******************************************************************************
+  * @file    sector_file.h
+  * @brief   预分配扇区文件头文件
+  *          log_sd与prod_log共用：创建时一次性预分配连续簇，按整扇区读写，每扇区带CRC32
+  * @note    扇区以sector_file_hdr_t开头（各模块的扇区头在其后追加字段），
+  *          crc32字段的位置由模块的sector_file_format_t指定，计算时该字段按0处理；
+  *          本模块只负责文件与扇区校验，循环覆盖/顺序追加与写入位置恢复由各模块实现
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __SECTOR_FILE_H__
+#define __SECTOR_FILE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "../FatFS/src/ff.h"
+#include "cycle_stats.h"
+
+/* Configuration -------------------------------------------------------------*/
+
+/* 快速定位表长度（DWORD个数）：预分配文件为连续簇，4个即可 */
+#ifndef SECTOR_FILE_CLMT_SIZE
+#define SECTOR_FILE_CLMT_SIZE       4
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+#define SECTOR_FILE_SECTOR_SIZE     512
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief 扇区头的公共部分（16字节，小端）
+ */
+typedef struct {
+    uint32_t magic;                     /**< 格式魔数 */
+    uint16_t version;                   /**< 格式版本 */
+    uint16_t count;                     /**< 有效数据量（字节数或记录数，由模块定义），0为无效 */
+    uint32_t log_id;                    /**< 文件标识（创建时生成，区分残留数据） */
+    uint32_t seq;                       /**< 扇区序号（由模块定义与扇区位置的关系） */
+} sector_file_hdr_t;
+
+/**
+ * @brief 扇区格式
+ */
+typedef struct {
+    uint32_t magic;                     /**< 格式魔数 */
+    uint16_t version;                   /**< 格式版本 */
+    uint16_t max_count;                 /**< count的上限 */
+    uint16_t crc_offset;                /**< 扇区头中crc32字段的字节偏移 */
+} sector_file_format_t;
+
+/**
+ * @brief 预分配扇区文件
+ */
+typedef struct {
+    FIL                         file;                           /**< FatFs文件对象 */
+    DWORD                       clmt[SECTOR_FILE_CLMT_SIZE];    /**< 快速定位表 */
+    const sector_file_format_t *format;                         /**< 扇区格式 */
+    uint32_t                    log_id;                         /**< 文件标识 */
+    uint32_t                    capacity;                       /**< 文件扇区数 */
+    cycle_stats_t               writes;                         /**< 写扇区耗时 */
+} sector_file_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief 打开（不存在时创建并预分配）扇区文件
+ * @param sf 文件对象
+ * @param path 文件路径
+ * @param size 新建时的预分配大小（字节，须为512的整数倍）
+ * @param format 扇区格式（须保持有效）
+ * @param created 输出：是否为新建的文件
+ * @return FR_OK成功；卡上没有足够的连续空间时返回FR_DENIED
+ * @note  log_id取新生成的标识；打开已有文件时由模块恢复写入位置后改为文件中的标识
+ */
+FRESULT sector_file_open(sector_file_t *sf, const char *path, FSIZE_t size,
+                         const sector_file_format_t *format, bool *created);
+
+/**
+ * @brief 读取扇区并检查有效性
+ * @param sf 文件对象
+ * @param index 扇区位置（0 ~ capacity-1）
+ * @param sector 读取缓冲（SECTOR_FILE_SECTOR_SIZE字节）
+ * @param check_id 是否要求log_id与sf->log_id一致
+ * @return true 魔数、版本、count与CRC均有效；扇区序号由调用者检查
+ */
+bool sector_file_read(sector_file_t *sf, uint32_t index, void *sector, bool check_id);
+
+/**
+ * @brief 填写魔数、版本、log_id与CRC后写入扇区
+ * @param sf 文件对象
+ * @param index 扇区位置（0 ~ capacity-1）
+ * @param sector 扇区（count与seq由调用者填写）
+ * @return FR_OK成功，其余为FatFs错误码
+ */
+FRESULT sector_file_write(sector_file_t *sf, uint32_t index, void *sector);
+
+/**
+ * @brief 关闭扇区文件
+ */
+FRESULT sector_file_close(sector_file_t *sf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SECTOR_FILE_H__ */
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+SD卡日志提取工具
+
+把脱机烧录器写在SD卡上的循环日志文件（Service/log_sd.c）还原为日志字节流：
+- 文件按512字节扇区划分：20字节扇区头 + 最多492字节日志
+- 扇区头带整扇区CRC32（计算时crc32字段按0处理），与zlib.crc32一致
+- 扇区序号seq自由递增，第i个扇区存放seq % 扇区数 == i的数据，写满后循环覆盖最旧的扇区
+- log_id取自首扇区（首扇区无效时取末扇区），其余log_id的扇区是残留数据，忽略
+
+有效扇区按seq排序后拼接即为原始输出；日志行可能跨扇区，最旧扇区开头可能是半行。
+以LOG_ENABLE_BINARY=1编译的固件写入的是二进制记录，可继续交给logbin.py解码：
+    python3 log_sd2txt.py SYSTEM.LOG -o capture.bin
+    python3 logbin.py decode logfmt.json capture.bin
+
+用法:
+    python3 log_sd2txt.py SYSTEM.LOG [-o 输出文件]
+
+扇区布局变更时须同步修改本脚本与log_sd.h中的结构体定义。
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+SECTOR_SIZE = 512
+MAGIC = 0x474F4C53  # "SLOG"
+VERSION = 1
+
+# 与log_sd_sector_hdr_t一致（小端）
+HDR = struct.Struct("<IHHIII")
+CRC_OFFSET = 16
+PAYLOAD_SIZE = SECTOR_SIZE - HDR.size
+
+
+def parse_sector(data, index, count):
+    """解析扇区，无效时返回None，否则返回(log_id, seq, 日志字节)"""
+    sector = data[index * SECTOR_SIZE:(index + 1) * SECTOR_SIZE]
+    magic, version, length, log_id, seq, crc = HDR.unpack_from(sector)
+
+    zeroed = sector[:CRC_OFFSET] + b"\0\0\0\0" + sector[CRC_OFFSET + 4:]
+    if (magic != MAGIC or version != VERSION or not 1 <= length <= PAYLOAD_SIZE or
+            seq % count != index or zlib.crc32(zeroed) != crc):
+        return None
+    return log_id, seq, sector[HDR.size:HDR.size + length]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="SD卡循环日志还原")
+    parser.add_argument("log", help="SD卡上的日志文件（如SYSTEM.LOG）")
+    parser.add_argument("-o", "--output", help="输出文件（默认标准输出）")
+    args = parser.parse_args()
+
+    with open(args.log, "rb") as f:
+        data = f.read()
+
+    count = len(data) // SECTOR_SIZE
+    if count == 0:
+        print("empty log", file=sys.stderr)
+        return 1
+
+    sectors = [parse_sector(data, i, count) for i in range(count)]
+    anchor = sectors[0] or sectors[-1]
+    if anchor is None:
+        print("no valid sector", file=sys.stderr)
+        return 1
+
+    log_id = anchor[0]
+    valid = sorted((s for s in sectors if s is not None and s[0] == log_id), key=lambda s: s[1])
+
+    out = open(args.output, "wb") if args.output else sys.stdout.buffer
+    gaps = 0
+    for n, (_, seq, payload) in enumerate(valid):
+        if n and seq != valid[n - 1][1] + 1:
+            gaps += 1
+            print("gap: sector seq %d -> %d" % (valid[n - 1][1], seq), file=sys.stderr)
+        out.write(payload)
+    if out is not sys.stdout.buffer:
+        out.close()
+
+    print("%d sector(s), seq %d ~ %d, %d byte(s), %d gap(s)" %
+          (len(valid), valid[0][1], valid[-1][1], sum(len(s[2]) for s in valid), gaps),
+          file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
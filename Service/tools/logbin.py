@@ -0,0 +1,287 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+二进制日志解码工具
+
+固件以LOG_ENABLE_BINARY=1编译时，LOG_DEBUG等宏只输出二进制记录（Service/log.c）：
+- 头字节：0xA0 | 参数个数<<2 | 级别（高3位固定为101，与ASCII文本区分）
+- 消息编号：16位小端，等于(格式串地址 - LOG_BIN_FMT_BASE) / 4
+- 距上一条记录的毫秒数、各参数：LEB128变长整数
+格式串在固件中以0x1E开头并4字节对齐，extract从AXF/ELF中找出全部格式串，
+同时收集Flash中的字符串，用于还原%s参数；指向RAM的字符串在记录时已丢失内容，解码为<ram 0x...>。
+
+用法:
+    python3 logbin.py extract HAL_06_LCD.axf -o logfmt.json     # 构建后执行（Keil: After Build）
+    python3 logbin.py decode logfmt.json capture.bin            # 解码串口抓取的数据
+    python3 logbin.py decode logfmt.json - < /dev/ttyUSB0       # 从标准输入实时解码
+
+数据流中的普通文本（log_write输出）原样透传。
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+FMT_BASE = 0x08000000
+SRAM_BASE = 0x20000000       # Cortex-M SRAM区起始，Flash位于FMT_BASE与此之间
+FMT_MARK = 0x1E
+RECORD_MARK = 0xA0
+LEVELS = ["[DEBUG]", "[INFO]", "[WARN]", "[ERROR]"]
+
+# printf转换说明：%[标志][宽度][.精度][长度]转换符
+CONV = re.compile(r"%([-+ #0]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z|j|t)?([diouxXcsp%])")
+
+
+def elf_sections(data):
+    """返回ELF中占用内存且有内容的节：[(地址, 字节)]"""
+    if data[:4] != b"\x7fELF":
+        raise ValueError("not an ELF/AXF file")
+    is64 = data[4] == 2
+    if data[5] != 1:
+        raise ValueError("big-endian ELF not supported")
+
+    if is64:
+        shoff, = struct.unpack_from("<Q", data, 0x28)
+        shentsize, shnum = struct.unpack_from("<HH", data, 0x3A)
+        sh = struct.Struct("<IIQQQQIIQQ")
+    else:
+        shoff, = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", data, 0x2E)
+        sh = struct.Struct("<IIIIIIIIII")
+
+    sections = []
+    for i in range(shnum):
+        _, sh_type, flags, addr, offset, size = sh.unpack_from(data, shoff + i * shentsize)[:6]
+        SHT_PROGBITS, SHF_ALLOC = 1, 0x2
+        if sh_type == SHT_PROGBITS and flags & SHF_ALLOC and size:
+            sections.append((addr, data[offset:offset + size]))
+    return sections
+
+
+def c_string(blob, start):
+    """从start处读取以NUL结尾的可打印字符串，不是字符串时返回None"""
+    end = blob.find(b"\0", start)
+    if end <= start:
+        return None
+    try:
+        text = blob[start:end].decode("utf-8")
+    except UnicodeDecodeError:
+        return None
+    if not all(c.isprintable() or c in "\t\r\n" for c in text):
+        return None
+    return text
+
+
+def extract(args):
+    with open(args.elf, "rb") as f:
+        sections = elf_sections(f.read())
+
+    formats = {}
+    strings = {}
+    for addr, blob in sections:
+        # 格式串：4字节对齐、0x1E开头
+        for ofs in range((-addr) % 4, len(blob), 4):
+            if blob[ofs] == FMT_MARK:
+                text = c_string(blob, ofs + 1)
+                if text is not None:
+                    formats[(addr + ofs - args.base) // 4] = text
+        # 其余字符串（%s参数）：至少2个字符
+        ofs = 0
+        while ofs < len(blob):
+            text = c_string(blob, ofs)
+            if text is not None and len(text) >= 2:
+                strings[addr + ofs] = text
+                ofs += len(text.encode("utf-8")) + 1
+            else:
+                ofs += 1
+
+    # Flash范围：FMT_BASE之后、SRAM区之前的节（.data等RAM节的地址不计入）
+    flash = [(addr, addr + len(blob)) for addr, blob in sections if args.base <= addr < SRAM_BASE]
+    table = {
+        "fmt_base": args.base,
+        "flash": [min(a for a, _ in flash), max(b for _, b in flash)] if flash else [args.base, SRAM_BASE],
+        "formats": {str(k): v for k, v in sorted(formats.items())},
+        "strings": {"0x%08X" % k: v for k, v in sorted(strings.items())},
+    }
+    out = open(args.output, "w", encoding="utf-8") if args.output else sys.stdout
+    json.dump(table, out, ensure_ascii=False, indent=1)
+    if out is not sys.stdout:
+        out.close()
+
+    print("%d format(s), %d string(s)" % (len(formats), len(strings)), file=sys.stderr)
+    return 0
+
+
+class Decoder:
+    """按记录格式解码字节流，ASCII文本原样透传"""
+
+    def __init__(self, table):
+        self.formats = {int(k): v for k, v in table["formats"].items()}
+        self.strings = {int(k, 16): v for k, v in table["strings"].items()}
+        self.string_addrs = sorted(self.strings)
+        base = table.get("fmt_base", FMT_BASE)
+        self.flash = table.get("flash", [base, SRAM_BASE])
+        self.tick = 0
+        self.text = bytearray()     # 未结束的文本行
+        self.records = 0
+        self.errors = 0
+
+    def lookup_string(self, addr):
+        if addr in self.strings:
+            return self.strings[addr]
+        # RAM中的字符串（路径、缓冲区等）只记录了地址，内容无法还原
+        if not self.flash[0] <= addr < self.flash[1]:
+            return "<ram 0x%08X>" % addr
+        # 指向字符串中间（如跳过前缀）
+        lo, hi = 0, len(self.string_addrs)
+        while lo < hi:
+            mid = (lo + hi) // 2
+            if self.string_addrs[mid] <= addr:
+                lo = mid + 1
+            else:
+                hi = mid
+        if lo:
+            start = self.string_addrs[lo - 1]
+            text = self.strings[start].encode("utf-8")
+            if addr - start < len(text):
+                return text[addr - start:].decode("utf-8", "replace")
+        return "<str@0x%08X>" % addr
+
+    def format(self, fmt, values):
+        values = list(values)
+
+        def conv(m):
+            flags, width, prec, _, kind = m.groups()
+            if kind == "%":
+                return "%"
+            value = values.pop(0) if values else 0
+            spec = "%" + flags + width + ("." + prec if prec else "")
+            if kind in "di":
+                return (spec + "d") % (value - (1 << 32) if value & 0x80000000 else value)
+            if kind == "c":
+                return (spec + "c") % chr(value & 0xFF)
+            if kind == "s":
+                return (spec + "s") % self.lookup_string(value)
+            if kind == "p":
+                return "0x%08X" % value
+            return (spec + kind) % value
+
+        return CONV.sub(conv, fmt)
+
+    @staticmethod
+    def varint(data, pos):
+        value = shift = 0
+        while True:
+            if pos >= len(data):
+                return None, pos
+            byte = data[pos]
+            pos += 1
+            value |= (byte & 0x7F) << shift
+            if byte < 0x80:
+                return value & 0xFFFFFFFF, pos
+            shift += 7
+            if shift > 28:
+                return None, pos
+
+    def record(self, data, pos):
+        """解码一条记录，数据不完整时返回(None, pos)"""
+        head = data[pos]
+        if pos + 3 > len(data):
+            return None, pos
+        msg_id = data[pos + 1] | data[pos + 2] << 8
+        delta, p = self.varint(data, pos + 3)
+        if delta is None:
+            return None, pos
+        values = []
+        for _ in range((head >> 2) & 0x07):
+            value, p = self.varint(data, p)
+            if value is None:
+                return None, pos
+            values.append(value)
+
+        self.tick += delta
+        self.records += 1
+        level = LEVELS[head & 0x03]
+        fmt = self.formats.get(msg_id)
+        if fmt is None:
+            self.errors += 1
+            text = "<unknown id %d> %s" % (msg_id, " ".join("0x%X" % v for v in values))
+        else:
+            text = self.format(fmt, values)
+        return "[%08lu] %s %s" % (self.tick, level, text), p
+
+    def feed(self, data, final=False):
+        """解码数据，返回(输出行, 未处理的剩余数据)"""
+        lines = []
+        text = self.text
+        pos = 0
+        while pos < len(data):
+            byte = data[pos]
+            if (byte & 0xE0) == RECORD_MARK:
+                line, nxt = self.record(data, pos)
+                if line is None:
+                    if not final:
+                        break
+                    self.errors += 1
+                    pos += 1
+                    continue
+                lines.append(line)
+                pos = nxt
+            elif byte < 0x80:
+                if byte == 0x0A:
+                    lines.append(text.decode("utf-8", "replace").rstrip("\r"))
+                    text.clear()
+                else:
+                    text.append(byte)
+                pos += 1
+            else:
+                self.errors += 1    # 失步：跳过直到下一个记录头或文本
+                pos += 1
+        if text and final:
+            lines.append(text.decode("utf-8", "replace"))
+            text.clear()
+        return lines, data[pos:]
+
+
+def decode(args):
+    with open(args.table, encoding="utf-8") as f:
+        decoder = Decoder(json.load(f))
+
+    src = sys.stdin.buffer if args.input == "-" else open(args.input, "rb")
+    pending = b""
+    while True:
+        chunk = src.read1(4096) if hasattr(src, "read1") else src.read(4096)
+        lines, pending = decoder.feed(pending + chunk, final=not chunk)
+        for line in lines:
+            print(line, flush=args.input == "-")
+        if not chunk:
+            break
+
+    print("%d record(s), %d error(s)" % (decoder.records, decoder.errors), file=sys.stderr)
+    return 1 if decoder.errors else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="二进制日志格式表提取与解码")
+    sub = parser.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("extract", help="从AXF/ELF提取格式表")
+    p.add_argument("elf", help="固件AXF/ELF文件")
+    p.add_argument("-o", "--output", help="输出JSON（默认标准输出）")
+    p.add_argument("--base", type=lambda s: int(s, 0), default=FMT_BASE,
+                   help="LOG_BIN_FMT_BASE（默认0x08000000）")
+    p.set_defaults(func=extract)
+
+    p = sub.add_parser("decode", help="解码二进制日志")
+    p.add_argument("table", help="extract生成的JSON格式表")
+    p.add_argument("input", help="抓取的数据文件，-为标准输入")
+    p.set_defaults(func=decode)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+生产记录日志转换工具
+
+把脱机烧录器写在SD卡上的二进制生产记录（Service/prod_log.c）转换为CSV：
+- 文件按512字节扇区划分，每个扇区是一个批次：32字节批次头 + 15条32字节记录
+- 批次头带整扇区CRC32（计算时crc32字段按0处理），与zlib.crc32一致
+- 批次序号必须等于扇区序号、log_id必须与第一个批次一致，
+  遇到第一个无效批次即停止（其后是预分配未写入的空间或掉电时写坏的批次）
+
+用法:
+    python3 prod_log2csv.py PROD.LOG [-o 输出.csv]
+
+记录布局变更时须同步修改本脚本与prod_log.h中的结构体定义。
+"""
+
+import argparse
+import csv
+import struct
+import sys
+import zlib
+
+SECTOR_SIZE = 512
+RECORDS_PER_BATCH = 15
+MAGIC = 0x474F4C50  # "PLOG"
+VERSION = 1
+
+# 与prod_log_batch_hdr_t / prod_log_record_t一致（小端）
+HDR = struct.Struct("<IHHIII8xI")
+RECORD = struct.Struct("<III7sbHHHHHH")
+CRC_OFFSET = 28
+
+FIELDS = [
+    "seq", "timestamp_ms", "uid", "magic", "result", "image_crc32",
+    "handshake_ms", "erase_ms", "program_ms", "options_ms", "total_ms",
+]
+
+
+def parse_batches(data):
+    """逐个返回有效批次的记录，遇到无效批次时停止"""
+    log_id = None
+
+    for index in range(len(data) // SECTOR_SIZE):
+        sector = data[index * SECTOR_SIZE:(index + 1) * SECTOR_SIZE]
+        magic, version, count, batch_log_id, batch_seq, first_seq, crc = HDR.unpack_from(sector)
+
+        zeroed = sector[:CRC_OFFSET] + b"\0\0\0\0" + sector[CRC_OFFSET + 4:]
+        if (magic != MAGIC or version != VERSION or batch_seq != index or
+                not 1 <= count <= RECORDS_PER_BATCH or
+                (log_id is not None and batch_log_id != log_id) or
+                zlib.crc32(zeroed) != crc):
+            return index
+        log_id = batch_log_id
+
+        for n in range(count):
+            yield RECORD.unpack_from(sector, HDR.size + n * RECORD.size)
+
+    return len(data) // SECTOR_SIZE
+
+
+def main():
+    parser = argparse.ArgumentParser(description="生产记录日志转换为CSV")
+    parser.add_argument("log", help="SD卡上的生产记录文件（如PROD.LOG）")
+    parser.add_argument("-o", "--output", help="输出CSV文件（默认标准输出）")
+    args = parser.parse_args()
+
+    with open(args.log, "rb") as f:
+        data = f.read()
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    writer = csv.writer(out)
+    writer.writerow(FIELDS)
+
+    records = 0
+    batches = parse_batches(data)
+    while True:
+        try:
+            seq, ts, crc32, uid, result, magic, hs, erase, prog, opts, total = next(batches)
+        except StopIteration as stop:
+            valid = stop.value
+            break
+        writer.writerow([seq, ts, uid.hex().upper(), "%04X" % magic, result, "%08X" % crc32,
+                         hs, erase, prog, opts, total])
+        records += 1
+
+    if out is not sys.stdout:
+        out.close()
+
+    print("%d record(s) in %d batch(es), %d batch(es) free" %
+          (records, valid, len(data) // SECTOR_SIZE - valid), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -10,6 +10,76 @@
 static  vu16 TextColor = 0x0000, BackColor = 0xFFFF;
 vu16 dummy;
 
+/* Text cell cache: what is currently shown in each 16x24 character cell */
+typedef struct
+{
+	u8  Ascii;      /* 0: unknown, cell must be redrawn */
+	u16 TextColor;
+	u16 BackColor;
+} LCD_TextCell;
+
+static LCD_TextCell TextCache[LCD_TEXT_LINES][LCD_TEXT_COLUMNS];
+
+/* Glyph blitter: 4 glyph bits -> 4 pixels, rebuilt when the colors change */
+static u16 GlyphLUT[16][4];
+static u16 GlyphLUTText, GlyphLUTBack;
+static u8  GlyphLUTValid = 0;
+
+/* Glyph blitter: the GRAM window is narrowed to the last glyph drawn */
+static u8  GlyphWindowActive = 0;
+static u8  GlyphWindowX;
+static u16 GlyphWindowY;
+
+/* Bus control lines: direct stores to the set/reset registers */
+#define LCD_CS_LOW()     (GPIOB->BRR  = GPIO_PIN_9)
+#define LCD_CS_HIGH()    (GPIOB->BSRR = GPIO_PIN_9)
+#define LCD_RS_LOW()     (GPIOB->BRR  = GPIO_PIN_8)
+#define LCD_RS_HIGH()    (GPIOB->BSRR = GPIO_PIN_8)
+
+/* WR strobe at 80 MHz (12.5 ns per cycle) against the ILI932x write timing:
+     WR low  >= 50 ns : BRR store + 4 NOP                  = 5 cycles, 62.5 ns
+     WR high >= 50 ns : BSRR store + 4 NOP before next BRR >= 5 cycles, 62.5 ns
+     cycle   >= 100 ns:                                    >= 10 cycles, 125 ns
+   The high-side padding is part of the macro so back-to-back strobes in
+   LCD_FillRAM keep the gap. A full-screen fill takes at least 76800 x 125 ns
+   = 9.6 ms. */
+#define LCD_WR_DELAY()   do { __nop(); __nop(); __nop(); __nop(); } while(0)
+#define LCD_WR_STROBE()  do { GPIOB->BRR = GPIO_PIN_5; LCD_WR_DELAY(); \
+                              GPIOB->BSRR = GPIO_PIN_5; LCD_WR_DELAY(); } while(0)
+
+#if LCD_USE_DMA
+/* DMA pixel streaming: TIM8 CH3N drives WR (PB5), CC4 paces DMA1 channel 4 */
+#define LCD_DMA_CHANNEL       DMA1_Channel4
+#define LCD_DMA_MUX_CHANNEL   DMAMUX1_Channel3    /* DMAMUX channel n-1 serves DMA1 channel n */
+#define LCD_DMA_REQUEST       52U                 /* TIM8_CH4 (LL_DMAMUX_REQ_TIM8_CH4) */
+#define LCD_DMA_WR_AF         3U                  /* PB5 AF3: TIM8_CH3N */
+#define LCD_DMA_SEGMENT_MAX   65535U              /* DMA CNDTR / TIM8 RCR limit */
+
+static volatile u8  DMABusy = 0;
+static const u16   *DMASource;
+static u32          DMARemaining;
+static u8           DMAIncrement;
+static u16          DMAFillColor;
+static LCD_DMA_Callback DMADone;
+
+static void LCD_DMA_StartSegment(void);
+static void LCD_WriteBMPDone(void);
+#endif
+
+#if LCD_BUS_STATS
+static LCD_BusStats BusStats;
+#define LCD_BUS_WRITE(n)   (BusStats.WriteCycles += (n))
+#define LCD_BUS_READ(n)    (BusStats.ReadCycles += (n))
+#else
+#define LCD_BUS_WRITE(n)   ((void)0)
+#define LCD_BUS_READ(n)    ((void)0)
+#endif
+
+static void LCD_DrawCharRaw(u8 Xpos, u16 Ypos, uc16 *c);
+static void LCD_SetGlyphWindow(u8 Xpos, u16 Ypos);
+static void LCD_RestoreGlyphWindow(void);
+static void LCD_TextCacheInvalidateArea(u16 X0, u16 X1, u16 Y0, u16 Y1);
+
 /*******************************************************************************
 * Function Name  : Delay_LCD
 * Description    : Inserts a delay time.
@@ -159,6 +229,9 @@ void LCD_Init(void)
 	}
 	dummy = LCD_ReadReg(0);	
 
+#if LCD_USE_DMA
+	LCD_DMA_Init();
+#endif
 }
 /*******************************************************************************
 * Function Name  : LCD_SetTextColor
@@ -195,24 +268,28 @@ void LCD_SetBackColor(vu16 Color)
 *******************************************************************************/
 void LCD_ClearLine(u8 Line)
 {
-	LCD_DisplayStringLine(Line, "                    ");
+	LCD_DisplayStringLine(Line, (u8 *)"                    ");
 }
 /*******************************************************************************
 * Function Name  : LCD_Clear
 * Description    : Clears the hole LCD.
+*                  With LCD_USE_DMA the fill runs in the background; the next
+*                  bus access waits for it.
 * Input          : Color: the color of the background.
 * Output         : None
 * Return         : None
 *******************************************************************************/
 void LCD_Clear(u16 Color)
 {
-	u32 index = 0;
+#if LCD_USE_DMA
+	LCD_DMA_Wait();
+	LCD_ClearAsync(Color, 0);
+#else
 	LCD_SetCursor(0x00, 0x0000); 
 	LCD_WriteRAM_Prepare(); /* Prepare to write GRAM */
-	for(index = 0; index < 76800; index++)
-	{
-		LCD_WriteRAM(Color);    
-	}
+	LCD_FillRAM(Color, 76800);
+	LCD_TextCacheInvalidate();
+#endif
 }
 /*******************************************************************************
 * Function Name  : LCD_SetCursor
@@ -224,6 +301,7 @@ void LCD_Clear(u16 Color)
 *******************************************************************************/
 void LCD_SetCursor(u8 Xpos, u16 Ypos)
 { 
+	LCD_RestoreGlyphWindow();
 	LCD_WriteReg(R32, Xpos);
 	LCD_WriteReg(R33, Ypos);
 }
@@ -239,10 +317,61 @@ void LCD_SetCursor(u8 Xpos, u16 Ypos)
 * Return         : None
 *******************************************************************************/
 void LCD_DrawChar(u8 Xpos, u16 Ypos, uc16 *c)
+{
+	LCD_DrawCharRaw(Xpos, Ypos, c);
+	LCD_TextCacheInvalidateArea(Xpos, Xpos + 23, (Ypos >= 15) ? (Ypos - 15) : 0, Ypos);
+}
+/*******************************************************************************
+* Function Name  : LCD_DrawCharRaw
+* Description    : Draws a character on LCD without touching the text cache.
+* Input          : - Xpos: the Line where to display the character shape.
+*                  - Ypos: start column address.
+*                  - c: pointer to the character data.
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_DrawCharRaw(u8 Xpos, u16 Ypos, uc16 *c)
 {
 	u32 index = 0, i = 0;
 	u8 Xaddress = 0;
-   
+	const u16 *run;
+	u16 row[16];
+
+	/* Glyph fully on screen: one window, one GRAM burst of 384 pixels */
+	if(Xpos <= 239 - 23 && Ypos >= 15 && Ypos <= 319)
+	{
+		if(!GlyphLUTValid || GlyphLUTText != TextColor || GlyphLUTBack != BackColor)
+		{
+			GlyphLUTText = TextColor;
+			GlyphLUTBack = BackColor;
+			for(index = 0; index < 16; index++)
+			{
+				for(i = 0; i < 4; i++)
+				{
+					GlyphLUT[index][i] = (index & (1 << i)) ? GlyphLUTText : GlyphLUTBack;
+				}
+			}
+			GlyphLUTValid = 1;
+		}
+
+		LCD_SetGlyphWindow(Xpos, Ypos);
+		LCD_WriteRAM_Prepare(); /* Prepare to write GRAM */
+		for(index = 0; index < 24; index++)
+		{
+			for(i = 0; i < 16; i += 4)
+			{
+				run = GlyphLUT[(c[index] >> i) & 0x0F];
+				row[i]     = run[0];
+				row[i + 1] = run[1];
+				row[i + 2] = run[2];
+				row[i + 3] = run[3];
+			}
+			LCD_WriteRAM_Burst(row, 16);
+		}
+		return;
+	}
+
+	/* Partly off screen: row by row */
 	Xaddress = Xpos;
 	LCD_SetCursor(Xaddress, Ypos);
   
@@ -265,6 +394,57 @@ void LCD_DrawChar(u8 Xpos, u16 Ypos, uc16 *c)
 	}
 }
 /*******************************************************************************
+* Function Name  : LCD_SetGlyphWindow
+* Description    : Narrows the GRAM window to one 16x24 character cell and
+*                  moves the cursor to its first pixel. With AM=1 the GRAM
+*                  address then walks the glyph rows in LCD_DrawChar order.
+*                  Only the registers that differ from the previous glyph
+*                  window are written.
+* Input          : - Xpos: the Line where to display the character shape.
+*                  - Ypos: start column address.
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_SetGlyphWindow(u8 Xpos, u16 Ypos)
+{
+	if(!GlyphWindowActive || GlyphWindowX != Xpos)
+	{
+		LCD_WriteReg(R80, Xpos);
+		LCD_WriteReg(R81, Xpos + 23);
+	}
+	if(!GlyphWindowActive || GlyphWindowY != Ypos)
+	{
+		LCD_WriteReg(R82, Ypos - 15);
+		LCD_WriteReg(R83, Ypos);
+	}
+	GlyphWindowActive = 1;
+	GlyphWindowX = Xpos;
+	GlyphWindowY = Ypos;
+
+	LCD_WriteReg(R32, Xpos);
+	LCD_WriteReg(R33, Ypos);
+}
+/*******************************************************************************
+* Function Name  : LCD_RestoreGlyphWindow
+* Description    : Restores the full-screen GRAM window if the glyph blitter
+*                  left it narrowed. Windows set by LCD_SetDisplayWindow are
+*                  left alone.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_RestoreGlyphWindow(void)
+{
+	if(GlyphWindowActive)
+	{
+		GlyphWindowActive = 0;
+		LCD_WriteReg(R80, 0);
+		LCD_WriteReg(R81, 239);
+		LCD_WriteReg(R82, 0);
+		LCD_WriteReg(R83, 319);
+	}
+}
+/*******************************************************************************
 * Function Name  : LCD_DisplayChar
 * Description    : Displays one character (16dots width, 24dots height).
 * Input          : - Line: the Line where to display the character shape .
@@ -274,11 +454,89 @@ void LCD_DrawChar(u8 Xpos, u16 Ypos, uc16 *c)
 *                  - Ascii: character ascii code, must be between 0x20 and 0x7E.
 * Output         : None
 * Return         : None
+* Note           : Characters on the Linex / 16-pixel column grid go through
+*                  the text cache and are skipped when the cell already shows
+*                  the same character in the same colors.
 *******************************************************************************/
 void LCD_DisplayChar(u8 Line, u16 Column, u8 Ascii)
 {
-	Ascii -= 32;
-	LCD_DrawChar(Line, Column, &ASCII_Table[Ascii * 24]);
+	LCD_TextCell *cell;
+	u16 row = Line / 24, col = (319 - Column) / 16;
+
+	if((Line % 24) != 0 || row >= LCD_TEXT_LINES ||
+	   Column > 319 || ((319 - Column) % 16) != 0 || col >= LCD_TEXT_COLUMNS)
+	{
+		LCD_DrawChar(Line, Column, &ASCII_Table[(Ascii - 32) * 24]);
+		return;
+	}
+
+	cell = &TextCache[row][col];
+	if(cell->Ascii == Ascii && cell->TextColor == TextColor && cell->BackColor == BackColor)
+	{
+		return;
+	}
+
+	LCD_DrawCharRaw(Line, Column, &ASCII_Table[(Ascii - 32) * 24]);
+	cell->Ascii     = Ascii;
+	cell->TextColor = TextColor;
+	cell->BackColor = BackColor;
+}
+/*******************************************************************************
+* Function Name  : LCD_TextCacheInvalidate
+* Description    : Forgets the content of all text cells, so that the next
+*                  LCD_DisplayStringLine / LCD_DisplayChar redraws them.
+*                  Call after drawing over text with code outside this driver.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_TextCacheInvalidate(void)
+{
+	u32 i;
+	LCD_TextCell *cell = &TextCache[0][0];
+
+	for(i = 0; i < LCD_TEXT_LINES * LCD_TEXT_COLUMNS; i++)
+	{
+		cell[i].Ascii = 0;
+	}
+}
+/*******************************************************************************
+* Function Name  : LCD_TextCacheInvalidateArea
+* Description    : Forgets the text cells overlapping a screen area.
+* Input          : - X0, X1: first and last line pixel (inclusive).
+*                  - Y0, Y1: first and last column pixel (inclusive).
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_TextCacheInvalidateArea(u16 X0, u16 X1, u16 Y0, u16 Y1)
+{
+	u16 row, col, row_end, col_first, col_last;
+
+	if(X0 >= LCD_TEXT_LINES * 24 || Y0 > 319)
+	{
+		return;
+	}
+	if(Y1 > 319)
+	{
+		Y1 = 319;
+	}
+
+	/* Cell (row, col) covers lines row*24..row*24+23, columns 304-16*col..319-16*col */
+	row_end   = (X1 / 24 < LCD_TEXT_LINES) ? (X1 / 24) : (LCD_TEXT_LINES - 1);
+	col_first = (319 - Y1) / 16;
+	col_last  = (319 - Y0) / 16;
+	if(col_last >= LCD_TEXT_COLUMNS)
+	{
+		col_last = LCD_TEXT_COLUMNS - 1;
+	}
+
+	for(row = X0 / 24; row <= row_end; row++)
+	{
+		for(col = col_first; col <= col_last; col++)
+		{
+			TextCache[row][col].Ascii = 0;
+		}
+	}
 }
 /*******************************************************************************
 * Function Name  : LCD_DisplayStringLine
@@ -295,7 +553,7 @@ void LCD_DisplayStringLine(u8 Line, u8 *ptr)
 	u32 i = 0;
 	u16 refcolumn = 319;//319;
 
-	while ((*ptr != 0) && (i < 20))	 //	20
+	while ((*ptr != 0) && (i < LCD_TEXT_COLUMNS))	 //	20
 	{
 		LCD_DisplayChar(Line, refcolumn, *ptr);
 		refcolumn -= 16;
@@ -315,6 +573,7 @@ void LCD_DisplayStringLine(u8 Line, u8 *ptr)
 *******************************************************************************/
 void LCD_SetDisplayWindow(u8 Xpos, u16 Ypos, u8 Height, u16 Width)
 {
+	GlyphWindowActive = 0;
 	if(Xpos >= Height)
 	{
 		LCD_WriteReg(R80, (Xpos - Height + 1));
@@ -364,14 +623,24 @@ void LCD_DrawLine(u8 Xpos, u16 Ypos, u16 Length, u8 Direction)
 {
 	u32 i = 0;
   
+	if(Length == 0)
+	{
+		return;
+	}
+	if(Direction == Horizontal)
+	{
+		LCD_TextCacheInvalidateArea(Xpos, Xpos, (Ypos >= Length - 1) ? (Ypos - Length + 1) : 0, Ypos);
+	}
+	else
+	{
+		LCD_TextCacheInvalidateArea(Xpos, Xpos + Length - 1, Ypos, Ypos);
+	}
+
 	LCD_SetCursor(Xpos, Ypos);
 	if(Direction == Horizontal)
 	{
 		LCD_WriteRAM_Prepare(); /* Prepare to write GRAM */
-		for(i = 0; i < Length; i++)
-		{
-			LCD_WriteRAM(TextColor);
-		}
+		LCD_FillRAM(TextColor, Length);
 	}
 	else
 	{
@@ -403,6 +672,42 @@ void LCD_DrawRect(u8 Xpos, u16 Ypos, u8 Height, u16 Width)
 	LCD_DrawLine(Xpos, (Ypos - Width + 1), Height, Vertical);
 }
 /*******************************************************************************
+* Function Name  : LCD_FillRect
+* Description    : Fills a rectangle with one color through a GRAM window.
+* Input          : - Xpos: specifies the X position (top row).
+*                  - Ypos: specifies the Y position (left column).
+*                  - Height: rectangle height.
+*                  - Width: rectangle width.
+*                  - Color: the fill color.
+* Output         : None
+* Return         : None
+* Note           : The window is left narrowed and restored lazily like the
+*                  glyph window, so a run of small fills costs no extra
+*                  register writes.
+*******************************************************************************/
+void LCD_FillRect(u8 Xpos, u16 Ypos, u8 Height, u16 Width, u16 Color)
+{
+	if(Height == 0 || Width == 0 || Xpos + Height > 240 || Ypos > 319 || Width > Ypos + 1)
+	{
+		return;
+	}
+	LCD_TextCacheInvalidateArea(Xpos, Xpos + Height - 1, Ypos - Width + 1, Ypos);
+
+	LCD_WriteReg(R80, Xpos);
+	LCD_WriteReg(R81, Xpos + Height - 1);
+	LCD_WriteReg(R82, Ypos - Width + 1);
+	LCD_WriteReg(R83, Ypos);
+	/* Restored by the next LCD_SetCursor, rewritten by the next glyph */
+	GlyphWindowActive = 1;
+	GlyphWindowX = 0xFF;
+	GlyphWindowY = 0xFFFF;
+
+	LCD_WriteReg(R32, Xpos);
+	LCD_WriteReg(R33, Ypos);
+	LCD_WriteRAM_Prepare(); /* Prepare to write GRAM */
+	LCD_FillRAM(Color, (u32)Height * Width);
+}
+/*******************************************************************************
 * Function Name  : LCD_DrawCircle
 * Description    : Displays a circle.
 * Input          : - Xpos: specifies the X position.
@@ -421,6 +726,9 @@ void LCD_DrawCircle(u8 Xpos, u16 Ypos, u16 Radius)
   	D = 3 - (Radius << 1);
   	CurX = 0;
   	CurY = Radius;
+
+	LCD_TextCacheInvalidateArea((Xpos >= Radius) ? (Xpos - Radius) : 0, Xpos + Radius,
+	                            (Ypos >= Radius) ? (Ypos - Radius) : 0, Ypos + Radius);
   
   	while (CurX <= CurY)
   	{
@@ -496,10 +804,14 @@ void LCD_DrawMonoPict(uc32 *Pict)
 			}
 		}
 	}
+	LCD_TextCacheInvalidate();
 }
 /*******************************************************************************
 * Function Name  : LCD_WriteBMP
 * Description    : Displays a bitmap picture loaded in the internal Flash.
+*                  With LCD_USE_DMA halfword-aligned pixel data is streamed in
+*                  the background and the scan direction is restored when the
+*                  transfer completes.
 * Input          : - BmpAddress: Bmp picture address in the internal Flash.
 * Output         : None
 * Return         : None
@@ -516,8 +828,17 @@ void LCD_WriteBMP(u32 BmpAddress)
 	size = (size - index)/2;
 	BmpAddress += index;
 
+	LCD_RestoreGlyphWindow();
 	LCD_WriteReg(R3, 0x1008);
 	LCD_WriteRAM_Prepare();
+	LCD_TextCacheInvalidate();
+#if LCD_USE_DMA
+	if((BmpAddress & 1) == 0 &&
+	   LCD_DMA_WriteRAM((const u16 *)BmpAddress, size, LCD_WriteBMPDone) == 0)
+	{
+		return;
+	}
+#endif
 	for(index = 0; index < size; index++)
 	{
 		LCD_WriteRAM(*(vu16 *)BmpAddress);
@@ -525,6 +846,20 @@ void LCD_WriteBMP(u32 BmpAddress)
 	}
 	LCD_WriteReg(R3, 0x1018);
 }
+#if LCD_USE_DMA
+/*******************************************************************************
+* Function Name  : LCD_WriteBMPDone
+* Description    : Restores the scan direction after a background LCD_WriteBMP.
+*                  Runs in the TIM8 update interrupt once the bus is idle.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_WriteBMPDone(void)
+{
+	LCD_WriteReg(R3, 0x1018);
+}
+#endif
 /*******************************************************************************
 * Function Name  : LCD_WriteReg
 * Description    : Writes to the selected LCD register.
@@ -535,25 +870,20 @@ void LCD_WriteBMP(u32 BmpAddress)
 *******************************************************************************/
 void LCD_WriteReg(u8 LCD_Reg, u16 LCD_RegValue)
 {
-	GPIOB->BRR  |= GPIO_PIN_9;  	
-	GPIOB->BRR  |= GPIO_PIN_8;  	
-	GPIOB->BSRR |= GPIO_PIN_5; 	
-	
+#if LCD_USE_DMA
+	LCD_DMA_Wait();
+#endif
+	LCD_BUS_WRITE(2);
+
+	LCD_CS_LOW();
+	LCD_RS_LOW();
 	GPIOC->ODR = LCD_Reg; 
-	GPIOB->BRR  |= GPIO_PIN_5; 
-	__nop();
-	__nop();
-	__nop();	
-	GPIOB->BSRR |= GPIO_PIN_5; 
-	GPIOB->BSRR |= GPIO_PIN_8; 
+	LCD_WR_STROBE();
 
+	LCD_RS_HIGH();
 	GPIOC->ODR = LCD_RegValue; 
-	GPIOB->BRR  |= GPIO_PIN_5; 
-	__nop();
-	__nop();
-	__nop();  
-	GPIOB->BSRR |= GPIO_PIN_5; 
-	GPIOB->BSRR |= GPIO_PIN_8; 
+	LCD_WR_STROBE();
+	LCD_CS_HIGH();
 }
 /*******************************************************************************
 * Function Name  : LCD_ReadReg
@@ -566,17 +896,17 @@ u16 LCD_ReadReg(u8 LCD_Reg)
 {
 	u16 temp;
 
-	GPIOB->BRR |= GPIO_PIN_9;  
-	GPIOB->BRR |= GPIO_PIN_8;  
-	GPIOB->BSRR |= GPIO_PIN_5; 
+#if LCD_USE_DMA
+	LCD_DMA_Wait();
+#endif
+	LCD_BUS_WRITE(1);
+	LCD_BUS_READ(1);
 
-	GPIOC->ODR = LCD_Reg; 
-	GPIOB->BRR |= GPIO_PIN_5; 
-	__nop();
-	__nop();
-	__nop();
-	GPIOB->BSRR |= GPIO_PIN_5;
-	GPIOB->BSRR |= GPIO_PIN_8;
+	LCD_CS_LOW();
+	LCD_RS_LOW();
+	GPIOC->ODR = LCD_Reg;
+	LCD_WR_STROBE();
+	LCD_RS_HIGH();
 
 	LCD_BusIn();
 	GPIOA->BRR |= GPIO_PIN_8;	
@@ -587,7 +917,7 @@ u16 LCD_ReadReg(u8 LCD_Reg)
 	GPIOA->BSRR |= GPIO_PIN_8;
 
 	LCD_BusOut();
-	GPIOB->BSRR |= GPIO_PIN_9; 
+	LCD_CS_HIGH();
 
 	return temp;
 }
@@ -600,21 +930,17 @@ u16 LCD_ReadReg(u8 LCD_Reg)
 *******************************************************************************/
 void LCD_WriteRAM_Prepare(void)
 { 
-	GPIOB->BRR  |=  GPIO_PIN_9;  
-	GPIOB->BRR  |=  GPIO_PIN_8; 
-	GPIOB->BSRR |=  GPIO_PIN_5; 
+#if LCD_USE_DMA
+	LCD_DMA_Wait();
+#endif
+	LCD_BUS_WRITE(1);
 
+	LCD_CS_LOW();
+	LCD_RS_LOW();
 	GPIOC->ODR = R34;     
-	GPIOB->BRR  |=  GPIO_PIN_5; 
-	__nop();
-	__nop();
-	__nop();    
-	GPIOB->BSRR |=  GPIO_PIN_5;
-	GPIOB->BSRR |=  GPIO_PIN_8; 
-	__nop();
-	__nop();
-	__nop();  
-	GPIOB->BSRR |=  GPIO_PIN_9; 
+	LCD_WR_STROBE();
+	LCD_RS_HIGH();
+	LCD_CS_HIGH();
 }
 /*******************************************************************************
 * Function Name  : LCD_WriteRAM
@@ -625,23 +951,290 @@ void LCD_WriteRAM_Prepare(void)
 *******************************************************************************/
 void LCD_WriteRAM(u16 RGB_Code)
 {
-	GPIOB->BRR  |=  GPIO_PIN_9;  
-	GPIOB->BSRR |=  GPIO_PIN_8; 
-	GPIOB->BSRR |=  GPIO_PIN_5; 
+#if LCD_USE_DMA
+	LCD_DMA_Wait();
+#endif
+	LCD_BUS_WRITE(1);
 
+	LCD_CS_LOW();
 	GPIOC->ODR = RGB_Code;
-	GPIOB->BRR  |=  GPIO_PIN_5;
-	__nop();
-	__nop();
-	__nop();  
-	GPIOB->BSRR |=  GPIO_PIN_5; 
-	GPIOB->BSRR |=  GPIO_PIN_8; 
-	__nop();
-	__nop();
-	__nop();
-	GPIOB->BSRR |=  GPIO_PIN_9; 
+	LCD_WR_STROBE();
+	LCD_CS_HIGH();
+}
+/*******************************************************************************
+* Function Name  : LCD_WriteRAM_Burst
+* Description    : Writes consecutive pixels to the LCD RAM, keeping CS low
+*                  for the whole burst. Call LCD_WriteRAM_Prepare first.
+* Input          : - Pixels: the pixel colors in RGB mode (5-6-5).
+*                  - Count: number of pixels.
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_WriteRAM_Burst(const u16 *Pixels, u32 Count)
+{
+#if LCD_USE_DMA
+	LCD_DMA_Wait();
+#endif
+	LCD_BUS_WRITE(Count);
+
+	LCD_CS_LOW();
+	while(Count--)
+	{
+		GPIOC->ODR = *Pixels++;
+		LCD_WR_STROBE();
+	}
+	LCD_CS_HIGH();
+}
+/*******************************************************************************
+* Function Name  : LCD_FillRAM
+* Description    : Writes the same color to consecutive pixels of the LCD RAM.
+*                  The data port is set once and only WR is toggled.
+*                  Call LCD_WriteRAM_Prepare first.
+* Input          : - Color: the pixel color in RGB mode (5-6-5).
+*                  - Count: number of pixels.
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_FillRAM(u16 Color, u32 Count)
+{
+#if LCD_USE_DMA
+	LCD_DMA_Wait();
+#endif
+	LCD_BUS_WRITE(Count);
+
+	LCD_CS_LOW();
+	GPIOC->ODR = Color;
+	while(Count >= 8)
+	{
+		LCD_WR_STROBE(); LCD_WR_STROBE(); LCD_WR_STROBE(); LCD_WR_STROBE();
+		LCD_WR_STROBE(); LCD_WR_STROBE(); LCD_WR_STROBE(); LCD_WR_STROBE();
+		Count -= 8;
+	}
+	while(Count--)
+	{
+		LCD_WR_STROBE();
+	}
+	LCD_CS_HIGH();
+}
+#if LCD_USE_DMA
+/*******************************************************************************
+* Function Name  : LCD_DMA_Init
+* Description    : Configures TIM8 and DMA1 channel 4 for pixel streaming.
+*                  Every TIM8 period of LCD_DMA_PERIOD ticks:
+*                    - CNT = 1 (CC4): DMA writes the next pixel to GPIOC->ODR
+*                    - CNT = CCR3: CH3N (WR) goes low
+*                    - update: WR goes high and the controller latches the pixel
+*                  One-pulse mode with the repetition counter stops the timer
+*                  after exactly RCR + 1 pixels with WR left high.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_DMA_Init(void)
+{
+	__HAL_RCC_TIM8_CLK_ENABLE();
+	__HAL_RCC_DMAMUX1_CLK_ENABLE();
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	TIM8->CR1   = TIM_CR1_OPM | TIM_CR1_URS;
+	TIM8->PSC   = 0;
+	TIM8->ARR   = LCD_DMA_PERIOD - 1;
+	TIM8->CCR3  = LCD_DMA_PERIOD / 2;
+	TIM8->CCR4  = 1;
+	/* OC3: PWM mode 1, only CH3N enabled so it follows OC3REF (high while CNT < CCR3) */
+	TIM8->CCMR2 = TIM_CCMR2_OC3M_2 | TIM_CCMR2_OC3M_1;
+	TIM8->CCER  = TIM_CCER_CC3NE;
+	TIM8->BDTR  = TIM_BDTR_MOE;
+	TIM8->DIER  = TIM_DIER_CC4DE | TIM_DIER_UIE;
+	TIM8->EGR   = TIM_EGR_UG;
+	TIM8->SR    = 0;
+
+	LCD_DMA_CHANNEL->CCR   = 0;
+	LCD_DMA_CHANNEL->CPAR  = (u32)&GPIOC->ODR;
+	LCD_DMA_MUX_CHANNEL->CCR = LCD_DMA_REQUEST;
+
+	/* WR toggles at up to a few MHz while streaming */
+	GPIOB->OSPEEDR |= (3U << (5 * 2));
+
+	NVIC_SetPriority(TIM8_UP_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), 1, 0));
+	NVIC_EnableIRQ(TIM8_UP_IRQn);
+}
+/*******************************************************************************
+* Function Name  : LCD_DMA_StartSegment
+* Description    : Streams the next segment (up to LCD_DMA_SEGMENT_MAX pixels).
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+static void LCD_DMA_StartSegment(void)
+{
+	u32 n = (DMARemaining > LCD_DMA_SEGMENT_MAX) ? LCD_DMA_SEGMENT_MAX : DMARemaining;
+
+	LCD_DMA_CHANNEL->CCR   = 0;
+	LCD_DMA_CHANNEL->CMAR  = (u32)DMASource;
+	LCD_DMA_CHANNEL->CNDTR = n;
+	LCD_DMA_CHANNEL->CCR   = DMA_CCR_DIR | DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0 | DMA_CCR_PL_1 |
+	                         (DMAIncrement ? DMA_CCR_MINC : 0) | DMA_CCR_EN;
+
+	TIM8->RCR = n - 1;
+	TIM8->EGR = TIM_EGR_UG;     /* load RCR, CNT = 0 */
+	TIM8->SR  = 0;
+	TIM8->CR1 |= TIM_CR1_CEN;
+
+	if(DMAIncrement)
+	{
+		DMASource += n;
+	}
+	DMARemaining -= n;
+}
+/*******************************************************************************
+* Function Name  : LCD_DMA_Start
+* Description    : Hands WR to TIM8 and starts streaming.
+* Input          : - Source: pixel buffer or fill color.
+*                  - Count: number of pixels.
+*                  - Increment: 1 for a buffer, 0 for a constant color.
+*                  - Done: completion callback (interrupt context), may be 0.
+* Output         : None
+* Return         : 0: started, 1: busy or nothing to do.
+*******************************************************************************/
+static u8 LCD_DMA_Start(const u16 *Source, u32 Count, u8 Increment, LCD_DMA_Callback Done)
+{
+	if(DMABusy || Count == 0)
+	{
+		return 1;
+	}
+
+	DMABusy      = 1;
+	DMASource    = Source;
+	DMARemaining = Count;
+	DMAIncrement = Increment;
+	DMADone      = Done;
+	LCD_BUS_WRITE(Count);
+
+	LCD_CS_LOW();
+	LCD_RS_HIGH();
+	GPIOB->BSRR  = GPIO_PIN_5;
+	GPIOB->AFR[0] = (GPIOB->AFR[0] & ~(0xFU << (5 * 4))) | (LCD_DMA_WR_AF << (5 * 4));
+	GPIOB->MODER  = (GPIOB->MODER & ~(3U << (5 * 2))) | (2U << (5 * 2));
+
+	LCD_DMA_StartSegment();
+	return 0;
 }
 /*******************************************************************************
+* Function Name  : LCD_DMA_WriteRAM
+* Description    : Streams a pixel buffer to the LCD RAM in the background.
+*                  Call LCD_WriteRAM_Prepare first. The buffer must stay valid
+*                  until the callback runs.
+* Input          : - Pixels: the pixel colors in RGB mode (5-6-5).
+*                  - Count: number of pixels.
+*                  - Done: completion callback (interrupt context), may be 0.
+* Output         : None
+* Return         : 0: started, 1: busy.
+*******************************************************************************/
+u8 LCD_DMA_WriteRAM(const u16 *Pixels, u32 Count, LCD_DMA_Callback Done)
+{
+	return LCD_DMA_Start(Pixels, Count, 1, Done);
+}
+/*******************************************************************************
+* Function Name  : LCD_DMA_FillRAM
+* Description    : Writes one color to consecutive pixels in the background.
+*                  Call LCD_WriteRAM_Prepare first.
+* Input          : - Color: the pixel color in RGB mode (5-6-5).
+*                  - Count: number of pixels.
+*                  - Done: completion callback (interrupt context), may be 0.
+* Output         : None
+* Return         : 0: started, 1: busy.
+*******************************************************************************/
+u8 LCD_DMA_FillRAM(u16 Color, u32 Count, LCD_DMA_Callback Done)
+{
+	if(DMABusy)
+	{
+		return 1;
+	}
+	DMAFillColor = Color;
+	return LCD_DMA_Start(&DMAFillColor, Count, 0, Done);
+}
+/*******************************************************************************
+* Function Name  : LCD_ClearAsync
+* Description    : Clears the whole LCD in the background.
+* Input          : - Color: the color of the background.
+*                  - Done: completion callback (interrupt context), may be 0.
+* Output         : None
+* Return         : 0: started, 1: busy.
+*******************************************************************************/
+u8 LCD_ClearAsync(u16 Color, LCD_DMA_Callback Done)
+{
+	if(DMABusy)
+	{
+		return 1;
+	}
+	LCD_SetCursor(0x00, 0x0000);
+	LCD_WriteRAM_Prepare();
+	LCD_TextCacheInvalidate();
+	return LCD_DMA_FillRAM(Color, 76800, Done);
+}
+/*******************************************************************************
+* Function Name  : LCD_DMA_IsBusy
+* Description    : Tells whether a background transfer is running.
+* Input          : None
+* Output         : None
+* Return         : 1: busy, 0: idle.
+*******************************************************************************/
+u8 LCD_DMA_IsBusy(void)
+{
+	return DMABusy;
+}
+/*******************************************************************************
+* Function Name  : LCD_DMA_Wait
+* Description    : Waits for the background transfer to finish. All bus
+*                  primitives call this first, so synchronous drawing simply
+*                  queues behind a running transfer.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_DMA_Wait(void)
+{
+	while(DMABusy)
+	{
+	}
+}
+/*******************************************************************************
+* Function Name  : LCD_DMA_UpdateCallback
+* Description    : TIM8 update: a segment has been latched. Starts the next
+*                  segment or gives WR back to the GPIO and signals completion.
+*                  Called from TIM8_UP_IRQHandler.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_DMA_UpdateCallback(void)
+{
+	LCD_DMA_Callback done;
+
+	if(!DMABusy)
+	{
+		return;
+	}
+	if(DMARemaining)
+	{
+		LCD_DMA_StartSegment();
+		return;
+	}
+
+	LCD_DMA_CHANNEL->CCR = 0;
+	GPIOB->MODER = (GPIOB->MODER & ~(3U << (5 * 2))) | (1U << (5 * 2));
+	LCD_CS_HIGH();
+
+	done    = DMADone;
+	DMABusy = 0;
+	if(done)
+	{
+		done();
+	}
+}
+#endif
+/*******************************************************************************
 * Function Name  : LCD_ReadRAM
 * Description    : Reads the LCD RAM.
 * Input          : None
@@ -652,17 +1245,17 @@ u16 LCD_ReadRAM(void)
 {
 	u16 temp;
 
-	GPIOB->BRR  |=  GPIO_PIN_9; 
-	GPIOB->BRR  |=  GPIO_PIN_8; 
-	GPIOB->BSRR |=  GPIO_PIN_5; 
+#if LCD_USE_DMA
+	LCD_DMA_Wait();
+#endif
+	LCD_BUS_WRITE(1);
+	LCD_BUS_READ(1);
 
-	GPIOC->ODR = R34;     
-	GPIOB->BRR  |=  GPIO_PIN_5;  
-	__nop();
-	__nop();
-	__nop();  
-	GPIOB->BSRR |=  GPIO_PIN_5; 
-	GPIOB->BSRR |=  GPIO_PIN_8; 
+	LCD_CS_LOW();
+	LCD_RS_LOW();
+	GPIOC->ODR = R34;
+	LCD_WR_STROBE();
+	LCD_RS_HIGH();
 
 	LCD_BusIn();
 	GPIOA->BRR |=  GPIO_PIN_8;
@@ -673,10 +1266,37 @@ u16 LCD_ReadRAM(void)
 	GPIOA->BSRR |=  GPIO_PIN_8;	
 	
 	LCD_BusOut();
-	GPIOB->BSRR |=  GPIO_PIN_9; 
+	LCD_CS_HIGH();
                          
 	return temp;
 }
+#if LCD_BUS_STATS
+/*******************************************************************************
+* Function Name  : LCD_GetBusStats
+* Description    : Reads the bus cycle counters. One cycle is one WR or RD
+*                  strobe on the parallel bus: a register write costs two
+*                  (index + data), a GRAM pixel one.
+* Input          : - Stats: receives the counters.
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_GetBusStats(LCD_BusStats *Stats)
+{
+	*Stats = BusStats;
+}
+/*******************************************************************************
+* Function Name  : LCD_ResetBusStats
+* Description    : Clears the bus cycle counters.
+* Input          : None
+* Output         : None
+* Return         : None
+*******************************************************************************/
+void LCD_ResetBusStats(void)
+{
+	BusStats.WriteCycles = 0;
+	BusStats.ReadCycles  = 0;
+}
+#endif
 /*******************************************************************************
 * Function Name  : LCD_PowerOn
 * Description    : Power on the LCD.
@@ -796,6 +1416,9 @@ void LCD_BusOut(void)
 /*******************************************************************************
 * Function Name  : LCD_DrawPicture
 * Description    : Displays a 16 color picture.
+*                  With LCD_USE_DMA a halfword-aligned picture is streamed in
+*                  the background; it must stay valid until LCD_DMA_IsBusy()
+*                  returns 0.
 * Input          : - picture: pointer to the picture array.
 * Output         : None
 * Return         : None
@@ -807,8 +1430,17 @@ void LCD_DrawPicture(const u8* picture)
 
 	LCD_WriteRAM_Prepare(); /* Prepare to write GRAM */
 
+#if LCD_USE_DMA
+	/* Little-endian pixel pairs are already u16 in memory order */
+	if(((u32)picture & 1) == 0 && LCD_DMA_WriteRAM((const u16 *)picture, 76800, 0) == 0)
+	{
+		LCD_TextCacheInvalidate();
+		return;
+	}
+#endif
 	for(index = 0; index < 76800; index++)
 	{
 		LCD_WriteRAM(picture[2*index+1]<<8|picture[2*index]);	
 	}
+	LCD_TextCacheInvalidate();
 }
@@ -30,6 +30,7 @@
 /* USER CODE BEGIN Includes */
 #include "../Service/log.h"
 #include "../Service/log_uart_adapter.h"
+#include "../BSP/bsp_uart.h"
 #include "lcd.h"
 #include <stdio.h>
 #include <string.h>
@@ -115,12 +116,16 @@ int main(void)
   log_init();
   HAL_Delay(3000);
   HAL_GPIO_WritePin(GPIOA, GPIO_PIN_11, GPIO_PIN_RESET); // LED OFF
-  // Register UART output adapter (use printf format for better performance)
-  if (log_uart_adapter_init_printf() == 0)
+  // Register UART output adapter (DMA: log_write returns without waiting for the UART)
+  if (log_uart_adapter_init_dma() == 0)
   {
     // Set log level
     log_set_level(LOG_LEVEL_DEBUG);
   }
+  else if (log_uart_adapter_init_printf() == 0)
+  {
+    log_set_level(LOG_LEVEL_DEBUG);
+  }
   else
   {
     // If printf format registration fails, try raw data format
@@ -130,12 +135,11 @@ int main(void)
     }
   }
 
+  // STC8串口：FIFO阈值+接收超时中断，数据在bsp_uart的环形缓冲区中读取
+  bsp_uart_init(2400);
 
   /* USER CODE END 2 */
-  
-  // 禁用USART2接收中断，改用轮询方式
-  LL_USART_DisableIT_RXNE(USART2);
-  
+
   // STC8握手帧头: 46 B9 68
   static const uint8_t STC8_FRAME_HEADER[3] = {0x46, 0xB9, 0x68};
 
@@ -146,63 +150,31 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
+    // 输出中断里记录的日志
+    log_process();
+
     // STC8握手：每30ms发送0x7F，等待BSL响应帧(46 B9 68开头)
     static uint32_t tx_count = 0;
     static uint8_t frame_detected = 0;
     static uint8_t rx_buffer[64] = {0};  // 接收缓冲区
     static uint8_t rx_index = 0;
+    static const uint8_t handshake = 0x7F;
     char lcd_buffer[21] = {0};
-    
-    // 清除可能存在的错误标志
-    if (LL_USART_IsActiveFlag_ORE(USART2)) LL_USART_ClearFlag_ORE(USART2);
-    if (LL_USART_IsActiveFlag_FE(USART2)) LL_USART_ClearFlag_FE(USART2);
-    if (LL_USART_IsActiveFlag_NE(USART2)) LL_USART_ClearFlag_NE(USART2);
-    if (LL_USART_IsActiveFlag_PE(USART2)) LL_USART_ClearFlag_PE(USART2);
+    bsp_uart_stats_t uart_stats;
     
     // 发送0x7F握手字节
-    while (!LL_USART_IsActiveFlag_TXE(USART2))
-    {
-      // 等待发送寄存器为空
-    }
-    LL_USART_TransmitData8(USART2, 0x7F);
-    
-    // 等待发送完成
-    while (!LL_USART_IsActiveFlag_TC(USART2))
-    {
-      // 等待传输完成
-    }
+    bsp_uart_write(&handshake, 1);
     
     tx_count++;
     
-    // 轮询接收（在30ms内尽量多接收数据）
+    // 在30ms内取走中断收到的数据（错误字节已在中断中丢弃并计数）
     uint32_t start_tick = HAL_GetTick();
     while ((HAL_GetTick() - start_tick) < 30)  // 30ms超时
     {
-      // 检查错误标志
-      if (LL_USART_IsActiveFlag_ORE(USART2))
-      {
-        LL_USART_ClearFlag_ORE(USART2);
-        LL_USART_ReceiveData8(USART2);  // 清除数据
-      }
-      if (LL_USART_IsActiveFlag_FE(USART2))
-      {
-        LL_USART_ClearFlag_FE(USART2);
-      }
-      if (LL_USART_IsActiveFlag_PE(USART2))
-      {
-        LL_USART_ClearFlag_PE(USART2);
-      }
-      
-      // 检查是否有数据接收
-      if (LL_USART_IsActiveFlag_RXNE(USART2))
+      uint16_t n = bsp_uart_read(&rx_buffer[rx_index], sizeof(rx_buffer) - rx_index);
+      if (n > 0)
       {
-        uint8_t data = LL_USART_ReceiveData8(USART2);
-        
-        // 存入缓冲区
-        if (rx_index < sizeof(rx_buffer))
-        {
-          rx_buffer[rx_index++] = data;
-        }
+        rx_index += n;
         
         // 检查是否收到帧头 46 B9 68
         if (rx_index >= 3)
@@ -220,6 +192,10 @@ int main(void)
           }
         }
       }
+      else if (rx_index >= sizeof(rx_buffer))
+      {
+        bsp_uart_flush_rx();  // 缓冲区已满，丢弃本轮多余的数据
+      }
     }
     
     // 显示状态到LCD
@@ -229,7 +205,7 @@ int main(void)
     LCD_DisplayStringLine(Line0, (u8 *)"STC8 ISP Handshake");
     LCD_DisplayStringLine(Line1, (u8 *)"2400bps EVEN parity");
     
-    snprintf(lcd_buffer, sizeof(lcd_buffer), "TX 0x7F: %lu", tx_count);
+    snprintf(lcd_buffer, sizeof(lcd_buffer), "TX 0x7F: %lu", (unsigned long)tx_count);
     LCD_DisplayStringLine(Line2, (u8 *)lcd_buffer);
     
     // 显示接收状态
@@ -268,6 +244,14 @@ int main(void)
       LCD_DisplayStringLine(Line4, (u8 *)"Power on STC8 now!");
     }
     
+    // 接收错误计数（中断中累加）
+    bsp_uart_get_stats(&uart_stats);
+    LCD_SetTextColor(uart_stats.overrun + uart_stats.frame_error + uart_stats.parity_error ? Red : White);
+    snprintf(lcd_buffer, sizeof(lcd_buffer), "ORE%lu FE%lu PE%lu",
+             (unsigned long)uart_stats.overrun, (unsigned long)uart_stats.frame_error,
+             (unsigned long)uart_stats.parity_error);
+    LCD_DisplayStringLine(Line5, (u8 *)lcd_buffer);
+    
     // 如果检测到帧头，不再清空缓冲区，保持状态
     if (!frame_detected)
     {
@@ -191,8 +191,7 @@ void MX_USART2_UART_Init(void)
   }
   /* USER CODE BEGIN USART2_Init 2 */
 
-  // 使能接收中断（RXNE中断）
-  LL_USART_EnableIT_RXNE(USART2);
+  // 接收中断（FIFO阈值+接收超时）由bsp_uart_init()开启
 
   /* USER CODE END USART2_Init 2 */
 }
@@ -13,6 +13,7 @@ static int hal_set_baudrate(void* handle, uint32_t baudrate);
 static int hal_set_parity(void* handle, stc_parity_t parity);
 static int hal_write(void* handle, const uint8_t* data, uint16_t len, uint32_t timeout_ms);
 static int hal_read(void* handle, uint8_t* data, uint16_t max_len, uint32_t timeout_ms);
+static uint16_t hal_available(void* handle);
 static void hal_flush(void* handle);
 static void hal_delay_ms(uint32_t ms);
 static uint32_t hal_get_tick_ms(void);
@@ -25,6 +26,7 @@ static const stc_hal_t g_stm32_hal = {
     .set_parity = hal_set_parity,
     .write = hal_write,
     .read = hal_read,
+    .available = hal_available,
     .flush = hal_flush,
     .delay_ms = hal_delay_ms,
     .get_tick_ms = hal_get_tick_ms,
@@ -156,6 +158,16 @@ static int hal_read(void* handle, uint8_t* data, uint16_t max_len, uint32_t time
 #endif
 }
 
+static uint16_t hal_available(void* handle)
+{
+    stc_stm32_uart_t* uart = (stc_stm32_uart_t*)handle;
+    if (uart == NULL) {
+        return 0;
+    }
+    
+    return (uint16_t)((uart->rx_head + sizeof(uart->rx_buffer) - uart->rx_tail) % sizeof(uart->rx_buffer));
+}
+
 static void hal_flush(void* handle)
 {
     stc_stm32_uart_t* uart = (stc_stm32_uart_t*)handle;
@@ -24,12 +24,12 @@ static int send_packet(stc_context_t* ctx, const uint8_t* payload, uint16_t len)
     }
     
     int pkt_len = stc_build_packet(ctx->config, payload, len, 
-                                    ctx->tx_buffer, sizeof(ctx->tx_buffer));
+                                    ctx->frame->tx, sizeof(ctx->frame->tx));
     if (pkt_len < 0) {
         return STC_ERR_FRAME;
     }
     
-    int ret = ctx->hal->write(ctx->uart_handle, ctx->tx_buffer, pkt_len, 
+    int ret = ctx->hal->write(ctx->uart_handle, ctx->frame->tx, pkt_len, 
                                ctx->comm_config.timeout_ms);
     if (ret < 0) {
         return STC_ERR_TIMEOUT;
@@ -44,20 +44,22 @@ static int recv_packet(stc_context_t* ctx, uint8_t* payload, uint16_t* len, uint
         return STC_ERR_INVALID_PARAM;
     }
     
-    int rx_len = ctx->hal->read(ctx->uart_handle, ctx->rx_buffer, 
-                                 sizeof(ctx->rx_buffer), timeout_ms);
+    int rx_len = stc_context_read(ctx, ctx->frame->rx,
+                                  sizeof(ctx->frame->rx), timeout_ms);
     if (rx_len < 0) {
         return STC_ERR_TIMEOUT;
     }
     
     stc_packet_info_t info;
-    int ret = stc_parse_packet(ctx->config, ctx->rx_buffer, rx_len, &info);
+    int ret = stc_parse_packet(ctx->config, ctx->frame->rx, rx_len, &info);
     if (ret != STC_OK) {
         return ret;
     }
     
     if (payload != NULL && len != NULL) {
-        memcpy(payload, info.payload, info.payload_len);
+        if (payload != info.payload) {
+            memcpy(payload, info.payload, info.payload_len);
+        }
         *len = info.payload_len;
     }
     
@@ -141,8 +143,8 @@ int stc12_handshake(stc_context_t* ctx)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[16];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos;
     int ret;
@@ -252,8 +254,8 @@ int stc12_erase_flash(stc_context_t* ctx, uint32_t size)
     uint16_t blks = ((size + 511) / 512) * 2;
     uint16_t total_size = ((ctx->mcu_info.flash_size + 511) / 512) * 2;
     
-    uint8_t tx_buf[128];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -313,8 +315,8 @@ int stc12_program_block(stc_context_t* ctx, uint32_t addr, const uint8_t* data,
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[256];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -368,8 +370,8 @@ int stc12_program_finish(stc_context_t* ctx)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[16];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -408,8 +410,8 @@ int stc12_set_options(stc_context_t* ctx, const uint8_t* options, uint8_t len)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[16];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -441,7 +443,7 @@ int stc12_disconnect(stc_context_t* ctx)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[4];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
     tx_buf[0] = STC_CMD_DISCONNECT;
     
     /* 发送断开命令，不等待响应 */
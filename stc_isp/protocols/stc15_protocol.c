@@ -46,12 +46,12 @@ static int send_packet(stc_context_t* ctx, const uint8_t* payload, uint16_t len)
     }
     
     int pkt_len = stc_build_packet(ctx->config, payload, len, 
-                                    ctx->tx_buffer, sizeof(ctx->tx_buffer));
+                                    ctx->frame->tx, sizeof(ctx->frame->tx));
     if (pkt_len < 0) {
         return STC_ERR_FRAME;
     }
     
-    int ret = ctx->hal->write(ctx->uart_handle, ctx->tx_buffer, pkt_len, 
+    int ret = ctx->hal->write(ctx->uart_handle, ctx->frame->tx, pkt_len, 
                                ctx->comm_config.timeout_ms);
     if (ret < 0) {
         return STC_ERR_TIMEOUT;
@@ -67,22 +67,24 @@ static int recv_packet(stc_context_t* ctx, uint8_t* payload, uint16_t* len, uint
     }
     
     /* 接收数据 */
-    int rx_len = ctx->hal->read(ctx->uart_handle, ctx->rx_buffer, 
-                                 sizeof(ctx->rx_buffer), timeout_ms);
+    int rx_len = stc_context_read(ctx, ctx->frame->rx,
+                                  sizeof(ctx->frame->rx), timeout_ms);
     if (rx_len < 0) {
         return STC_ERR_TIMEOUT;
     }
     
     /* 解析数据包 */
     stc_packet_info_t info;
-    int ret = stc_parse_packet(ctx->config, ctx->rx_buffer, rx_len, &info);
+    int ret = stc_parse_packet(ctx->config, ctx->frame->rx, rx_len, &info);
     if (ret != STC_OK) {
         return ret;
     }
     
     /* 复制载荷 */
     if (payload != NULL && len != NULL) {
-        memcpy(payload, info.payload, info.payload_len);
+        if (payload != info.payload) {
+            memcpy(payload, info.payload, info.payload_len);
+        }
         *len = info.payload_len;
     }
     
@@ -170,8 +172,8 @@ int stc15_handshake(stc_context_t* ctx)
     }
     
     /* STC15系列在频率校准时完成波特率切换，这里只做基本握手 */
-    uint8_t tx_buf[16];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     
     /* 发送握手请求 0x50 */
@@ -213,8 +215,8 @@ int stc15_calibrate_frequency(stc_context_t* ctx, float target_freq)
     uint32_t target_count = (uint32_t)(ctx->mcu_info.freq_counter * 
                                         (user_speed / ctx->mcu_info.clock_hz) + 0.5f);
     
-    uint8_t tx_buf[64];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos;
     int ret;
@@ -387,8 +389,8 @@ int stc15a_calibrate_frequency(stc_context_t* ctx, float target_freq)
     uint32_t program_count = (uint32_t)(ctx->mcu_info.freq_counter * 
                                          (program_speed / ctx->mcu_info.clock_hz) + 0.5f);
     
-    uint8_t tx_buf[128];
-    uint8_t rx_buf[128];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos;
     int ret;
@@ -525,8 +527,8 @@ int stc15_erase_flash(stc_context_t* ctx, uint32_t size)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[16];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     
     /* 发送擦除命令 0x03 */
@@ -565,8 +567,8 @@ int stc15_program_block(stc_context_t* ctx, uint32_t addr, const uint8_t* data,
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[128];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -624,8 +626,8 @@ int stc15_program_finish(stc_context_t* ctx)
         return STC_OK;  /* 旧版本不需要 */
     }
     
-    uint8_t tx_buf[8];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     
     tx_buf[0] = STC_CMD_FINISH_72;
@@ -660,8 +662,8 @@ int stc15_set_options(stc_context_t* ctx, const uint8_t* options, uint8_t len)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[64];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -697,7 +699,7 @@ int stc15_disconnect(stc_context_t* ctx)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[4];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
     tx_buf[0] = STC_CMD_DISCONNECT;
     
     /* 发送断开命令，不等待响应 */
@@ -52,12 +52,12 @@ static int send_packet_89(stc_context_t* ctx, const uint8_t* payload, uint16_t l
     
     /* STC89使用单字节校验和 */
     int pkt_len = stc_build_packet(ctx->config, payload, len, 
-                                    ctx->tx_buffer, sizeof(ctx->tx_buffer));
+                                    ctx->frame->tx, sizeof(ctx->frame->tx));
     if (pkt_len < 0) {
         return STC_ERR_FRAME;
     }
     
-    int ret = ctx->hal->write(ctx->uart_handle, ctx->tx_buffer, pkt_len, 
+    int ret = ctx->hal->write(ctx->uart_handle, ctx->frame->tx, pkt_len, 
                                ctx->comm_config.timeout_ms);
     if (ret < 0) {
         return STC_ERR_TIMEOUT;
@@ -72,20 +72,22 @@ static int recv_packet_89(stc_context_t* ctx, uint8_t* payload, uint16_t* len, u
         return STC_ERR_INVALID_PARAM;
     }
     
-    int rx_len = ctx->hal->read(ctx->uart_handle, ctx->rx_buffer, 
-                                 sizeof(ctx->rx_buffer), timeout_ms);
+    int rx_len = stc_context_read(ctx, ctx->frame->rx,
+                                  sizeof(ctx->frame->rx), timeout_ms);
     if (rx_len < 0) {
         return STC_ERR_TIMEOUT;
     }
     
     stc_packet_info_t info;
-    int ret = stc_parse_packet(ctx->config, ctx->rx_buffer, rx_len, &info);
+    int ret = stc_parse_packet(ctx->config, ctx->frame->rx, rx_len, &info);
     if (ret != STC_OK) {
         return ret;
     }
     
     if (payload != NULL && len != NULL) {
-        memcpy(payload, info.payload, info.payload_len);
+        if (payload != info.payload) {
+            memcpy(payload, info.payload, info.payload_len);
+        }
         *len = info.payload_len;
     }
     
@@ -154,8 +156,8 @@ int stc89_handshake(stc_context_t* ctx)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[16];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos;
     int ret;
@@ -265,8 +267,8 @@ int stc89_erase_flash(stc_context_t* ctx, uint32_t size)
     /* 计算块数（每512字节为1块，需要擦除2倍块数） */
     uint16_t blks = ((size + 511) / 512) * 2;
     
-    uint8_t tx_buf[16];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -309,8 +311,8 @@ int stc89_program_block(stc_context_t* ctx, uint32_t addr, const uint8_t* data,
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[256];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -375,8 +377,8 @@ int stc89_set_options(stc_context_t* ctx, const uint8_t* options, uint8_t len)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[8];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -412,7 +414,7 @@ int stc89_disconnect(stc_context_t* ctx)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[4];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
     tx_buf[0] = STC_CMD_DISCONNECT;
     
     send_packet_89(ctx, tx_buf, 1);
@@ -460,8 +462,8 @@ int stc89a_handshake(stc_context_t* ctx)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[16];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos;
     int ret;
@@ -538,8 +540,8 @@ int stc89a_erase_flash(stc_context_t* ctx, uint32_t size)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[8];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -582,8 +584,8 @@ int stc89a_program_block(stc_context_t* ctx, uint32_t addr, const uint8_t* data,
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[256];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -633,8 +635,8 @@ int stc89a_set_options(stc_context_t* ctx, const uint8_t* options, uint8_t len)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[16];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos = 0;
     
@@ -672,7 +674,7 @@ int stc89a_disconnect(stc_context_t* ctx)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[4];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
     tx_buf[0] = STC_CMD_DISCONNECT_FF;
     
     send_packet_89a(ctx, tx_buf, 1);
@@ -24,12 +24,12 @@ static int send_packet(stc_context_t* ctx, const uint8_t* payload, uint16_t len)
     }
     
     int pkt_len = stc_build_packet(ctx->config, payload, len, 
-                                    ctx->tx_buffer, sizeof(ctx->tx_buffer));
+                                    ctx->frame->tx, sizeof(ctx->frame->tx));
     if (pkt_len < 0) {
         return STC_ERR_FRAME;
     }
     
-    int ret = ctx->hal->write(ctx->uart_handle, ctx->tx_buffer, pkt_len, 
+    int ret = ctx->hal->write(ctx->uart_handle, ctx->frame->tx, pkt_len, 
                                ctx->comm_config.timeout_ms);
     if (ret < 0) {
         return STC_ERR_TIMEOUT;
@@ -44,20 +44,22 @@ static int recv_packet(stc_context_t* ctx, uint8_t* payload, uint16_t* len, uint
         return STC_ERR_INVALID_PARAM;
     }
     
-    int rx_len = ctx->hal->read(ctx->uart_handle, ctx->rx_buffer, 
-                                 sizeof(ctx->rx_buffer), timeout_ms);
+    int rx_len = stc_context_read(ctx, ctx->frame->rx,
+                                  sizeof(ctx->frame->rx), timeout_ms);
     if (rx_len < 0) {
         return STC_ERR_TIMEOUT;
     }
     
     stc_packet_info_t info;
-    int ret = stc_parse_packet(ctx->config, ctx->rx_buffer, rx_len, &info);
+    int ret = stc_parse_packet(ctx->config, ctx->frame->rx, rx_len, &info);
     if (ret != STC_OK) {
         return ret;
     }
     
     if (payload != NULL && len != NULL) {
-        memcpy(payload, info.payload, info.payload_len);
+        if (payload != info.payload) {
+            memcpy(payload, info.payload, info.payload_len);
+        }
         *len = info.payload_len;
     }
     
@@ -79,8 +81,8 @@ int stc8_calibrate_frequency(stc_context_t* ctx, float target_freq)
     /* 计算目标频率计数 */
     uint32_t target_user_count = (uint32_t)(user_speed / (ctx->comm_config.baud_handshake / 2.0f) + 0.5f);
     
-    uint8_t tx_buf[64];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos;
     int ret;
@@ -246,8 +248,8 @@ int stc8d_calibrate_frequency(stc_context_t* ctx, float target_freq)
     
     uint32_t target_user_count = (uint32_t)(user_speed / (ctx->comm_config.baud_handshake / 2.0f) + 0.5f);
     
-    uint8_t tx_buf[64];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos;
     int ret;
@@ -398,8 +400,8 @@ int stc8g_calibrate_frequency(stc_context_t* ctx, float target_freq)
     
     uint32_t target_user_count = (uint32_t)(user_speed / (ctx->comm_config.baud_handshake / 2.0f) + 0.5f);
     
-    uint8_t tx_buf[80];
-    uint8_t rx_buf[64];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     uint16_t pos;
     int ret;
@@ -556,13 +558,13 @@ int stc8_set_options(stc_context_t* ctx, const uint8_t* options, uint8_t len)
         return STC_ERR_INVALID_PARAM;
     }
     
-    uint8_t tx_buf[64];
-    uint8_t rx_buf[32];
+    uint8_t* tx_buf = STC_TX_PAYLOAD(ctx);
+    uint8_t* rx_buf = STC_RX_PAYLOAD(ctx);
     uint16_t rx_len;
     
-    /* 构建40字节选项包 */
-    uint8_t option_packet[40];
-    memset(option_packet, 0xFF, sizeof(option_packet));
+    /* 构建40字节选项包（直接写在命令字节之后） */
+    uint8_t* option_packet = &tx_buf[1];
+    memset(option_packet, 0xFF, STC8_OPTION_PACKET_SIZE);
     
     /* 设置固定字段 */
     option_packet[3] = 0x00;
@@ -589,13 +591,10 @@ int stc8_set_options(stc_context_t* ctx, const uint8_t* options, uint8_t len)
         memcpy(&option_packet[36], &options[1], MIN(len - 1, 4));
     }
     
-    /* 构建发送包 */
-    uint16_t pos = 0;
-    tx_buf[pos++] = STC_CMD_SET_OPTIONS;
-    memcpy(&tx_buf[pos], option_packet, sizeof(option_packet));
-    pos += sizeof(option_packet);
+    /* 命令字节 */
+    tx_buf[0] = STC_CMD_SET_OPTIONS;
     
-    int ret = send_packet(ctx, tx_buf, pos);
+    int ret = send_packet(ctx, tx_buf, 1 + STC8_OPTION_PACKET_SIZE);
     if (ret != STC_OK) {
         return ret;
     }
@@ -18,6 +18,7 @@ extern "C" {
  * STC8协议常量
  *============================================================================*/
 #define STC8_PROGRAM_FREQ       24000000.0f     // STC8使用24MHz编程频率
+#define STC8_OPTION_PACKET_SIZE 40              // STC8选项包长度
 
 /*============================================================================
  * STC8协议操作声明
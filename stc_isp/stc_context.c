@@ -6,6 +6,12 @@
 #include "stc_context.h"
 #include <string.h>
 
+/*============================================================================
+ * 帧缓冲区池
+ *============================================================================*/
+static stc_frame_buf_t g_frame_pool[STC_FRAME_POOL_SIZE];
+static stc_context_t* g_frame_owner[STC_FRAME_POOL_SIZE];
+
 /**
  * @brief 初始化上下文
  */
@@ -41,6 +47,9 @@ void stc_context_reset(stc_context_t* ctx)
         return;
     }
     
+    /* 归还租用的帧缓冲区 */
+    stc_context_release_frame(ctx);
+    
     /* 保存需要保留的字段 */
     const stc_hal_t* hal = ctx->hal;
     void* uart_handle = ctx->uart_handle;
@@ -49,6 +58,8 @@ void stc_context_reset(stc_context_t* ctx)
     void* progress_user_data = ctx->progress_user_data;
     stc_log_cb_t log_cb = ctx->log_cb;
     void* log_user_data = ctx->log_user_data;
+    stc_idle_cb_t idle_cb = ctx->idle_cb;
+    void* idle_user_data = ctx->idle_user_data;
     stc_select_mode_t select_mode = ctx->select_mode;
     stc_protocol_id_t manual_proto_id = ctx->manual_proto_id;
     
@@ -63,6 +74,8 @@ void stc_context_reset(stc_context_t* ctx)
     ctx->progress_user_data = progress_user_data;
     ctx->log_cb = log_cb;
     ctx->log_user_data = log_user_data;
+    ctx->idle_cb = idle_cb;
+    ctx->idle_user_data = idle_user_data;
     ctx->select_mode = select_mode;
     ctx->manual_proto_id = manual_proto_id;
 }
@@ -107,6 +120,78 @@ void stc_context_set_log_callback(stc_context_t* ctx, stc_log_cb_t cb, void* use
     }
     
     ctx->log_cb = cb;
-    ctx->log_user_data = log_user_data;
+    ctx->log_user_data = user_data;
+}
+
+/**
+ * @brief 设置空闲回调
+ */
+void stc_context_set_idle_callback(stc_context_t* ctx, stc_idle_cb_t cb, void* user_data)
+{
+    if (ctx == NULL) {
+        return;
+    }
+    
+    ctx->idle_cb = cb;
+    ctx->idle_user_data = user_data;
+}
+
+/**
+ * @brief 接收目标数据（等待期间执行空闲回调）
+ */
+int stc_context_read(stc_context_t* ctx, uint8_t* data, uint16_t max_len, uint32_t timeout_ms)
+{
+    if (ctx->idle_cb != NULL && ctx->hal->available != NULL) {
+        /* 等待首字节期间执行回调：UART由中断接收到环形缓冲区，回调执行期间不会丢数据 */
+        uint32_t start_tick = ctx->hal->get_tick_ms();
+        while (ctx->hal->available(ctx->uart_handle) == 0) {
+            if ((ctx->hal->get_tick_ms() - start_tick) >= timeout_ms) {
+                return -1;
+            }
+            ctx->idle_cb(ctx->idle_user_data);
+        }
+    }
+    
+    /* 首字节已到达时也给完整超时：hal->read在字节间隔超过阈值时才结束，
+       短超时会在帧尾到达前返回半帧 */
+    return ctx->hal->read(ctx->uart_handle, data, max_len, timeout_ms);
+}
+
+/**
+ * @brief 租用帧缓冲区
+ */
+int stc_context_acquire_frame(stc_context_t* ctx)
+{
+    if (ctx == NULL) {
+        return STC_ERR_INVALID_PARAM;
+    }
+    
+    if (ctx->frame != NULL) {
+        return STC_OK;
+    }
+    
+    for (int i = 0; i < STC_FRAME_POOL_SIZE; i++) {
+        if (g_frame_owner[i] == NULL) {
+            g_frame_owner[i] = ctx;
+            ctx->frame = &g_frame_pool[i];
+            ctx->frame->rx_len = 0;
+            return STC_OK;
+        }
+    }
+    
+    return STC_ERR_BUSY;
+}
+
+/**
+ * @brief 归还帧缓冲区
+ */
+void stc_context_release_frame(stc_context_t* ctx)
+{
+    if (ctx == NULL || ctx->frame == NULL) {
+        return;
+    }
+    
+    g_frame_owner[ctx->frame - g_frame_pool] = NULL;
+    ctx->frame = NULL;
 }
 
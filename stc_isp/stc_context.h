@@ -9,6 +9,7 @@
 #include "stc_types.h"
 #include "stc_protocol_config.h"
 #include "stc_protocol_ops.h"
+#include "stc_packet.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -19,7 +20,7 @@ extern "C" {
  *============================================================================*/
 typedef struct {
     uint16_t    magic;              // MCU Magic值（型号识别码）
-    const char* model_name;         // MCU型号名称
+    char        model_name[STC_MODEL_NAME_MAX]; // MCU型号名称（空串表示未识别）
     uint32_t    flash_size;         // Flash大小（字节）
     uint32_t    eeprom_size;        // EEPROM大小（字节）
     float       clock_hz;           // 当前时钟频率（Hz）
@@ -91,6 +92,14 @@ typedef struct {
      */
     int (*read)(void* handle, uint8_t* data, uint16_t max_len, uint32_t timeout_ms);
     
+    /**
+     * @brief 查询已接收未读取的字节数（不阻塞）
+     * @param handle UART句柄
+     * @return 可读字节数
+     * @note 可为NULL：此时空闲回调不生效，stc_context_read直接阻塞读取
+     */
+    uint16_t (*available)(void* handle);
+    
     /**
      * @brief 清空接收缓冲区
      * @param handle UART句柄
@@ -112,7 +121,43 @@ typedef struct {
 } stc_hal_t;
 
 /*============================================================================
- * 运行时上下文
+ * 帧缓冲区
+ * 收发缓冲区不属于单个目标，由共享池按操作租用（见stc_context_acquire_frame），
+ * 池大小STC_FRAME_POOL_SIZE为同时通信的目标数，而非目标总数
+ *============================================================================*/
+#ifndef STC_FRAME_POOL_SIZE
+#define STC_FRAME_POOL_SIZE     1
+#endif
+
+typedef struct {
+    uint8_t                 tx[STC_MAX_PACKET_SIZE];    // 发送帧
+    uint8_t                 rx[STC_MAX_PACKET_SIZE];    // 接收帧
+    uint16_t                rx_len;                     // 接收数据长度
+} stc_frame_buf_t;
+
+/*============================================================================
+ * 流式烧录预读缓冲区
+ * 只有stc_program_stream()需要，由调用方提供，不放进帧缓冲区池，
+ * 以免stc_program()/stc_connect()等操作也为它占用RAM
+ *============================================================================*/
+/* 预读块大小（双缓冲，须为编程块大小的整数倍） */
+#ifndef STC_PREFETCH_CHUNK
+#define STC_PREFETCH_CHUNK      512
+#endif
+
+#if (STC_PREFETCH_CHUNK % STC_BLOCK_SIZE_128) != 0
+#error "STC_PREFETCH_CHUNK must be a multiple of the programming block size"
+#endif
+
+typedef struct {
+    uint8_t                 image[2][STC_PREFETCH_CHUNK]; // 预读双缓冲
+} stc_prefetch_buf_t;
+
+/*============================================================================
+ * 运行时上下文（每个目标一个会话）
+ * 只保存跨操作的状态：协议选择、MCU信息、校准结果、通信参数和回调，
+ * 帧缓冲区在stc_connect/stc_program等操作期间从共享池租用。
+ * 每路目标约200字节（Cortex-M4，见README），每个池缓冲区约1KB
  *============================================================================*/
 struct stc_context {
     /* 协议配置和操作 */
@@ -143,17 +188,26 @@ struct stc_context {
     void*                   progress_user_data; // 进度回调用户数据
     stc_log_cb_t            log_cb;             // 日志回调
     void*                   log_user_data;      // 日志回调用户数据
+    stc_idle_cb_t           idle_cb;            // 空闲回调（等待响应期间调用）
+    void*                   idle_user_data;     // 空闲回调用户数据
     
-    /* 内部缓冲区 */
-    uint8_t                 tx_buffer[STC_MAX_PACKET_SIZE];
-    uint8_t                 rx_buffer[STC_MAX_PACKET_SIZE];
-    uint16_t                rx_len;             // 接收数据长度
+    /* 租用的帧缓冲区（操作期间有效，空闲时为NULL） */
+    stc_frame_buf_t*        frame;
     
     /* 状态包原始数据（用于协议解析） */
-    uint8_t                 status_packet[STC_MAX_PAYLOAD_SIZE];
+    uint8_t                 status_packet[STC_STATUS_PACKET_SIZE];
     uint16_t                status_packet_len;
 };
 
+/*============================================================================
+ * 协议暂存区
+ * 协议函数直接在租用的帧缓冲区中组装发送载荷、读取接收载荷，
+ * 不在栈上分配帧缓冲区：发送前由stc_packet_finalize()原地补全帧头和校验和，
+ * 接收后载荷即位于帧缓冲区中，不再复制
+ *============================================================================*/
+#define STC_TX_PAYLOAD(ctx)     STC_PACKET_PAYLOAD((ctx)->frame->tx)
+#define STC_RX_PAYLOAD(ctx)     STC_PACKET_PAYLOAD((ctx)->frame->rx)
+
 /*============================================================================
  * 上下文管理函数
  *============================================================================*/
@@ -196,6 +250,42 @@ void stc_context_set_progress_callback(stc_context_t* ctx, stc_progress_cb_t cb,
  */
 void stc_context_set_log_callback(stc_context_t* ctx, stc_log_cb_t cb, void* user_data);
 
+/**
+ * @brief 设置空闲回调
+ * @param ctx 上下文指针
+ * @param cb 回调函数（NULL取消）
+ * @param user_data 用户数据
+ * @note 设置后等待目标响应的首字节期间反复调用回调（需要hal->available）；
+ *       流式烧录期间由stc_program_stream()占用，用于SD预读
+ */
+void stc_context_set_idle_callback(stc_context_t* ctx, stc_idle_cb_t cb, void* user_data);
+
+/**
+ * @brief 接收目标数据（等待期间执行空闲回调）
+ * @param ctx 上下文指针
+ * @param data 接收缓冲区
+ * @param max_len 最大接收长度
+ * @param timeout_ms 超时时间
+ * @return 实际接收字节数，<0超时或失败（同hal->read）
+ * @note 空闲回调只用于等待首字节；首字节到达后按完整的timeout_ms调用hal->read，
+ *       由其按字节间隔收齐整帧，因此最长等待时间可达2×timeout_ms
+ */
+int stc_context_read(stc_context_t* ctx, uint8_t* data, uint16_t max_len, uint32_t timeout_ms);
+
+/**
+ * @brief 从共享池租用帧缓冲区（已租用时直接返回成功）
+ * @param ctx 上下文指针
+ * @return STC_OK成功，STC_ERR_BUSY池中无空闲缓冲区
+ * @note 池操作不加锁，需在同一线程中调用
+ */
+int stc_context_acquire_frame(stc_context_t* ctx);
+
+/**
+ * @brief 归还帧缓冲区
+ * @param ctx 上下文指针
+ */
+void stc_context_release_frame(stc_context_t* ctx);
+
 #ifdef __cplusplus
 }
 #endif
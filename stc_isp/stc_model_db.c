@@ -99,122 +99,35 @@ static const stc_protocol_entry_t g_protocol_registry[STC_PROTO_COUNT] = {
 };
 
 /*============================================================================
- * 型号数据库
- * 注意：这是一个精简版的数据库，包含常用型号
- * 完整数据库可能包含数百个型号
+ * 型号数据库（打包格式）
+ * 由tools/gen_model_db.py从stcgal型号列表生成，每个型号占6字节：
+ * - magic_lo: Magic低字节，高字节由g_model_magic_start分桶给出
+ * - prefix:   名称前缀编号（g_model_prefix下标）
+ * - name:     bit0-11名称后缀在字符串池中的偏移，bit12-15协议ID
+ * - size:     bit0-8 Flash大小，bit9-15 EEPROM大小，单位512字节
  *============================================================================*/
-static const stc_model_info_t g_model_db[] = {
-    /* STC89系列 */
-    { 0xE001, "STC89C51RC",     4096,   0, STC_PROTO_STC89 },
-    { 0xE002, "STC89C52RC",     8192,   0, STC_PROTO_STC89 },
-    { 0xE003, "STC89C53RC",    13312,   0, STC_PROTO_STC89 },
-    { 0xE004, "STC89C54RD+",   16384,   0, STC_PROTO_STC89 },
-    { 0xE006, "STC89C58RD+",   32768,   0, STC_PROTO_STC89 },
-    { 0xE101, "STC89LE51RC",    4096,   0, STC_PROTO_STC89 },
-    { 0xE102, "STC89LE52RC",    8192,   0, STC_PROTO_STC89 },
-    { 0xE103, "STC89LE53RC",   13312,   0, STC_PROTO_STC89 },
-    { 0xE104, "STC89LE54RD+",  16384,   0, STC_PROTO_STC89 },
-    { 0xE106, "STC89LE58RD+",  32768,   0, STC_PROTO_STC89 },
-    
-    /* STC90系列 */
-    { 0xE042, "STC90C52RC",     8192,   0, STC_PROTO_STC89 },
-    { 0xE046, "STC90C58RD+",   32768,   0, STC_PROTO_STC89 },
-    { 0xE142, "STC90LE52RC",    8192,   0, STC_PROTO_STC89 },
-    { 0xE146, "STC90LE58RD+",  32768,   0, STC_PROTO_STC89 },
-    
-    /* STC12系列 */
-    { 0xD102, "STC12C5052",     5120,   0, STC_PROTO_STC89A },
-    { 0xD162, "STC12LE5052",    5120,   0, STC_PROTO_STC89A },
-    { 0xD172, "STC12C5052AD",   5120,   0, STC_PROTO_STC89A },
-    { 0xD1F2, "STC12LE5052AD",  5120,   0, STC_PROTO_STC89A },
-    
-    { 0xD164, "STC12C5A60S2",  61440, 1024, STC_PROTO_STC12 },
-    { 0xD168, "STC12C5A56S2",  57344, 1024, STC_PROTO_STC12 },
-    { 0xD16C, "STC12C5A52S2",  53248, 1024, STC_PROTO_STC12 },
-    { 0xD170, "STC12C5A48S2",  49152, 1024, STC_PROTO_STC12 },
-    { 0xD174, "STC12C5A40S2",  40960, 1024, STC_PROTO_STC12 },
-    { 0xD178, "STC12C5A32S2",  32768, 1024, STC_PROTO_STC12 },
-    { 0xD17C, "STC12C5A16S2",  16384, 1024, STC_PROTO_STC12 },
-    { 0xD180, "STC12C5A08S2",   8192, 1024, STC_PROTO_STC12 },
-    
-    { 0xD1E4, "STC12LE5A60S2", 61440, 1024, STC_PROTO_STC12 },
-    { 0xD1E8, "STC12LE5A56S2", 57344, 1024, STC_PROTO_STC12 },
-    { 0xD1EC, "STC12LE5A52S2", 53248, 1024, STC_PROTO_STC12 },
-    { 0xD1F0, "STC12LE5A48S2", 49152, 1024, STC_PROTO_STC12 },
-    
-    /* STC15系列 */
-    { 0xF410, "STC15F104E",     4096,   0, STC_PROTO_STC15A },
-    { 0xF411, "STC15F104W",     4096,   0, STC_PROTO_STC15A },
-    { 0xF440, "STC15L104E",     4096,   0, STC_PROTO_STC15A },
-    { 0xF441, "STC15L104W",     4096,   0, STC_PROTO_STC15A },
-    
-    { 0xF449, "STC15W408AS",    8192, 4096, STC_PROTO_STC15 },
-    { 0xF44D, "STC15W404AS",    4096, 4096, STC_PROTO_STC15 },
-    { 0xF44E, "STC15W401AS",    1024, 4096, STC_PROTO_STC15 },
-    { 0xF450, "STC15W4K64S4",  65536, 1024, STC_PROTO_STC15 },
-    { 0xF451, "STC15W4K56S4",  57344, 1024, STC_PROTO_STC15 },
-    { 0xF452, "STC15W4K48S4",  49152, 1024, STC_PROTO_STC15 },
-    { 0xF453, "STC15W4K40S4",  40960, 1024, STC_PROTO_STC15 },
-    { 0xF454, "STC15W4K32S4",  32768, 1024, STC_PROTO_STC15 },
-    { 0xF455, "STC15W4K16S4",  16384, 1024, STC_PROTO_STC15 },
-    
-    { 0xF488, "IAP15W4K61S4",  61440, 1024, STC_PROTO_STC15 },
-    { 0xF489, "IAP15W4K58S4",  59392, 1024, STC_PROTO_STC15 },
-    
-    /* STC8系列 */
-    { 0xF730, "STC8A8K64S4A12", 65536, 1024, STC_PROTO_STC8 },
-    { 0xF731, "STC8A8K60S4A12", 61440, 1024, STC_PROTO_STC8 },
-    { 0xF732, "STC8A8K56S4A12", 57344, 1024, STC_PROTO_STC8 },
-    { 0xF733, "STC8A8K52S4A12", 53248, 1024, STC_PROTO_STC8 },
-    { 0xF734, "STC8A8K48S4A12", 49152, 1024, STC_PROTO_STC8 },
-    { 0xF735, "STC8A8K32S4A12", 32768, 1024, STC_PROTO_STC8 },
-    { 0xF736, "STC8A8K16S4A12", 16384, 1024, STC_PROTO_STC8 },
-    
-    { 0xF7A0, "STC8G1K08",       8192, 1024, STC_PROTO_STC8 },
-    { 0xF7A1, "STC8G1K08A",      8192, 1024, STC_PROTO_STC8 },
-    { 0xF7A4, "STC8G1K12",      12288, 1024, STC_PROTO_STC8 },
-    { 0xF7A5, "STC8G1K12A",     12288, 1024, STC_PROTO_STC8 },
-    { 0xF7A8, "STC8G1K17",      17408, 1024, STC_PROTO_STC8 },
-    { 0xF7A9, "STC8G1K17A",     17408, 1024, STC_PROTO_STC8 },
-    
-    { 0xF7B0, "STC8G2K64S4",    65536, 1024, STC_PROTO_STC8 },
-    { 0xF7B1, "STC8G2K60S4",    61440, 1024, STC_PROTO_STC8 },
-    { 0xF7B2, "STC8G2K48S4",    49152, 1024, STC_PROTO_STC8 },
-    { 0xF7B3, "STC8G2K32S4",    32768, 1024, STC_PROTO_STC8 },
-    { 0xF7B4, "STC8G2K16S4",    16384, 1024, STC_PROTO_STC8 },
-    
-    /* STC8H系列 */
-    { 0xF7C0, "STC8H1K08",       8192, 4096, STC_PROTO_STC8G },
-    { 0xF7C1, "STC8H1K12",      12288, 4096, STC_PROTO_STC8G },
-    { 0xF7C2, "STC8H1K17",      17408, 4096, STC_PROTO_STC8G },
-    { 0xF7C3, "STC8H1K24",      24576, 4096, STC_PROTO_STC8G },
-    { 0xF7C4, "STC8H1K28",      28672, 4096, STC_PROTO_STC8G },
-    { 0xF7C5, "STC8H1K33",      33792, 4096, STC_PROTO_STC8G },
-    
-    { 0xF7D0, "STC8H3K64S4",    65536, 1024, STC_PROTO_STC8D },
-    { 0xF7D1, "STC8H3K64S2",    65536, 1024, STC_PROTO_STC8D },
-    { 0xF7D2, "STC8H3K60S4",    61440, 1024, STC_PROTO_STC8D },
-    { 0xF7D3, "STC8H3K60S2",    61440, 1024, STC_PROTO_STC8D },
-    { 0xF7D4, "STC8H3K48S4",    49152, 1024, STC_PROTO_STC8D },
-    { 0xF7D5, "STC8H3K48S2",    49152, 1024, STC_PROTO_STC8D },
-    { 0xF7D6, "STC8H3K32S4",    32768, 1024, STC_PROTO_STC8D },
-    { 0xF7D7, "STC8H3K32S2",    32768, 1024, STC_PROTO_STC8D },
-    
-    { 0xF7E0, "STC8H8K64U",     65536, 1024, STC_PROTO_STC8D },
-    { 0xF7E1, "STC8H8K60U",     61440, 1024, STC_PROTO_STC8D },
-    { 0xF7E2, "STC8H8K48U",     49152, 1024, STC_PROTO_STC8D },
-    { 0xF7E3, "STC8H8K32U",     32768, 1024, STC_PROTO_STC8D },
-    
-    /* STC32系列 */
-    { 0xF800, "STC32G12K128",  131072, 4096, STC_PROTO_STC32 },
-    { 0xF801, "STC32G11K128",  131072, 4096, STC_PROTO_STC32 },
-    { 0xF802, "STC32G10K128",  131072, 4096, STC_PROTO_STC32 },
-    { 0xF810, "STC32G8K64",     65536, 4096, STC_PROTO_STC32 },
-    { 0xF811, "STC32G8K48",     49152, 4096, STC_PROTO_STC32 },
-    { 0xF812, "STC32G8K32",     32768, 4096, STC_PROTO_STC32 },
-};
+typedef struct {
+    uint8_t     magic_lo;           // Magic低字节
+    uint8_t     prefix;             // 名称前缀编号
+    uint16_t    name;               // 后缀偏移 | 协议ID
+    uint16_t    size;               // Flash | EEPROM（512字节单位）
+} stc_model_packed_t;
+
+#define MODEL_SIZE_UNIT             512
+
+#define STC_MODEL_NAME(suffix, proto) \
+    ((uint16_t)((suffix) | ((proto) << 12)))
+#define STC_MODEL_SIZE(flash, eeprom) \
+    ((uint16_t)(((flash) / MODEL_SIZE_UNIT) | (((eeprom) / MODEL_SIZE_UNIT) << 9)))
 
-#define MODEL_DB_SIZE  (sizeof(g_model_db) / sizeof(g_model_db[0]))
+#define MODEL_SUFFIX(e)             ((e)->name & 0x0FFF)
+#define MODEL_PROTO(e)              ((stc_protocol_id_t)((e)->name >> 12))
+#define MODEL_FLASH(e)              ((uint32_t)((e)->size & 0x01FF) * MODEL_SIZE_UNIT)
+#define MODEL_EEPROM(e)             ((uint32_t)((e)->size >> 9) * MODEL_SIZE_UNIT)
+
+#include "stc_model_db_table.h"
+
+#define MODEL_DB_SIZE  STC_MODEL_DB_COUNT
 
 /*============================================================================
  * 字符串工具函数
@@ -310,28 +223,125 @@ static int match_pattern(const char* model_name, const char* pattern)
  * 型号数据库查询
  *============================================================================*/
 
-const stc_model_info_t* stc_find_model_by_magic(uint16_t magic)
+/**
+ * @brief 解包型号条目
+ * @param index 条目索引
+ * @param info 输出型号信息
+ */
+static void unpack_model(uint16_t index, stc_model_info_t* info)
+{
+    const stc_model_packed_t* e = &g_model_db[index];
+    const char* prefix = &g_model_name_pool[g_model_prefix[e->prefix]];
+    const char* suffix = &g_model_name_pool[MODEL_SUFFIX(e)];
+    uint8_t hi = STC_MODEL_MAGIC_HI_FIRST;
+    uint8_t n = 0;
+    
+    /* 所在的桶即Magic高字节 */
+    while (g_model_magic_start[hi - STC_MODEL_MAGIC_HI_FIRST + 1] <= index) {
+        hi++;
+    }
+    
+    while (*prefix && n < STC_MODEL_NAME_MAX - 1) {
+        info->name[n++] = *prefix++;
+    }
+    while (*suffix && n < STC_MODEL_NAME_MAX - 1) {
+        info->name[n++] = *suffix++;
+    }
+    info->name[n] = '\0';
+    
+    info->magic = ((uint16_t)hi << 8) | e->magic_lo;
+    info->flash_size = MODEL_FLASH(e);
+    info->eeprom_size = MODEL_EEPROM(e);
+    info->protocol_id = MODEL_PROTO(e);
+}
+
+/**
+ * @brief 比较条目名称与字符串（不解包，直接比较前缀+后缀）
+ * @param index 条目索引
+ * @param name 型号名称
+ * @return 与strcmp相同的符号约定
+ */
+static int compare_model_name(uint16_t index, const char* name)
+{
+    const stc_model_packed_t* e = &g_model_db[index];
+    const uint8_t* p = (const uint8_t*)&g_model_name_pool[g_model_prefix[e->prefix]];
+    const uint8_t* s = (const uint8_t*)name;
+    
+    while (*p && *p == *s) {
+        p++;
+        s++;
+    }
+    if (*p) {
+        return (int)*p - (int)*s;
+    }
+    
+    p = (const uint8_t*)&g_model_name_pool[MODEL_SUFFIX(e)];
+    while (*p && *p == *s) {
+        p++;
+        s++;
+    }
+    return (int)*p - (int)*s;
+}
+
+int stc_find_model_by_magic(uint16_t magic, stc_model_info_t* info)
 {
-    for (uint16_t i = 0; i < MODEL_DB_SIZE; i++) {
-        if (g_model_db[i].magic == magic) {
-            return &g_model_db[i];
+    if (info == NULL) {
+        return STC_ERR_INVALID_PARAM;
+    }
+    
+    uint8_t bucket = (uint8_t)((magic >> 8) - STC_MODEL_MAGIC_HI_FIRST);
+    uint8_t lo_byte = (uint8_t)magic;
+    
+    if (bucket >= STC_MODEL_MAGIC_BUCKETS) {
+        return STC_ERR_UNKNOWN_MODEL;
+    }
+    
+    /* 在高字节对应的桶内二分查找第一个magic_lo >= 目标值的条目
+     * （同Magic多型号时返回第一个） */
+    uint16_t lo = g_model_magic_start[bucket];
+    uint16_t end = g_model_magic_start[bucket + 1];
+    uint16_t top = end;
+    
+    while (lo < top) {
+        uint16_t mid = lo + (top - lo) / 2;
+        if (g_model_db[mid].magic_lo < lo_byte) {
+            lo = mid + 1;
+        } else {
+            top = mid;
         }
     }
-    return NULL;
+    
+    if (lo < end && g_model_db[lo].magic_lo == lo_byte) {
+        unpack_model(lo, info);
+        return STC_OK;
+    }
+    return STC_ERR_UNKNOWN_MODEL;
 }
 
-const stc_model_info_t* stc_find_model_by_name(const char* name)
+int stc_find_model_by_name(const char* name, stc_model_info_t* info)
 {
-    if (name == NULL) {
-        return NULL;
+    if (name == NULL || info == NULL) {
+        return STC_ERR_INVALID_PARAM;
     }
     
-    for (uint16_t i = 0; i < MODEL_DB_SIZE; i++) {
-        if (strcmp(g_model_db[i].name, name) == 0) {
-            return &g_model_db[i];
+    /* 在名称索引上二分查找 */
+    uint16_t lo = 0;
+    uint16_t hi = MODEL_DB_SIZE;
+    
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (compare_model_name(g_model_name_index[mid], name) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
-    return NULL;
+    
+    if (lo < MODEL_DB_SIZE && compare_model_name(g_model_name_index[lo], name) == 0) {
+        unpack_model(g_model_name_index[lo], info);
+        return STC_OK;
+    }
+    return STC_ERR_UNKNOWN_MODEL;
 }
 
 uint16_t stc_get_model_count(void)
@@ -339,12 +349,13 @@ uint16_t stc_get_model_count(void)
     return MODEL_DB_SIZE;
 }
 
-const stc_model_info_t* stc_get_model_by_index(uint16_t index)
+int stc_get_model_by_index(uint16_t index, stc_model_info_t* info)
 {
-    if (index >= MODEL_DB_SIZE) {
-        return NULL;
+    if (index >= MODEL_DB_SIZE || info == NULL) {
+        return STC_ERR_INVALID_PARAM;
     }
-    return &g_model_db[index];
+    unpack_model(index, info);
+    return STC_OK;
 }
 
 /*============================================================================
@@ -19,10 +19,10 @@ extern "C" {
  *============================================================================*/
 typedef struct {
     uint16_t        magic;          // MCU Magic值（型号识别码）
-    const char*     name;           // 型号名称
+    char            name[STC_MODEL_NAME_MAX]; // 型号名称
     uint32_t        flash_size;     // Flash大小（字节）
     uint32_t        eeprom_size;    // EEPROM大小（字节）
-    stc_protocol_id_t protocol_id;  // 对应的协议ID
+    stc_protocol_id_t protocol_id;  // 对应的协议ID（STC_PROTO_COUNT表示需手动选择）
 } stc_model_info_t;
 
 /*============================================================================
@@ -41,18 +41,20 @@ typedef struct {
  *============================================================================*/
 
 /**
- * @brief 根据Magic值查找型号信息
+ * @brief 根据Magic值查找型号信息（高字节分桶+二分查找）
  * @param magic MCU Magic值
- * @return 型号信息指针，NULL表示未找到
+ * @param info 输出型号信息（由打包表解出）
+ * @return STC_OK成功，STC_ERR_UNKNOWN_MODEL未找到
  */
-const stc_model_info_t* stc_find_model_by_magic(uint16_t magic);
+int stc_find_model_by_magic(uint16_t magic, stc_model_info_t* info);
 
 /**
- * @brief 根据型号名称查找型号信息
+ * @brief 根据型号名称查找型号信息（名称索引二分查找）
  * @param name 型号名称
- * @return 型号信息指针，NULL表示未找到
+ * @param info 输出型号信息（由打包表解出）
+ * @return STC_OK成功，STC_ERR_UNKNOWN_MODEL未找到
  */
-const stc_model_info_t* stc_find_model_by_name(const char* name);
+int stc_find_model_by_name(const char* name, stc_model_info_t* info);
 
 /**
  * @brief 获取型号数据库条目数
@@ -62,10 +64,11 @@ uint16_t stc_get_model_count(void);
 
 /**
  * @brief 获取型号数据库指定索引的型号
- * @param index 索引
- * @return 型号信息指针，NULL表示索引无效
+ * @param index 索引（按Magic值升序）
+ * @param info 输出型号信息（由打包表解出）
+ * @return STC_OK成功，STC_ERR_INVALID_PARAM索引无效
  */
-const stc_model_info_t* stc_get_model_by_index(uint16_t index);
+int stc_get_model_by_index(uint16_t index, stc_model_info_t* info);
 
 /*============================================================================
  * 协议注册表查询
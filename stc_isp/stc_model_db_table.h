@@ -0,0 +1,1386 @@
+/**
+ * @file stc_model_db_table.h
+ * @brief STC型号数据库表（由tools/gen_model_db.py自动生成，请勿手动修改）
+ *
+ * 数据来源: other/stcgal-master/stcgal/models.py
+ * 型号总数: 1140（其中86个需要手动选择协议）
+ * 字符串池: 3874字节，前缀71个
+ * 总占用:   约13232字节Flash
+ *
+ * 仅供stc_model_db.c包含使用
+ */
+
+#ifndef __STC_MODEL_DB_TABLE_H__
+#define __STC_MODEL_DB_TABLE_H__
+
+#define STC_MODEL_DB_COUNT      1140
+#define STC_MODEL_PREFIX_COUNT  71
+#define STC_MODEL_MAGIC_HI_FIRST 0xD1
+#define STC_MODEL_MAGIC_BUCKETS 47
+
+/*============================================================================
+ * 名称字符串池（后缀片段在前，前缀片段在后）
+ *============================================================================*/
+static const char g_model_name_pool[3874] =
+    "4K58S4-Student\0" "1K08T-Beta\0" "1K17T-Beta\0" "12K128-Beta\0"
+    "16F40K128-Beta\0" "8K64-Beta\0" "5A48X\0" "5A08X\0" "5A56X\0" "5A16X\0"
+    "06X\0" "14X\0" "04X\0" "62X\0" "5A52X\0" "5A32X\0" "12X\0" "02X\0"
+    "5A60X\0" "5A40X\0" "20X\0" "10X\0" "105SW\0" "104SW\0" "103SW\0" "102SW\0"
+    "101SW\0" "107W\0" "105W\0" "104W\0" "103W\0" "102W\0" "101W\0" "100W\0"
+    "06-5V\0" "48S2-5V\0" "08S2-5V\0" "56S2-5V\0" "16S2-5V\0" "62S2-5V\0"
+    "52S2-5V\0" "32S2-5V\0" "60S2-5V\0" "40S2-5V\0" "06-3V\0" "48S2-3V\0"
+    "08S2-3V\0" "56S2-3V\0" "16S2-3V\0" "62S2-3V\0" "52S2-3V\0" "32S2-3V\0"
+    "60S2-3V\0" "40S2-3V\0" "8K48U\0" "8K16U\0" "8K64U\0" "8K32U\0" "8K60U\0"
+    "1K08T\0" "1K17T\0" "1K06T\0" "1K04T\0" "1K12T\0" "1K02T\0" "1K10T\0"
+    "2K48AS\0" "1K48AS\0" "2K08AS\0" "1K08AS\0" "408AS\0" "2K56AS\0" "1K56AS\0"
+    "2K16AS\0" "1K16AS\0" "415AS\0" "2K24AS\0" "1K24AS\0" "414AS\0" "404AS\0"
+    "2K63AS\0" "1K63AS\0" "413AS\0" "2K32AS\0" "1K32AS\0" "412AS\0" "402AS\0"
+    "2K61AS\0" "1K61AS\0" "401AS\0" "2K60AS\0" "1K60AS\0" "2K40AS\0" "1K40AS\0"
+    "1K20AS\0" "410AS\0" "1K29S\0" "2K48S\0" "1K48S\0" "2K08S\0" "1K08S\0"
+    "408S\0" "207S\0" "2K56S\0" "1K56S\0" "2K16S\0" "1K16S\0" "415S\0" "205S\0"
+    "105S\0" "2K24S\0" "1K24S\0" "404S\0" "204S\0" "104S\0" "2K63S\0" "1K63S\0"
+    "413S\0" "203S\0" "103S\0" "2K32S\0" "1K32S\0" "412S\0" "202S\0" "102S\0"
+    "2K61S\0" "1K61S\0" "1K31S\0" "201S\0" "101S\0" "2K60S\0" "1K60S\0"
+    "2K40S\0" "1K40S\0" "1K20S\0" "410S\0" "4K48TLR\0" "4K16TLR\0" "4K64TLR\0"
+    "4K32TLR\0" "4K60TLR\0" "5A48CCP\0" "5A08CCP\0" "5A56CCP\0" "5A16CCP\0"
+    "5A62CCP\0" "5A52CCP\0" "5A32CCP\0" "5A60CCP\0" "5A40CCP\0" "1K08A-8PIN\0"
+    "1K17A-8PIN\0" "1K06A-8PIN\0" "1K04A-8PIN\0" "1K12A-8PIN\0" "1K02A-8PIN\0"
+    "1K10A-8PIN\0" "1K08-8PIN\0" "1K17-8PIN\0" "1K06-8PIN\0" "1K04-8PIN\0"
+    "1K12-8PIN\0" "1K02-8PIN\0" "1K10-8PIN\0" "1K08-20/16PIN\0"
+    "1K17-20/16PIN\0" "1K06-20/16PIN\0" "1K04-20/16PIN\0" "1K12-20/16PIN\0"
+    "1K02-20/16PIN\0" "1K10-20/16PIN\0" "1K08PWM\0" "1K16PWM\0" "5206PWM\0"
+    "5205PWM\0" "5204PWM\0" "5203PWM\0" "5202PWM\0" "5201PWM\0" "4K48TL\0"
+    "2K48TL\0" "4K16TL\0" "2K16TL\0" "4K64TL\0" "2K64TL\0" "4K32TL\0"
+    "2K32TL\0" "4K60TL\0" "2K60TL\0" "48XE\0" "08XE\0" "56XE\0" "16XE\0"
+    "06XE\0" "04XE\0" "52XE\0" "32XE\0" "12XE\0" "02XE\0" "60XE\0" "40XE\0"
+    "20XE\0" "10XE\0" "05E\0" "104E\0" "03E\0" "02E\0" "01E\0"
+    "516RD/LV516RD\0" "4K48TLCD\0" "2K48TLCD\0" "4K16TLCD\0" "2K16TLCD\0"
+    "4K64TLCD\0" "2K64TLCD\0" "4K32TLCD\0" "2K32TLCD\0" "4K60TLCD\0"
+    "2K60TLCD\0" "4K48LCD\0" "4K16LCD\0" "4K64LCD\0" "4K32LCD\0" "4K60LCD\0"
+    "58AD\0" "5A48AD\0" "5628AD\0" "5428AD\0" "5A08AD\0" "5608AD\0" "5408AD\0"
+    "5A56AD\0" "5A16AD\0" "5616AD\0" "516AD\0" "5416AD\0" "5606AD\0" "5406AD\0"
+    "5206AD\0" "55AD\0" "5605AD\0" "5205AD\0" "54AD\0" "5624AD\0" "5424AD\0"
+    "514AD\0" "5604AD\0" "5404AD\0" "5204AD\0" "513AD\0" "413AD\0" "5603AD\0"
+    "5203AD\0" "5A62AD\0" "5A52AD\0" "5052AD\0" "4052AD\0" "3052AD\0"
+    "2052AD\0" "1052AD\0" "5A32AD\0" "5612AD\0" "512AD\0" "5412AD\0" "5602AD\0"
+    "5402AD\0" "5202AD\0" "51AD\0" "5601AD\0" "5401AD\0" "5201AD\0" "5A60AD\0"
+    "5A40AD\0" "5630AD\0" "5620AD\0" "5420AD\0" "510AD\0" "5410AD\0"
+    "07RC/LE07RC\0" "06RC/LE06RC\0" "53RC/LE53RC\0" "52RC/LE52RC\0"
+    "12RC/LE12RC\0" "51RC/LE51RC\0" "10RC/LE10RC\0" "205EA\0" "204EA\0"
+    "207A\0" "12K59\0" "58\0" "8K48\0" "12K48\0" "5A48\0" "1K28\0" "5628\0"
+    "5428\0" "12K128\0" "1K08\0" "5A08\0" "5608\0" "5408\0" "1K17\0" "107\0"
+    "5A56\0" "8K16\0" "12K16\0" "1K16\0" "5A16\0" "5616\0" "516\0" "5416\0"
+    "1K06\0" "5606\0" "5406\0" "5206\0" "5605\0" "5205\0" "105\0" "4K58S4\0"
+    "4K48S4\0" "3K48S4\0" "2K48S4\0" "4K08S4\0" "2K08S4\0" "4K56S4\0"
+    "2K56S4\0" "4K16S4\0" "3K16S4\0" "2K16S4\0" "4K64S4\0" "3K64S4\0"
+    "2K64S4\0" "4K24S4\0" "2K24S4\0" "4K63S4\0" "4K62S4\0" "4K32S4\0"
+    "3K32S4\0" "2K32S4\0" "4K61S4\0" "3K60S4\0" "2K60S4\0" "4K40S4\0"
+    "2K40S4\0" "8K48D4\0" "2K48D4\0" "8K16D4\0" "2K16D4\0" "8K64D4\0"
+    "2K64D4\0" "8K32D4\0" "2K32D4\0" "8K60D4\0" "2K60D4\0" "8K64\0" "12K54\0"
+    "1K24\0" "5624\0" "5424\0" "514\0" "1K04\0" "5604\0" "5404\0" "5204\0"
+    "104\0" "53\0" "1K33\0" "5603\0" "5203\0" "103\0" "003\0" "3K48S2\0"
+    "2K48S2\0" "1K48S2\0" "5A48S2\0" "2K08S2\0" "1K08S2\0" "5A08S2\0"
+    "1K17S2\0" "2K56S2\0" "1K56S2\0" "5A56S2\0" "3K16S2\0" "2K16S2\0"
+    "1K16S2\0" "5A16S2\0" "1K06S2\0" "3K64S2\0" "2K64S2\0" "2K24S2\0"
+    "1K24S2\0" "1K04S2\0" "2K63S2\0" "1K63S2\0" "5A62S2\0" "5A52S2\0"
+    "3K32S2\0" "2K32S2\0" "1K32S2\0" "5A32S2\0" "1K12S2\0" "1K02S2\0"
+    "2K61S2\0" "1K61S2\0" "3K60S2\0" "2K60S2\0" "1K60S2\0" "5A60S2\0"
+    "2K40S2\0" "1K40S2\0" "5A40S2\0" "1K10S2\0" "5A62\0" "5A52\0" "5052\0"
+    "4052\0" "3052\0" "2052\0" "1052\0" "8K32\0" "12K32\0" "5A32\0" "1K12\0"
+    "8K48S4A12\0" "8K08S4A12\0" "8K56S4A12\0" "8K16S4A12\0" "8K64S4A12\0"
+    "8K24S4A12\0" "8K32S4A12\0" "8K60S4A12\0" "8K40S4A12\0" "4K48S2A12\0"
+    "4K08S2A12\0" "4K56S2A12\0" "4K16S2A12\0" "4K64S2A12\0" "4K24S2A12\0"
+    "4K32S2A12\0" "4K60S2A12\0" "4K40S2A12\0" "5612\0" "512\0" "5412\0" "012\0"
+    "1K02\0" "5602\0" "5402\0" "5202\0" "102\0" "-USB Writer1\0" "-USB Link1\0"
+    "51\0" "5601\0" "5401\0" "5201\0" "101\0" "8K60\0" "5A60\0" "5A40\0"
+    "5630\0" "1K20\0" "5620\0" "5420\0" "1K10\0" "510\0" "5410\0" "100\0"
+    "58RD+/LE58RD+\0" "516RD+/LE516RD+\0" "55RD+/LE55RD+\0" "54RD+/LE54RD+\0"
+    "514RD+/LE514RD+\0" "513RD+/LE513RD+\0" "52RD+/LE52RD+\0"
+    "512RD+/LE512RD+\0" "51RD+/LE51RD+\0" "510RD+/LE510RD+\0" "IAP14X\0"
+    "IAP62X\0" "IAP15W\0" "STC15W\0" "IRC15W\0" "GX8S\0" "IAP\0" "IAP15L\0"
+    "STC15L\0" "IRC15L\0" "IAP11L\0" "STC11L\0" "IAP10L\0" "STC10L\0" "STC8H\0"
+    "STC15H\0" "STC12H\0" "STC8G\0" "STC32G\0" "STC8F\0" "IAP15F\0" "STC15F\0"
+    "IRC15F\0" "STC32F\0" "IAP11F\0" "STC11F\0" "IAP10F\0" "STC10F\0"
+    "STC48XE\0" "STC08XE\0" "STC56XE\0" "STC16XE\0" "STC06XE\0" "STC04XE\0"
+    "STC52XE\0" "STC32XE\0" "STC12XE\0" "STC02XE\0" "STC60XE\0" "STC40XE\0"
+    "STC20XE\0" "STC10XE\0" "STC89LE\0" "IAP12LE\0" "STC12LE\0" "STC90LE\0"
+    "STC05E\0" "STC04E\0" "STC03E\0" "STC02E\0" "STC01E\0" "STC608AD\0"
+    "IAP616AD\0" "STC616AD\0" "STC5206AD\0" "STC5205AD\0" "STC5204AD\0"
+    "STC5203AD\0" "STC5202AD\0" "STC5201AD\0" "STC\0" "STC89C\0" "STC8C\0"
+    "IAP12C\0" "STC12C\0" "STC90C\0" "STC8A\0" "IAP5A\0" "STC5A\0" "U8\0"
+    "U7\0";
+
+/*============================================================================
+ * 名称前缀偏移表（条目prefix字段的下标）
+ *============================================================================*/
+static const uint16_t g_model_prefix[STC_MODEL_PREFIX_COUNT] = {
+     3358,  3365,  3372,  3379,  3386,  3393,  3398,  3402,  3409,  3416,
+     3423,  3430,  3437,  3444,  3451,  3457,  3464,  3471,  3477,  3484,
+     3490,  3497,  3504,  3511,  3518,  3525,  3532,  3539,  3546,  3554,
+     3562,  3570,  3578,  3586,  3594,  3602,  3610,  3618,  3626,  3634,
+     3642,  3650,  3658,  3666,  3674,  3682,  3690,  3697,  3704,  3711,
+     3718,  3725,  3734,  3743,  3752,  3762,  3772,  3782,  3792,  3802,
+     3812,  3816,  3823,  3829,  3836,  3843,  3850,  3856,  3862,  3868,
+     3871,
+};
+
+/*============================================================================
+ * Magic高字节分桶：高字节为(STC_MODEL_MAGIC_HI_FIRST + i)的型号位于
+ * g_model_db[g_model_magic_start[i]] ~ g_model_db[g_model_magic_start[i + 1] - 1]
+ *============================================================================*/
+static const uint16_t g_model_magic_start[STC_MODEL_MAGIC_BUCKETS + 1] = {
+       0,  154,  232,  364,  364,  364,  364,  364,  364,  364,
+     364,  364,  364,  364,  364,  364,  408,  456,  510,  510,
+     510,  510,  568,  568,  568,  568,  568,  568,  568,  568,
+     568,  568,  597,  659,  716,  722,  854,  911,  978, 1084,
+    1139, 1139, 1139, 1139, 1139, 1139, 1139, 1140,
+};
+
+/*============================================================================
+ * 型号表（按Magic值升序）
+ *============================================================================*/
+static const stc_model_packed_t g_model_db[STC_MODEL_DB_COUNT] = {
+    { 0x03,  63, STC_MODEL_NAME(2114, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D103 IAP12C5A08 */
+    { 0x04,  64, STC_MODEL_NAME(  80, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D104 STC12C5A08X */
+    { 0x07,  63, STC_MODEL_NAME(2159, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D107 IAP12C5A16 */
+    { 0x08,  64, STC_MODEL_NAME(  92, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D108 STC12C5A16X */
+    { 0x0F,  63, STC_MODEL_NAME(2877, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D10F IAP12C5A32 */
+    { 0x10,  64, STC_MODEL_NAME( 120, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D110 STC12C5A32X */
+    { 0x13,  63, STC_MODEL_NAME(3165, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D113 IAP12C5A40 */
+    { 0x14,  64, STC_MODEL_NAME( 140, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D114 STC12C5A40X */
+    { 0x17,  63, STC_MODEL_NAME(2082, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D117 IAP12C5A48 */
+    { 0x18,  64, STC_MODEL_NAME(  74, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D118 STC12C5A48X */
+    { 0x19,  63, STC_MODEL_NAME(2836, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D119 IAP12C5A52 */
+    { 0x1A,  64, STC_MODEL_NAME( 114, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D11A STC12C5A52X */
+    { 0x1B,  63, STC_MODEL_NAME(2138, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D11B IAP12C5A56 */
+    { 0x1C,  64, STC_MODEL_NAME(  86, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D11C STC12C5A56X */
+    { 0x1D,  63, STC_MODEL_NAME(3160, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D11D IAP12C5A60 */
+    { 0x1E,  64, STC_MODEL_NAME( 134, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D11E STC12C5A60X */
+    { 0x1F,  63, STC_MODEL_NAME(2831, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D11F IAP12C5A62 */
+    { 0x23,  63, STC_MODEL_NAME( 919, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D123 IAP12C5A08CCP */
+    { 0x24,  64, STC_MODEL_NAME( 919, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 55296) },  /* D124 STC12C5A08CCP */
+    { 0x27,  63, STC_MODEL_NAME( 935, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D127 IAP12C5A16CCP */
+    { 0x28,  64, STC_MODEL_NAME( 935, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 47104) },  /* D128 STC12C5A16CCP */
+    { 0x2F,  63, STC_MODEL_NAME( 959, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D12F IAP12C5A32CCP */
+    { 0x30,  64, STC_MODEL_NAME( 959, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768, 30720) },  /* D130 STC12C5A32CCP */
+    { 0x33,  63, STC_MODEL_NAME( 975, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D133 IAP12C5A40CCP */
+    { 0x34,  64, STC_MODEL_NAME( 975, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960, 22528) },  /* D134 STC12C5A40CCP */
+    { 0x37,  63, STC_MODEL_NAME( 911, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D137 IAP12C5A48CCP */
+    { 0x38,  64, STC_MODEL_NAME( 911, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152, 14336) },  /* D138 STC12C5A48CCP */
+    { 0x39,  63, STC_MODEL_NAME( 951, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D139 IAP12C5A52CCP */
+    { 0x3A,  64, STC_MODEL_NAME( 951, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248, 10240) },  /* D13A STC12C5A52CCP */
+    { 0x3B,  63, STC_MODEL_NAME( 927, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D13B IAP12C5A56CCP */
+    { 0x3C,  64, STC_MODEL_NAME( 927, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,  6144) },  /* D13C STC12C5A56CCP */
+    { 0x3D,  63, STC_MODEL_NAME( 967, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D13D IAP12C5A60CCP */
+    { 0x3E,  64, STC_MODEL_NAME( 967, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,  2048) },  /* D13E STC12C5A60CCP */
+    { 0x3F,  63, STC_MODEL_NAME( 943, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D13F IAP12C5A62CCP */
+    { 0x43,  63, STC_MODEL_NAME(1623, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D143 IAP12C5A08AD */
+    { 0x44,  64, STC_MODEL_NAME(1623, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 55296) },  /* D144 STC12C5A08AD */
+    { 0x47,  63, STC_MODEL_NAME(1651, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D147 IAP12C5A16AD */
+    { 0x48,  64, STC_MODEL_NAME(1651, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 47104) },  /* D148 STC12C5A16AD */
+    { 0x4F,  63, STC_MODEL_NAME(1839, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D14F IAP12C5A32AD */
+    { 0x50,  64, STC_MODEL_NAME(1839, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768, 30720) },  /* D150 STC12C5A32AD */
+    { 0x53,  63, STC_MODEL_NAME(1920, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D153 IAP12C5A40AD */
+    { 0x54,  64, STC_MODEL_NAME(1920, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960, 22528) },  /* D154 STC12C5A40AD */
+    { 0x57,  63, STC_MODEL_NAME(1602, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D157 IAP12C5A48AD */
+    { 0x58,  64, STC_MODEL_NAME(1602, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152, 14336) },  /* D158 STC12C5A48AD */
+    { 0x59,  63, STC_MODEL_NAME(1797, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D159 IAP12C5A52AD */
+    { 0x5A,  64, STC_MODEL_NAME(1797, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248, 10240) },  /* D15A STC12C5A52AD */
+    { 0x5B,  63, STC_MODEL_NAME(1644, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D15B IAP12C5A56AD */
+    { 0x5C,  64, STC_MODEL_NAME(1644, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,  6144) },  /* D15C STC12C5A56AD */
+    { 0x5D,  63, STC_MODEL_NAME(1913, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D15D IAP12C5A60AD */
+    { 0x5E,  64, STC_MODEL_NAME(1913, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,  2048) },  /* D15E STC12C5A60AD */
+    { 0x5F,  63, STC_MODEL_NAME(1790, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D15F IAP12C5A62AD */
+    { 0x60,  68, STC_MODEL_NAME( 233, STC_PROTO_COUNT ), STC_MODEL_SIZE(  8192, 55296) },  /* D160 STC5A08S2-5V */
+    { 0x61,  68, STC_MODEL_NAME( 249, STC_PROTO_COUNT ), STC_MODEL_SIZE( 16384, 47104) },  /* D161 STC5A16S2-5V */
+    { 0x62,  68, STC_MODEL_NAME( 273, STC_PROTO_COUNT ), STC_MODEL_SIZE( 32768, 30720) },  /* D162 STC5A32S2-5V */
+    { 0x63,  63, STC_MODEL_NAME(2586, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D163 IAP12C5A08S2 */
+    { 0x64,  64, STC_MODEL_NAME(2586, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 55296) },  /* D164 STC12C5A08S2 */
+    { 0x65,  68, STC_MODEL_NAME( 289, STC_PROTO_COUNT ), STC_MODEL_SIZE( 40960, 22528) },  /* D165 STC5A40S2-5V */
+    { 0x66,  68, STC_MODEL_NAME( 225, STC_PROTO_COUNT ), STC_MODEL_SIZE( 49152, 14336) },  /* D166 STC5A48S2-5V */
+    { 0x67,  63, STC_MODEL_NAME(2642, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D167 IAP12C5A16S2 */
+    { 0x68,  64, STC_MODEL_NAME(2642, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 47104) },  /* D168 STC12C5A16S2 */
+    { 0x69,  68, STC_MODEL_NAME( 265, STC_PROTO_COUNT ), STC_MODEL_SIZE( 53248, 10240) },  /* D169 STC5A52S2-5V */
+    { 0x6A,  68, STC_MODEL_NAME( 241, STC_PROTO_COUNT ), STC_MODEL_SIZE( 57344,  6144) },  /* D16A STC5A56S2-5V */
+    { 0x6B,  68, STC_MODEL_NAME( 281, STC_PROTO_COUNT ), STC_MODEL_SIZE( 61440,  2048) },  /* D16B STC5A60S2-5V */
+    { 0x6C,  67, STC_MODEL_NAME( 257, STC_PROTO_COUNT ), STC_MODEL_SIZE( 63488,     0) },  /* D16C IAP5A62S2-5V */
+    { 0x6F,  63, STC_MODEL_NAME(2740, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D16F IAP12C5A32S2 */
+    { 0x70,  64, STC_MODEL_NAME(2740, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768, 30720) },  /* D170 STC12C5A32S2 */
+    { 0x73,  63, STC_MODEL_NAME(2817, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D173 IAP12C5A40S2 */
+    { 0x74,  64, STC_MODEL_NAME(2817, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960, 22528) },  /* D174 STC12C5A40S2 */
+    { 0x77,  63, STC_MODEL_NAME(2565, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D177 IAP12C5A48S2 */
+    { 0x78,  64, STC_MODEL_NAME(2565, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152, 14336) },  /* D178 STC12C5A48S2 */
+    { 0x79,  63, STC_MODEL_NAME(2712, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D179 IAP12C5A52S2 */
+    { 0x7A,  64, STC_MODEL_NAME(2712, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248, 10240) },  /* D17A STC12C5A52S2 */
+    { 0x7B,  63, STC_MODEL_NAME(2614, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D17B IAP12C5A56S2 */
+    { 0x7C,  64, STC_MODEL_NAME(2614, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,  6144) },  /* D17C STC12C5A56S2 */
+    { 0x7D,  63, STC_MODEL_NAME(2796, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D17D IAP12C5A60S2 */
+    { 0x7E,  64, STC_MODEL_NAME(2796, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,  2048) },  /* D17E STC12C5A60S2 */
+    { 0x7F,  63, STC_MODEL_NAME(2705, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D17F IAP12C5A62S2 */
+    { 0x83,  43, STC_MODEL_NAME(2114, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D183 IAP12LE5A08 */
+    { 0x84,  44, STC_MODEL_NAME(  80, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D184 STC12LE5A08X */
+    { 0x87,  43, STC_MODEL_NAME(2159, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D187 IAP12LE5A16 */
+    { 0x88,  44, STC_MODEL_NAME(  92, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D188 STC12LE5A16X */
+    { 0x8F,  43, STC_MODEL_NAME(2877, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D18F IAP12LE5A32 */
+    { 0x90,  44, STC_MODEL_NAME( 120, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D190 STC12LE5A32X */
+    { 0x93,  43, STC_MODEL_NAME(3165, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D193 IAP12LE5A40 */
+    { 0x94,  44, STC_MODEL_NAME( 140, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D194 STC12LE5A40X */
+    { 0x97,  43, STC_MODEL_NAME(2082, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D197 IAP12LE5A48 */
+    { 0x98,  44, STC_MODEL_NAME(  74, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D198 STC12LE5A48X */
+    { 0x99,  43, STC_MODEL_NAME(2836, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D199 IAP12LE5A52 */
+    { 0x9A,  44, STC_MODEL_NAME( 114, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D19A STC12LE5A52X */
+    { 0x9B,  43, STC_MODEL_NAME(2138, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D19B IAP12LE5A56 */
+    { 0x9C,  44, STC_MODEL_NAME(  86, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D19C STC12LE5A56X */
+    { 0x9D,  43, STC_MODEL_NAME(3160, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D19D IAP12LE5A60 */
+    { 0x9E,  44, STC_MODEL_NAME( 134, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D19E STC12LE5A60X */
+    { 0x9F,  43, STC_MODEL_NAME(2831, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D19F IAP12LE5A62 */
+    { 0xA3,  43, STC_MODEL_NAME( 919, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D1A3 IAP12LE5A08CCP */
+    { 0xA4,  44, STC_MODEL_NAME( 919, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 55296) },  /* D1A4 STC12LE5A08CCP */
+    { 0xA7,  43, STC_MODEL_NAME( 935, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D1A7 IAP12LE5A16CCP */
+    { 0xA8,  44, STC_MODEL_NAME( 935, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 47104) },  /* D1A8 STC12LE5A16CCP */
+    { 0xAF,  43, STC_MODEL_NAME( 959, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D1AF IAP12LE5A32CCP */
+    { 0xB0,  44, STC_MODEL_NAME( 959, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768, 30720) },  /* D1B0 STC12LE5A32CCP */
+    { 0xB3,  43, STC_MODEL_NAME( 975, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D1B3 IAP12LE5A40CCP */
+    { 0xB4,  44, STC_MODEL_NAME( 975, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960, 22528) },  /* D1B4 STC12LE5A40CCP */
+    { 0xB7,  43, STC_MODEL_NAME( 911, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D1B7 IAP12LE5A48CCP */
+    { 0xB8,  44, STC_MODEL_NAME( 911, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152, 14336) },  /* D1B8 STC12LE5A48CCP */
+    { 0xB9,  43, STC_MODEL_NAME( 951, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D1B9 IAP12LE5A52CCP */
+    { 0xBA,  44, STC_MODEL_NAME( 951, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248, 10240) },  /* D1BA STC12LE5A52CCP */
+    { 0xBB,  43, STC_MODEL_NAME( 927, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D1BB IAP12LE5A56CCP */
+    { 0xBC,  44, STC_MODEL_NAME( 927, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,  6144) },  /* D1BC STC12LE5A56CCP */
+    { 0xBD,  43, STC_MODEL_NAME( 967, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D1BD IAP12LE5A60CCP */
+    { 0xBE,  44, STC_MODEL_NAME( 967, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,  2048) },  /* D1BE STC12LE5A60CCP */
+    { 0xBF,  43, STC_MODEL_NAME( 943, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D1BF IAP12LE5A62CCP */
+    { 0xC3,  43, STC_MODEL_NAME(1623, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D1C3 IAP12LE5A08AD */
+    { 0xC4,  44, STC_MODEL_NAME(1623, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 55296) },  /* D1C4 STC12LE5A08AD */
+    { 0xC7,  43, STC_MODEL_NAME(1651, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D1C7 IAP12LE5A16AD */
+    { 0xC8,  44, STC_MODEL_NAME(1651, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 47104) },  /* D1C8 STC12LE5A16AD */
+    { 0xCF,  43, STC_MODEL_NAME(1839, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D1CF IAP12LE5A32AD */
+    { 0xD0,  44, STC_MODEL_NAME(1839, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768, 30720) },  /* D1D0 STC12LE5A32AD */
+    { 0xD3,  43, STC_MODEL_NAME(1920, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D1D3 IAP12LE5A40AD */
+    { 0xD4,  44, STC_MODEL_NAME(1920, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960, 22528) },  /* D1D4 STC12LE5A40AD */
+    { 0xD7,  43, STC_MODEL_NAME(1602, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D1D7 IAP12LE5A48AD */
+    { 0xD8,  44, STC_MODEL_NAME(1602, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152, 14336) },  /* D1D8 STC12LE5A48AD */
+    { 0xD9,  43, STC_MODEL_NAME(1797, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D1D9 IAP12LE5A52AD */
+    { 0xDA,  44, STC_MODEL_NAME(1797, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248, 10240) },  /* D1DA STC12LE5A52AD */
+    { 0xDB,  43, STC_MODEL_NAME(1644, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D1DB IAP12LE5A56AD */
+    { 0xDC,  44, STC_MODEL_NAME(1644, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,  6144) },  /* D1DC STC12LE5A56AD */
+    { 0xDD,  43, STC_MODEL_NAME(1913, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D1DD IAP12LE5A60AD */
+    { 0xDE,  44, STC_MODEL_NAME(1913, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,  2048) },  /* D1DE STC12LE5A60AD */
+    { 0xDF,  43, STC_MODEL_NAME(1790, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D1DF IAP12LE5A62AD */
+    { 0xE0,  68, STC_MODEL_NAME( 311, STC_PROTO_COUNT ), STC_MODEL_SIZE(  8192, 55296) },  /* D1E0 STC5A08S2-3V */
+    { 0xE1,  68, STC_MODEL_NAME( 327, STC_PROTO_COUNT ), STC_MODEL_SIZE( 16384, 47104) },  /* D1E1 STC5A16S2-3V */
+    { 0xE2,  68, STC_MODEL_NAME( 351, STC_PROTO_COUNT ), STC_MODEL_SIZE( 32768, 30720) },  /* D1E2 STC5A32S2-3V */
+    { 0xE3,  43, STC_MODEL_NAME(2586, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D1E3 IAP12LE5A08S2 */
+    { 0xE4,  44, STC_MODEL_NAME(2586, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 55296) },  /* D1E4 STC12LE5A08S2 */
+    { 0xE5,  68, STC_MODEL_NAME( 367, STC_PROTO_COUNT ), STC_MODEL_SIZE( 40960, 22528) },  /* D1E5 STC5A40S2-3V */
+    { 0xE6,  68, STC_MODEL_NAME( 303, STC_PROTO_COUNT ), STC_MODEL_SIZE( 49152, 14336) },  /* D1E6 STC5A48S2-3V */
+    { 0xE7,  43, STC_MODEL_NAME(2642, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D1E7 IAP12LE5A16S2 */
+    { 0xE8,  44, STC_MODEL_NAME(2642, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 47104) },  /* D1E8 STC12LE5A16S2 */
+    { 0xE9,  68, STC_MODEL_NAME( 343, STC_PROTO_COUNT ), STC_MODEL_SIZE( 53248, 10240) },  /* D1E9 STC5A52S2-3V */
+    { 0xEA,  68, STC_MODEL_NAME( 319, STC_PROTO_COUNT ), STC_MODEL_SIZE( 57344,  6144) },  /* D1EA STC5A56S2-3V */
+    { 0xEB,  68, STC_MODEL_NAME( 359, STC_PROTO_COUNT ), STC_MODEL_SIZE( 61440,  2048) },  /* D1EB STC5A60S2-3V */
+    { 0xEC,  67, STC_MODEL_NAME( 335, STC_PROTO_COUNT ), STC_MODEL_SIZE( 63488,     0) },  /* D1EC IAP5A62S2-3V */
+    { 0xEF,  43, STC_MODEL_NAME(2740, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D1EF IAP12LE5A32S2 */
+    { 0xF0,  44, STC_MODEL_NAME(2740, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768, 30720) },  /* D1F0 STC12LE5A32S2 */
+    { 0xF3,  43, STC_MODEL_NAME(2817, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D1F3 IAP12LE5A40S2 */
+    { 0xF4,  44, STC_MODEL_NAME(2817, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960, 22528) },  /* D1F4 STC12LE5A40S2 */
+    { 0xF7,  43, STC_MODEL_NAME(2565, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D1F7 IAP12LE5A48S2 */
+    { 0xF8,  44, STC_MODEL_NAME(2565, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152, 14336) },  /* D1F8 STC12LE5A48S2 */
+    { 0xF9,  43, STC_MODEL_NAME(2712, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D1F9 IAP12LE5A52S2 */
+    { 0xFA,  44, STC_MODEL_NAME(2712, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248, 10240) },  /* D1FA STC12LE5A52S2 */
+    { 0xFB,  43, STC_MODEL_NAME(2614, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D1FB IAP12LE5A56S2 */
+    { 0xFC,  44, STC_MODEL_NAME(2614, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,  6144) },  /* D1FC STC12LE5A56S2 */
+    { 0xFD,  43, STC_MODEL_NAME(2796, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D1FD IAP12LE5A60S2 */
+    { 0xFE,  44, STC_MODEL_NAME(2796, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,  2048) },  /* D1FE STC12LE5A60S2 */
+    { 0xFF,  43, STC_MODEL_NAME(2705, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D1FF IAP12LE5A62S2 */
+    { 0x02,  27, STC_MODEL_NAME(3106, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* D202 STC10F02 */
+    { 0x04,  27, STC_MODEL_NAME(2515, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* D204 STC10F04 */
+    { 0x06,  27, STC_MODEL_NAME(2195, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* D206 STC10F06 */
+    { 0x08,  27, STC_MODEL_NAME(2126, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D208 STC10F08 */
+    { 0x0A,  27, STC_MODEL_NAME(3201, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,     0) },  /* D20A STC10F10 */
+    { 0x0C,  27, STC_MODEL_NAME(3082, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* D20C STC10F12 */
+    { 0x32,  26, STC_MODEL_NAME(3106, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* D232 IAP10F02 */
+    { 0x34,  26, STC_MODEL_NAME(2515, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* D234 IAP10F04 */
+    { 0x36,  26, STC_MODEL_NAME(2195, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* D236 IAP10F06 */
+    { 0x38,  26, STC_MODEL_NAME(2126, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D238 IAP10F08 */
+    { 0x3A,  26, STC_MODEL_NAME(3201, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,     0) },  /* D23A IAP10F10 */
+    { 0x3C,  26, STC_MODEL_NAME(3082, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* D23C IAP10F12 */
+    { 0x3E,  26, STC_MODEL_NAME(2491, STC_PROTO_STC12 ), STC_MODEL_SIZE( 14336,     0) },  /* D23E IAP10F14 */
+    { 0x42,  27, STC_MODEL_NAME( 130, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* D242 STC10F02X */
+    { 0x44,  27, STC_MODEL_NAME( 106, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* D244 STC10F04X */
+    { 0x46,  27, STC_MODEL_NAME(  98, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* D246 STC10F06X */
+    { 0x48,  27, STC_MODEL_NAME(  82, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D248 STC10F08X */
+    { 0x4A,  27, STC_MODEL_NAME( 150, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,     0) },  /* D24A STC10F10X */
+    { 0x4C,  27, STC_MODEL_NAME( 126, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* D24C STC10F12X */
+    { 0x60,  37, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  2048, 12288) },  /* D260 STC02XE-5V */
+    { 0x61,  33, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  4096, 10240) },  /* D261 STC04XE-5V */
+    { 0x62,  27, STC_MODEL_NAME(1407, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048, 12288) },  /* D262 STC10F02XE */
+    { 0x63,  32, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  6144,  8192) },  /* D263 STC06XE-5V */
+    { 0x64,  27, STC_MODEL_NAME(1387, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 10240) },  /* D264 STC10F04XE */
+    { 0x65,  29, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  8192,  6144) },  /* D265 STC08XE-5V */
+    { 0x66,  27, STC_MODEL_NAME(1382, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,  8192) },  /* D266 STC10F06XE */
+    { 0x67,  41, STC_MODEL_NAME( 293, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,  4096) },  /* D267 STC10XE-5V */
+    { 0x68,  27, STC_MODEL_NAME(1367, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,  6144) },  /* D268 STC10F08XE */
+    { 0x69,  36, STC_MODEL_NAME( 293, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,  2048) },  /* D269 STC12XE-5V */
+    { 0x6A,  27, STC_MODEL_NAME(1427, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,  4096) },  /* D26A STC10F10XE */
+    { 0x6B,   0, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 14336,     0) },  /* D26B IAP14X-5V */
+    { 0x6C,  27, STC_MODEL_NAME(1402, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,  2048) },  /* D26C STC10F12XE */
+    { 0x72,  26, STC_MODEL_NAME(1407, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* D272 IAP10F02XE */
+    { 0x74,  26, STC_MODEL_NAME(1387, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* D274 IAP10F04XE */
+    { 0x76,  26, STC_MODEL_NAME(1382, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* D276 IAP10F06XE */
+    { 0x78,  26, STC_MODEL_NAME(1367, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D278 IAP10F08XE */
+    { 0x7A,  26, STC_MODEL_NAME(1427, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,     0) },  /* D27A IAP10F10XE */
+    { 0x7C,  26, STC_MODEL_NAME(1402, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* D27C IAP10F12XE */
+    { 0x7E,  26, STC_MODEL_NAME( 102, STC_PROTO_STC12 ), STC_MODEL_SIZE( 14336,     0) },  /* D27E IAP10F14X */
+    { 0x82,  13, STC_MODEL_NAME(3106, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* D282 STC10L02 */
+    { 0x84,  13, STC_MODEL_NAME(2515, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* D284 STC10L04 */
+    { 0x86,  13, STC_MODEL_NAME(2195, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* D286 STC10L06 */
+    { 0x88,  13, STC_MODEL_NAME(2126, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D288 STC10L08 */
+    { 0x8A,  13, STC_MODEL_NAME(3201, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,     0) },  /* D28A STC10L10 */
+    { 0x8C,  13, STC_MODEL_NAME(3082, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* D28C STC10L12 */
+    { 0xB2,  12, STC_MODEL_NAME(3106, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* D2B2 IAP10L02 */
+    { 0xB4,  12, STC_MODEL_NAME(2515, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* D2B4 IAP10L04 */
+    { 0xB6,  12, STC_MODEL_NAME(2195, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* D2B6 IAP10L06 */
+    { 0xB8,  12, STC_MODEL_NAME(2126, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D2B8 IAP10L08 */
+    { 0xBA,  12, STC_MODEL_NAME(3201, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,     0) },  /* D2BA IAP10L10 */
+    { 0xBC,  12, STC_MODEL_NAME(3082, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* D2BC IAP10L12 */
+    { 0xBE,  12, STC_MODEL_NAME(2491, STC_PROTO_STC12 ), STC_MODEL_SIZE( 14336,     0) },  /* D2BE IAP10L14 */
+    { 0xC2,  13, STC_MODEL_NAME( 130, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* D2C2 STC10L02X */
+    { 0xC4,  13, STC_MODEL_NAME( 106, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* D2C4 STC10L04X */
+    { 0xC6,  13, STC_MODEL_NAME(  98, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* D2C6 STC10L06X */
+    { 0xC8,  13, STC_MODEL_NAME(  82, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D2C8 STC10L08X */
+    { 0xCA,  13, STC_MODEL_NAME( 150, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,     0) },  /* D2CA STC10L10X */
+    { 0xCC,  13, STC_MODEL_NAME( 126, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* D2CC STC10L12X */
+    { 0xE0,  37, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  2048, 12288) },  /* D2E0 STC02XE-3V */
+    { 0xE1,  33, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  4096, 10240) },  /* D2E1 STC04XE-3V */
+    { 0xE2,  13, STC_MODEL_NAME(1407, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048, 12288) },  /* D2E2 STC10L02XE */
+    { 0xE3,  32, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  6144,  8192) },  /* D2E3 STC06XE-3V */
+    { 0xE4,  13, STC_MODEL_NAME(1387, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 10240) },  /* D2E4 STC10L04XE */
+    { 0xE5,  29, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  8192,  6144) },  /* D2E5 STC08XE-3V */
+    { 0xE6,  13, STC_MODEL_NAME(1382, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,  8192) },  /* D2E6 STC10L06XE */
+    { 0xE7,  41, STC_MODEL_NAME( 371, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,  4096) },  /* D2E7 STC10XE-3V */
+    { 0xE8,  13, STC_MODEL_NAME(1367, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,  6144) },  /* D2E8 STC10L08XE */
+    { 0xE9,  36, STC_MODEL_NAME( 371, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,  2048) },  /* D2E9 STC12XE-3V */
+    { 0xEA,  13, STC_MODEL_NAME(1427, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,  4096) },  /* D2EA STC10L10XE */
+    { 0xEB,   0, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 14336,     0) },  /* D2EB IAP14X-3V */
+    { 0xEC,  13, STC_MODEL_NAME(1402, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,  2048) },  /* D2EC STC10L12XE */
+    { 0xF2,  12, STC_MODEL_NAME(1407, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* D2F2 IAP10L02XE */
+    { 0xF4,  12, STC_MODEL_NAME(1387, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* D2F4 IAP10L04XE */
+    { 0xF6,  12, STC_MODEL_NAME(1382, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* D2F6 IAP10L06XE */
+    { 0xF8,  12, STC_MODEL_NAME(1367, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D2F8 IAP10L08XE */
+    { 0xFA,  12, STC_MODEL_NAME(1427, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240,     0) },  /* D2FA IAP10L10XE */
+    { 0xFC,  12, STC_MODEL_NAME(1402, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* D2FC IAP10L12XE */
+    { 0xFE,  12, STC_MODEL_NAME( 102, STC_PROTO_STC12 ), STC_MODEL_SIZE( 14336,     0) },  /* D2FE IAP10L14X */
+    { 0x03,  24, STC_MODEL_NAME(2126, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D303 IAP11F08 */
+    { 0x04,  25, STC_MODEL_NAME(2126, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D304 STC11F08 */
+    { 0x07,  24, STC_MODEL_NAME(2175, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D307 IAP11F16 */
+    { 0x08,  25, STC_MODEL_NAME(2175, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D308 STC11F16 */
+    { 0x09,  24, STC_MODEL_NAME(3187, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,     0) },  /* D309 IAP11F20 */
+    { 0x0A,  25, STC_MODEL_NAME(3187, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,     0) },  /* D30A STC11F20 */
+    { 0x0F,  24, STC_MODEL_NAME(2879, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D30F IAP11F32 */
+    { 0x10,  25, STC_MODEL_NAME(2879, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D310 STC11F32 */
+    { 0x13,  24, STC_MODEL_NAME(3167, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D313 IAP11F40 */
+    { 0x14,  25, STC_MODEL_NAME(3167, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D314 STC11F40 */
+    { 0x17,  24, STC_MODEL_NAME(2084, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D317 IAP11F48 */
+    { 0x18,  25, STC_MODEL_NAME(2084, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D318 STC11F48 */
+    { 0x19,  24, STC_MODEL_NAME(2863, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D319 IAP11F52 */
+    { 0x1A,  25, STC_MODEL_NAME(2863, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D31A STC11F52 */
+    { 0x1B,  24, STC_MODEL_NAME(2140, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D31B IAP11F56 */
+    { 0x1C,  25, STC_MODEL_NAME(2140, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D31C STC11F56 */
+    { 0x1D,  24, STC_MODEL_NAME(3162, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D31D IAP11F60 */
+    { 0x1E,  25, STC_MODEL_NAME(3162, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D31E STC11F60 */
+    { 0x1F,  24, STC_MODEL_NAME(2833, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D31F IAP11F62 */
+    { 0x43,  24, STC_MODEL_NAME(  82, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D343 IAP11F08X */
+    { 0x44,  25, STC_MODEL_NAME(  82, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D344 STC11F08X */
+    { 0x47,  24, STC_MODEL_NAME(  94, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D347 IAP11F16X */
+    { 0x48,  25, STC_MODEL_NAME(  94, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D348 STC11F16X */
+    { 0x49,  24, STC_MODEL_NAME( 146, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,     0) },  /* D349 IAP11F20X */
+    { 0x4A,  25, STC_MODEL_NAME( 146, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,     0) },  /* D34A STC11F20X */
+    { 0x4F,  24, STC_MODEL_NAME( 122, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D34F IAP11F32X */
+    { 0x50,  25, STC_MODEL_NAME( 122, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D350 STC11F32X */
+    { 0x53,  24, STC_MODEL_NAME( 142, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D353 IAP11F40X */
+    { 0x54,  25, STC_MODEL_NAME( 142, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D354 STC11F40X */
+    { 0x57,  24, STC_MODEL_NAME(  76, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D357 IAP11F48X */
+    { 0x58,  25, STC_MODEL_NAME(  76, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D358 STC11F48X */
+    { 0x59,  24, STC_MODEL_NAME( 116, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D359 IAP11F52X */
+    { 0x5A,  25, STC_MODEL_NAME( 116, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D35A STC11F52X */
+    { 0x5B,  24, STC_MODEL_NAME(  88, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D35B IAP11F56X */
+    { 0x5C,  25, STC_MODEL_NAME(  88, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D35C STC11F56X */
+    { 0x5D,  24, STC_MODEL_NAME( 136, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D35D IAP11F60X */
+    { 0x5E,  25, STC_MODEL_NAME( 136, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D35E STC11F60X */
+    { 0x5F,  24, STC_MODEL_NAME( 110, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D35F IAP11F62X */
+    { 0x60,  29, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  8192, 55296) },  /* D360 STC08XE-5V */
+    { 0x61,  31, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 16384, 47104) },  /* D361 STC16XE-5V */
+    { 0x62,  40, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 20480, 30720) },  /* D362 STC20XE-5V */
+    { 0x63,  24, STC_MODEL_NAME(1367, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D363 IAP11F08XE */
+    { 0x64,  25, STC_MODEL_NAME(1367, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 55296) },  /* D364 STC11F08XE */
+    { 0x65,  35, STC_MODEL_NAME( 293, STC_PROTO_STC32 ), STC_MODEL_SIZE( 32768, 30720) },  /* D365 STC32XE-5V */
+    { 0x66,  39, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 40960, 22528) },  /* D366 STC40XE-5V */
+    { 0x67,  24, STC_MODEL_NAME(1377, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D367 IAP11F16XE */
+    { 0x68,  25, STC_MODEL_NAME(1377, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 47104) },  /* D368 STC11F16XE */
+    { 0x69,  24, STC_MODEL_NAME(1422, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,     0) },  /* D369 IAP11F20XE */
+    { 0x6A,  25, STC_MODEL_NAME(1422, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480, 30720) },  /* D36A STC11F20XE */
+    { 0x6B,  28, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 49152, 14336) },  /* D36B STC48XE-5V */
+    { 0x6C,  34, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 53248, 10240) },  /* D36C STC52XE-5V */
+    { 0x6D,  30, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 57344,  6144) },  /* D36D STC56XE-5V */
+    { 0x6E,  38, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 61440,  2048) },  /* D36E STC60XE-5V */
+    { 0x6F,  24, STC_MODEL_NAME(1397, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D36F IAP11F32XE */
+    { 0x70,  25, STC_MODEL_NAME(1397, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768, 30720) },  /* D370 STC11F32XE */
+    { 0x71,   1, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 63488,     0) },  /* D371 IAP62X-5V */
+    { 0x73,  24, STC_MODEL_NAME(1417, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D373 IAP11F40XE */
+    { 0x74,  25, STC_MODEL_NAME(1417, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960, 22528) },  /* D374 STC11F40XE */
+    { 0x77,  24, STC_MODEL_NAME(1362, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D377 IAP11F48XE */
+    { 0x78,  25, STC_MODEL_NAME(1362, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152, 14336) },  /* D378 STC11F48XE */
+    { 0x79,  24, STC_MODEL_NAME(1392, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D379 IAP11F52XE */
+    { 0x7A,  25, STC_MODEL_NAME(1392, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248, 10240) },  /* D37A STC11F52XE */
+    { 0x7B,  24, STC_MODEL_NAME(1372, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D37B IAP11F56XE */
+    { 0x7C,  25, STC_MODEL_NAME(1372, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,  6144) },  /* D37C STC11F56XE */
+    { 0x7D,  24, STC_MODEL_NAME(1412, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D37D IAP11F60XE */
+    { 0x7E,  25, STC_MODEL_NAME(1412, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,  2048) },  /* D37E STC11F60XE */
+    { 0x83,  10, STC_MODEL_NAME(2126, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D383 IAP11L08 */
+    { 0x84,  11, STC_MODEL_NAME(2126, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D384 STC11L08 */
+    { 0x87,  10, STC_MODEL_NAME(2175, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D387 IAP11L16 */
+    { 0x88,  11, STC_MODEL_NAME(2175, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D388 STC11L16 */
+    { 0x89,  10, STC_MODEL_NAME(3187, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,     0) },  /* D389 IAP11L20 */
+    { 0x8A,  11, STC_MODEL_NAME(3187, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,     0) },  /* D38A STC11L20 */
+    { 0x8F,  10, STC_MODEL_NAME(2879, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D38F IAP11L32 */
+    { 0x90,  11, STC_MODEL_NAME(2879, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D390 STC11L32 */
+    { 0x93,  10, STC_MODEL_NAME(3167, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D393 IAP11L40 */
+    { 0x94,  11, STC_MODEL_NAME(3167, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D394 STC11L40 */
+    { 0x97,  10, STC_MODEL_NAME(2084, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D397 IAP11L48 */
+    { 0x98,  11, STC_MODEL_NAME(2084, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D398 STC11L48 */
+    { 0x99,  10, STC_MODEL_NAME(2863, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D399 IAP11L52 */
+    { 0x9A,  11, STC_MODEL_NAME(2863, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D39A STC11L52 */
+    { 0x9B,  10, STC_MODEL_NAME(2140, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D39B IAP11L56 */
+    { 0x9C,  11, STC_MODEL_NAME(2140, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D39C STC11L56 */
+    { 0x9D,  10, STC_MODEL_NAME(3162, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D39D IAP11L60 */
+    { 0x9E,  11, STC_MODEL_NAME(3162, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D39E STC11L60 */
+    { 0x9F,  10, STC_MODEL_NAME(2833, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D39F IAP11L62 */
+    { 0xC3,  10, STC_MODEL_NAME(  82, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D3C3 IAP11L08X */
+    { 0xC4,  11, STC_MODEL_NAME(  82, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D3C4 STC11L08X */
+    { 0xC7,  10, STC_MODEL_NAME(  94, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D3C7 IAP11L16X */
+    { 0xC8,  11, STC_MODEL_NAME(  94, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D3C8 STC11L16X */
+    { 0xC9,  10, STC_MODEL_NAME( 146, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,     0) },  /* D3C9 IAP11L20X */
+    { 0xCA,  11, STC_MODEL_NAME( 146, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,     0) },  /* D3CA STC11L20X */
+    { 0xCF,  10, STC_MODEL_NAME( 122, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D3CF IAP11L32X */
+    { 0xD0,  11, STC_MODEL_NAME( 122, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D3D0 STC11L32X */
+    { 0xD3,  10, STC_MODEL_NAME( 142, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D3D3 IAP11L40X */
+    { 0xD4,  11, STC_MODEL_NAME( 142, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D3D4 STC11L40X */
+    { 0xD7,  10, STC_MODEL_NAME(  76, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D3D7 IAP11L48X */
+    { 0xD8,  11, STC_MODEL_NAME(  76, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D3D8 STC11L48X */
+    { 0xD9,  10, STC_MODEL_NAME( 116, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D3D9 IAP11L52X */
+    { 0xDA,  11, STC_MODEL_NAME( 116, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D3DA STC11L52X */
+    { 0xDB,  10, STC_MODEL_NAME(  88, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D3DB IAP11L56X */
+    { 0xDC,  11, STC_MODEL_NAME(  88, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D3DC STC11L56X */
+    { 0xDD,  10, STC_MODEL_NAME( 136, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D3DD IAP11L60X */
+    { 0xDE,  11, STC_MODEL_NAME( 136, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D3DE STC11L60X */
+    { 0xDF,  10, STC_MODEL_NAME( 110, STC_PROTO_STC12 ), STC_MODEL_SIZE( 63488,     0) },  /* D3DF IAP11L62X */
+    { 0xE0,  29, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  8192, 55296) },  /* D3E0 STC08XE-3V */
+    { 0xE1,  31, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 16384, 47104) },  /* D3E1 STC16XE-3V */
+    { 0xE2,  40, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 20480, 30720) },  /* D3E2 STC20XE-3V */
+    { 0xE3,  10, STC_MODEL_NAME(1367, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192,     0) },  /* D3E3 IAP11L08XE */
+    { 0xE4,  11, STC_MODEL_NAME(1367, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 55296) },  /* D3E4 STC11L08XE */
+    { 0xE5,  35, STC_MODEL_NAME( 371, STC_PROTO_STC32 ), STC_MODEL_SIZE( 32768, 30720) },  /* D3E5 STC32XE-3V */
+    { 0xE6,  39, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 40960, 22528) },  /* D3E6 STC40XE-3V */
+    { 0xE7,  10, STC_MODEL_NAME(1377, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384,     0) },  /* D3E7 IAP11L16XE */
+    { 0xE8,  11, STC_MODEL_NAME(1377, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 47104) },  /* D3E8 STC11L16XE */
+    { 0xE9,  10, STC_MODEL_NAME(1422, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,     0) },  /* D3E9 IAP11L20XE */
+    { 0xEA,  11, STC_MODEL_NAME(1422, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480, 30720) },  /* D3EA STC11L20XE */
+    { 0xEB,  28, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 49152, 14336) },  /* D3EB STC48XE-3V */
+    { 0xEC,  34, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 53248, 10240) },  /* D3EC STC52XE-3V */
+    { 0xED,  30, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 57344,  6144) },  /* D3ED STC56XE-3V */
+    { 0xEE,  38, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 61440,  2048) },  /* D3EE STC60XE-3V */
+    { 0xEF,  10, STC_MODEL_NAME(1397, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768,     0) },  /* D3EF IAP11L32XE */
+    { 0xF0,  11, STC_MODEL_NAME(1397, STC_PROTO_STC12 ), STC_MODEL_SIZE( 32768, 30720) },  /* D3F0 STC11L32XE */
+    { 0xF1,   1, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 63488,     0) },  /* D3F1 IAP62X-3V */
+    { 0xF3,  10, STC_MODEL_NAME(1417, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960,     0) },  /* D3F3 IAP11L40XE */
+    { 0xF4,  11, STC_MODEL_NAME(1417, STC_PROTO_STC12 ), STC_MODEL_SIZE( 40960, 22528) },  /* D3F4 STC11L40XE */
+    { 0xF7,  10, STC_MODEL_NAME(1362, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152,     0) },  /* D3F7 IAP11L48XE */
+    { 0xF8,  11, STC_MODEL_NAME(1362, STC_PROTO_STC12 ), STC_MODEL_SIZE( 49152, 14336) },  /* D3F8 STC11L48XE */
+    { 0xF9,  10, STC_MODEL_NAME(1392, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248,     0) },  /* D3F9 IAP11L52XE */
+    { 0xFA,  11, STC_MODEL_NAME(1392, STC_PROTO_STC12 ), STC_MODEL_SIZE( 53248, 10240) },  /* D3FA STC11L52XE */
+    { 0xFB,  10, STC_MODEL_NAME(1372, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,     0) },  /* D3FB IAP11L56XE */
+    { 0xFC,  11, STC_MODEL_NAME(1372, STC_PROTO_STC12 ), STC_MODEL_SIZE( 57344,  6144) },  /* D3FC STC11L56XE */
+    { 0xFD,  10, STC_MODEL_NAME(1412, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,     0) },  /* D3FD IAP11L60XE */
+    { 0xFE,  11, STC_MODEL_NAME(1412, STC_PROTO_STC12 ), STC_MODEL_SIZE( 61440,  2048) },  /* D3FE STC11L60XE */
+    { 0x01,  64, STC_MODEL_NAME(3141, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024, 12288) },  /* E001 STC12C5401 */
+    { 0x02,  64, STC_MODEL_NAME(3095, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048, 12288) },  /* E002 STC12C5402 */
+    { 0x04,  64, STC_MODEL_NAME(2504, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 12288) },  /* E004 STC12C5404 */
+    { 0x06,  64, STC_MODEL_NAME(2188, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144, 12288) },  /* E006 STC12C5406 */
+    { 0x08,  64, STC_MODEL_NAME(2124, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 12288) },  /* E008 STC12C5408 */
+    { 0x0A,  64, STC_MODEL_NAME(3199, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240, 12288) },  /* E00A STC12C5410 */
+    { 0x0C,  64, STC_MODEL_NAME(3076, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288, 12288) },  /* E00C STC12C5412 */
+    { 0x10,  64, STC_MODEL_NAME(2173, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 12288) },  /* E010 STC12C5416 */
+    { 0x14,  64, STC_MODEL_NAME(3185, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480, 12288) },  /* E014 STC12C5420 */
+    { 0x18,  64, STC_MODEL_NAME(2485, STC_PROTO_STC12 ), STC_MODEL_SIZE( 24576, 12288) },  /* E018 STC12C5424 */
+    { 0x1C,  64, STC_MODEL_NAME(2097, STC_PROTO_STC12 ), STC_MODEL_SIZE( 28672, 12288) },  /* E01C STC12C5428 */
+    { 0x61,  64, STC_MODEL_NAME(1899, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024, 12288) },  /* E061 STC12C5401AD */
+    { 0x62,  64, STC_MODEL_NAME(1873, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048, 12288) },  /* E062 STC12C5402AD */
+    { 0x64,  64, STC_MODEL_NAME(1750, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 12288) },  /* E064 STC12C5404AD */
+    { 0x66,  64, STC_MODEL_NAME(1685, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144, 12288) },  /* E066 STC12C5406AD */
+    { 0x68,  64, STC_MODEL_NAME(1637, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 12288) },  /* E068 STC12C5408AD */
+    { 0x6A,  64, STC_MODEL_NAME(1954, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240, 12288) },  /* E06A STC12C5410AD */
+    { 0x6C,  64, STC_MODEL_NAME(1859, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288, 12288) },  /* E06C STC12C5412AD */
+    { 0x70,  64, STC_MODEL_NAME(1671, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 12288) },  /* E070 STC12C5416AD */
+    { 0x74,  64, STC_MODEL_NAME(1941, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480, 12288) },  /* E074 STC12C5420AD */
+    { 0x78,  64, STC_MODEL_NAME(1730, STC_PROTO_STC12 ), STC_MODEL_SIZE( 24576, 12288) },  /* E078 STC12C5424AD */
+    { 0x7C,  64, STC_MODEL_NAME(1616, STC_PROTO_STC12 ), STC_MODEL_SIZE( 28672, 12288) },  /* E07C STC12C5428AD */
+    { 0x81,  44, STC_MODEL_NAME(3141, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024, 12288) },  /* E081 STC12LE5401 */
+    { 0x82,  44, STC_MODEL_NAME(3095, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048, 12288) },  /* E082 STC12LE5402 */
+    { 0x84,  44, STC_MODEL_NAME(2504, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 12288) },  /* E084 STC12LE5404 */
+    { 0x86,  44, STC_MODEL_NAME(2188, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144, 12288) },  /* E086 STC12LE5406 */
+    { 0x88,  44, STC_MODEL_NAME(2124, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 12288) },  /* E088 STC12LE5408 */
+    { 0x8A,  44, STC_MODEL_NAME(3199, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240, 12288) },  /* E08A STC12LE5410 */
+    { 0x8C,  44, STC_MODEL_NAME(3076, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288, 12288) },  /* E08C STC12LE5412 */
+    { 0x90,  44, STC_MODEL_NAME(2173, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 12288) },  /* E090 STC12LE5416 */
+    { 0x94,  44, STC_MODEL_NAME(3185, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480, 12288) },  /* E094 STC12LE5420 */
+    { 0x98,  44, STC_MODEL_NAME(2485, STC_PROTO_STC12 ), STC_MODEL_SIZE( 24576, 12288) },  /* E098 STC12LE5424 */
+    { 0x9C,  44, STC_MODEL_NAME(2097, STC_PROTO_STC12 ), STC_MODEL_SIZE( 28672, 12288) },  /* E09C STC12LE5428 */
+    { 0xE1,  44, STC_MODEL_NAME(1899, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024, 12288) },  /* E0E1 STC12LE5401AD */
+    { 0xE2,  44, STC_MODEL_NAME(1873, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048, 12288) },  /* E0E2 STC12LE5402AD */
+    { 0xE4,  44, STC_MODEL_NAME(1750, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 12288) },  /* E0E4 STC12LE5404AD */
+    { 0xE6,  44, STC_MODEL_NAME(1685, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144, 12288) },  /* E0E6 STC12LE5406AD */
+    { 0xE8,  44, STC_MODEL_NAME(1637, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 12288) },  /* E0E8 STC12LE5408AD */
+    { 0xEA,  44, STC_MODEL_NAME(1954, STC_PROTO_STC12 ), STC_MODEL_SIZE( 10240, 12288) },  /* E0EA STC12LE5410AD */
+    { 0xEC,  44, STC_MODEL_NAME(1859, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288, 12288) },  /* E0EC STC12LE5412AD */
+    { 0xF0,  44, STC_MODEL_NAME(1671, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 12288) },  /* E0F0 STC12LE5416AD */
+    { 0xF4,  44, STC_MODEL_NAME(1941, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480, 12288) },  /* E0F4 STC12LE5420AD */
+    { 0xF8,  44, STC_MODEL_NAME(1730, STC_PROTO_STC12 ), STC_MODEL_SIZE( 24576, 12288) },  /* E0F8 STC12LE5424AD */
+    { 0xFC,  44, STC_MODEL_NAME(1616, STC_PROTO_STC12 ), STC_MODEL_SIZE( 28672, 12288) },  /* E0FC STC12LE5428AD */
+    { 0x01,  64, STC_MODEL_NAME(3146, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,  5120) },  /* E101 STC12C5201 */
+    { 0x02,  64, STC_MODEL_NAME(3100, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,  4096) },  /* E102 STC12C5202 */
+    { 0x03,  64, STC_MODEL_NAME(2531, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,  3072) },  /* E103 STC12C5203 */
+    { 0x04,  64, STC_MODEL_NAME(2509, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,  2048) },  /* E104 STC12C5204 */
+    { 0x05,  64, STC_MODEL_NAME(2203, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,  1024) },  /* E105 STC12C5205 */
+    { 0x06,  64, STC_MODEL_NAME(2193, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* E106 STC12C5206 */
+    { 0x21,  64, STC_MODEL_NAME(1284, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,  5120) },  /* E121 STC12C5201PWM */
+    { 0x22,  64, STC_MODEL_NAME(1276, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,  4096) },  /* E122 STC12C5202PWM */
+    { 0x23,  64, STC_MODEL_NAME(1268, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,  3072) },  /* E123 STC12C5203PWM */
+    { 0x24,  64, STC_MODEL_NAME(1260, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,  2048) },  /* E124 STC12C5204PWM */
+    { 0x25,  64, STC_MODEL_NAME(1252, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,  1024) },  /* E125 STC12C5205PWM */
+    { 0x26,  64, STC_MODEL_NAME(1244, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* E126 STC12C5206PWM */
+    { 0x61,  64, STC_MODEL_NAME(1906, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,  5120) },  /* E161 STC12C5201AD */
+    { 0x62,  64, STC_MODEL_NAME(1880, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,  4096) },  /* E162 STC12C5202AD */
+    { 0x63,  64, STC_MODEL_NAME(1783, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,  3072) },  /* E163 STC12C5203AD */
+    { 0x64,  64, STC_MODEL_NAME(1757, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,  2048) },  /* E164 STC12C5204AD */
+    { 0x65,  64, STC_MODEL_NAME(1711, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,  1024) },  /* E165 STC12C5205AD */
+    { 0x66,  64, STC_MODEL_NAME(1692, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* E166 STC12C5206AD */
+    { 0x68,  59, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  1024,  5120) },  /* E168 STC5201AD-5V */
+    { 0x69,  58, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  2048,  4096) },  /* E169 STC5202AD-5V */
+    { 0x6A,  57, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  3072,  3072) },  /* E16A STC5203AD-5V */
+    { 0x6B,  56, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  4096,  2048) },  /* E16B STC5204AD-5V */
+    { 0x6C,  55, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  5120,  1024) },  /* E16C STC5205AD-5V */
+    { 0x6D,  54, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  6144,     0) },  /* E16D STC5206AD-5V */
+    { 0x81,  44, STC_MODEL_NAME(3146, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,  5120) },  /* E181 STC12LE5201 */
+    { 0x82,  44, STC_MODEL_NAME(3100, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,  4096) },  /* E182 STC12LE5202 */
+    { 0x83,  44, STC_MODEL_NAME(2531, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,  3072) },  /* E183 STC12LE5203 */
+    { 0x84,  44, STC_MODEL_NAME(2509, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,  2048) },  /* E184 STC12LE5204 */
+    { 0x85,  44, STC_MODEL_NAME(2203, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,  1024) },  /* E185 STC12LE5205 */
+    { 0x86,  44, STC_MODEL_NAME(2193, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* E186 STC12LE5206 */
+    { 0xA1,  44, STC_MODEL_NAME(1284, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,  5120) },  /* E1A1 STC12LE5201PWM */
+    { 0xA2,  44, STC_MODEL_NAME(1276, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,  4096) },  /* E1A2 STC12LE5202PWM */
+    { 0xA3,  44, STC_MODEL_NAME(1268, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,  3072) },  /* E1A3 STC12LE5203PWM */
+    { 0xA4,  44, STC_MODEL_NAME(1260, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,  2048) },  /* E1A4 STC12LE5204PWM */
+    { 0xA5,  44, STC_MODEL_NAME(1252, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,  1024) },  /* E1A5 STC12LE5205PWM */
+    { 0xA6,  44, STC_MODEL_NAME(1244, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* E1A6 STC12LE5206PWM */
+    { 0xE1,  44, STC_MODEL_NAME(1906, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,  5120) },  /* E1E1 STC12LE5201AD */
+    { 0xE2,  44, STC_MODEL_NAME(1880, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,  4096) },  /* E1E2 STC12LE5202AD */
+    { 0xE3,  44, STC_MODEL_NAME(1783, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,  3072) },  /* E1E3 STC12LE5203AD */
+    { 0xE4,  44, STC_MODEL_NAME(1757, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,  2048) },  /* E1E4 STC12LE5204AD */
+    { 0xE5,  44, STC_MODEL_NAME(1711, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,  1024) },  /* E1E5 STC12LE5205AD */
+    { 0xE6,  44, STC_MODEL_NAME(1692, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* E1E6 STC12LE5206AD */
+    { 0xE8,  59, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  1024,  5120) },  /* E1E8 STC5201AD-3V */
+    { 0xE9,  58, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  2048,  4096) },  /* E1E9 STC5202AD-3V */
+    { 0xEA,  57, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  3072,  3072) },  /* E1EA STC5203AD-3V */
+    { 0xEB,  56, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  4096,  2048) },  /* E1EB STC5204AD-3V */
+    { 0xEC,  55, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  5120,  1024) },  /* E1EC STC5205AD-3V */
+    { 0xED,  54, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  6144,     0) },  /* E1ED STC5206AD-3V */
+    { 0x01,  25, STC_MODEL_NAME(3152, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,     0) },  /* E201 STC11F01 */
+    { 0x02,  25, STC_MODEL_NAME(3106, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* E202 STC11F02 */
+    { 0x03,  25, STC_MODEL_NAME(2541, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,     0) },  /* E203 STC11F03 */
+    { 0x04,  25, STC_MODEL_NAME(2515, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* E204 STC11F04 */
+    { 0x11,  24, STC_MODEL_NAME(3152, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,     0) },  /* E211 IAP11F01 */
+    { 0x12,  24, STC_MODEL_NAME(3106, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* E212 IAP11F02 */
+    { 0x13,  24, STC_MODEL_NAME(2541, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,     0) },  /* E213 IAP11F03 */
+    { 0x14,  24, STC_MODEL_NAME(2515, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* E214 IAP11F04 */
+    { 0x20,  50, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  1024,  5120) },  /* E220 STC01E-5V */
+    { 0x21,  25, STC_MODEL_NAME(1449, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,  5120) },  /* E221 STC11F01E */
+    { 0x22,  25, STC_MODEL_NAME(1445, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,  4096) },  /* E222 STC11F02E */
+    { 0x23,  25, STC_MODEL_NAME(1441, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,  3072) },  /* E223 STC11F03E */
+    { 0x24,  25, STC_MODEL_NAME(1437, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,  2048) },  /* E224 STC11F04E */
+    { 0x26,  49, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  2048,  4096) },  /* E226 STC02E-5V */
+    { 0x27,  48, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  3072,  3072) },  /* E227 STC03E-5V */
+    { 0x28,  47, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  4096,  2048) },  /* E228 STC04E-5V */
+    { 0x29,  46, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  5120,  1024) },  /* E229 STC05E-5V */
+    { 0x2A,   6, STC_MODEL_NAME( 219, STC_PROTO_COUNT ), STC_MODEL_SIZE(  6144,     0) },  /* E22A IAP06-5V */
+    { 0x31,  24, STC_MODEL_NAME(1449, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,     0) },  /* E231 IAP11F01E */
+    { 0x32,  24, STC_MODEL_NAME(1445, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* E232 IAP11F02E */
+    { 0x33,  24, STC_MODEL_NAME(1441, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,     0) },  /* E233 IAP11F03E */
+    { 0x34,  24, STC_MODEL_NAME(1437, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* E234 IAP11F04E */
+    { 0x45,  25, STC_MODEL_NAME(2209, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,     0) },  /* E245 STC11F05 */
+    { 0x55,  24, STC_MODEL_NAME(2209, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,     0) },  /* E255 IAP11F05 */
+    { 0x65,  25, STC_MODEL_NAME(1432, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,  1024) },  /* E265 STC11F05E */
+    { 0x75,  24, STC_MODEL_NAME(1432, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,     0) },  /* E275 IAP11F05E */
+    { 0x76,  24, STC_MODEL_NAME(2195, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* E276 IAP11F06 */
+    { 0x81,  11, STC_MODEL_NAME(3152, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,     0) },  /* E281 STC11L01 */
+    { 0x82,  11, STC_MODEL_NAME(3106, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* E282 STC11L02 */
+    { 0x83,  11, STC_MODEL_NAME(2541, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,     0) },  /* E283 STC11L03 */
+    { 0x84,  11, STC_MODEL_NAME(2515, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* E284 STC11L04 */
+    { 0x91,  10, STC_MODEL_NAME(3152, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,     0) },  /* E291 IAP11L01 */
+    { 0x92,  10, STC_MODEL_NAME(3106, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* E292 IAP11L02 */
+    { 0x93,  10, STC_MODEL_NAME(2541, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,     0) },  /* E293 IAP11L03 */
+    { 0x94,  10, STC_MODEL_NAME(2515, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* E294 IAP11L04 */
+    { 0xA0,  50, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  1024,  5120) },  /* E2A0 STC01E-3V */
+    { 0xA1,  11, STC_MODEL_NAME(1449, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,  5120) },  /* E2A1 STC11L01E */
+    { 0xA2,  11, STC_MODEL_NAME(1445, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,  4096) },  /* E2A2 STC11L02E */
+    { 0xA3,  11, STC_MODEL_NAME(1441, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,  3072) },  /* E2A3 STC11L03E */
+    { 0xA4,  11, STC_MODEL_NAME(1437, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,  2048) },  /* E2A4 STC11L04E */
+    { 0xA6,  49, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  2048,  4096) },  /* E2A6 STC02E-3V */
+    { 0xA7,  48, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  3072,  3072) },  /* E2A7 STC03E-3V */
+    { 0xA8,  47, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  4096,  2048) },  /* E2A8 STC04E-3V */
+    { 0xA9,  46, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  5120,  1024) },  /* E2A9 STC05E-3V */
+    { 0xAA,   6, STC_MODEL_NAME( 297, STC_PROTO_COUNT ), STC_MODEL_SIZE(  6144,     0) },  /* E2AA IAP06-3V */
+    { 0xB1,  10, STC_MODEL_NAME(1449, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024,     0) },  /* E2B1 IAP11L01E */
+    { 0xB2,  10, STC_MODEL_NAME(1445, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048,     0) },  /* E2B2 IAP11L02E */
+    { 0xB3,  10, STC_MODEL_NAME(1441, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072,     0) },  /* E2B3 IAP11L03E */
+    { 0xB4,  10, STC_MODEL_NAME(1437, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096,     0) },  /* E2B4 IAP11L04E */
+    { 0xC5,  11, STC_MODEL_NAME(2209, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,     0) },  /* E2C5 STC11L05 */
+    { 0xD5,  10, STC_MODEL_NAME(2209, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,     0) },  /* E2D5 IAP11L05 */
+    { 0xE5,  11, STC_MODEL_NAME(1432, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,  1024) },  /* E2E5 STC11L05E */
+    { 0xF5,  10, STC_MODEL_NAME(1432, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,     0) },  /* E2F5 IAP11L05E */
+    { 0xF6,  10, STC_MODEL_NAME(2195, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144,     0) },  /* E2F6 IAP11L06 */
+    { 0x01,  64, STC_MODEL_NAME(3136, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024, 29696) },  /* E601 STC12C5601 */
+    { 0x02,  64, STC_MODEL_NAME(3090, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048, 28672) },  /* E602 STC12C5602 */
+    { 0x03,  64, STC_MODEL_NAME(2526, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072, 27648) },  /* E603 STC12C5603 */
+    { 0x04,  64, STC_MODEL_NAME(2499, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 26624) },  /* E604 STC12C5604 */
+    { 0x05,  64, STC_MODEL_NAME(2198, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,     0) },  /* E605 STC12C5605 */
+    { 0x06,  64, STC_MODEL_NAME(2183, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144, 24576) },  /* E606 STC12C5606 */
+    { 0x08,  64, STC_MODEL_NAME(2119, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 22528) },  /* E608 STC12C5608 */
+    { 0x0C,  64, STC_MODEL_NAME(3067, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* E60C STC12C5612 */
+    { 0x10,  64, STC_MODEL_NAME(2164, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 14336) },  /* E610 STC12C5616 */
+    { 0x14,  64, STC_MODEL_NAME(3180, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480, 10240) },  /* E614 STC12C5620 */
+    { 0x18,  64, STC_MODEL_NAME(2480, STC_PROTO_STC12 ), STC_MODEL_SIZE( 24576,  6144) },  /* E618 STC12C5624 */
+    { 0x1C,  64, STC_MODEL_NAME(2092, STC_PROTO_STC12 ), STC_MODEL_SIZE( 28672,     0) },  /* E61C STC12C5628 */
+    { 0x1E,  64, STC_MODEL_NAME(3170, STC_PROTO_STC12 ), STC_MODEL_SIZE( 30720,     0) },  /* E61E STC12C5630 */
+    { 0x61,  64, STC_MODEL_NAME(1892, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024, 29696) },  /* E661 STC12C5601AD */
+    { 0x62,  64, STC_MODEL_NAME(1866, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048, 28672) },  /* E662 STC12C5602AD */
+    { 0x63,  64, STC_MODEL_NAME(1776, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072, 27648) },  /* E663 STC12C5603AD */
+    { 0x64,  64, STC_MODEL_NAME(1743, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 26624) },  /* E664 STC12C5604AD */
+    { 0x65,  64, STC_MODEL_NAME(1704, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,     0) },  /* E665 STC12C5605AD */
+    { 0x66,  64, STC_MODEL_NAME(1678, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144, 24576) },  /* E666 STC12C5606AD */
+    { 0x67,  51, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE(  8192, 22528) },  /* E667 STC608AD-5V */
+    { 0x68,  64, STC_MODEL_NAME(1630, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 22528) },  /* E668 STC12C5608AD */
+    { 0x69,  52, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 16384,     0) },  /* E669 IAP616AD-5V */
+    { 0x6A,  53, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 16384, 14336) },  /* E66A STC616AD-5V */
+    { 0x6C,  64, STC_MODEL_NAME(1846, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* E66C STC12C5612AD */
+    { 0x70,  64, STC_MODEL_NAME(1658, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 14336) },  /* E670 STC12C5616AD */
+    { 0x74,  64, STC_MODEL_NAME(1934, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480, 10240) },  /* E674 STC12C5620AD */
+    { 0x78,  64, STC_MODEL_NAME(1723, STC_PROTO_STC12 ), STC_MODEL_SIZE( 24576,  6144) },  /* E678 STC12C5624AD */
+    { 0x7C,  64, STC_MODEL_NAME(1609, STC_PROTO_STC12 ), STC_MODEL_SIZE( 28672,     0) },  /* E67C STC12C5628AD */
+    { 0x7E,  64, STC_MODEL_NAME(1927, STC_PROTO_STC12 ), STC_MODEL_SIZE( 30720,     0) },  /* E67E STC12C5630AD */
+    { 0x81,  44, STC_MODEL_NAME(3136, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024, 29696) },  /* E681 STC12LE5601 */
+    { 0x82,  44, STC_MODEL_NAME(3090, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048, 28672) },  /* E682 STC12LE5602 */
+    { 0x83,  44, STC_MODEL_NAME(2526, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072, 27648) },  /* E683 STC12LE5603 */
+    { 0x84,  44, STC_MODEL_NAME(2499, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 26624) },  /* E684 STC12LE5604 */
+    { 0x85,  44, STC_MODEL_NAME(2198, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,     0) },  /* E685 STC12LE5605 */
+    { 0x86,  44, STC_MODEL_NAME(2183, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144, 24576) },  /* E686 STC12LE5606 */
+    { 0x88,  44, STC_MODEL_NAME(2119, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 22528) },  /* E688 STC12LE5608 */
+    { 0x8C,  44, STC_MODEL_NAME(3067, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* E68C STC12LE5612 */
+    { 0x90,  44, STC_MODEL_NAME(2164, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 14336) },  /* E690 STC12LE5616 */
+    { 0x94,  44, STC_MODEL_NAME(3180, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480, 10240) },  /* E694 STC12LE5620 */
+    { 0x98,  44, STC_MODEL_NAME(2480, STC_PROTO_STC12 ), STC_MODEL_SIZE( 24576,  6144) },  /* E698 STC12LE5624 */
+    { 0x9C,  44, STC_MODEL_NAME(2092, STC_PROTO_STC12 ), STC_MODEL_SIZE( 28672,     0) },  /* E69C STC12LE5628 */
+    { 0x9E,  44, STC_MODEL_NAME(3170, STC_PROTO_STC12 ), STC_MODEL_SIZE( 30720,     0) },  /* E69E STC12LE5630 */
+    { 0xE1,  44, STC_MODEL_NAME(1892, STC_PROTO_STC12 ), STC_MODEL_SIZE(  1024, 29696) },  /* E6E1 STC12LE5601AD */
+    { 0xE2,  44, STC_MODEL_NAME(1866, STC_PROTO_STC12 ), STC_MODEL_SIZE(  2048, 28672) },  /* E6E2 STC12LE5602AD */
+    { 0xE3,  44, STC_MODEL_NAME(1776, STC_PROTO_STC12 ), STC_MODEL_SIZE(  3072, 27648) },  /* E6E3 STC12LE5603AD */
+    { 0xE4,  44, STC_MODEL_NAME(1743, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 26624) },  /* E6E4 STC12LE5604AD */
+    { 0xE5,  44, STC_MODEL_NAME(1704, STC_PROTO_STC12 ), STC_MODEL_SIZE(  5120,     0) },  /* E6E5 STC12LE5605AD */
+    { 0xE6,  44, STC_MODEL_NAME(1678, STC_PROTO_STC12 ), STC_MODEL_SIZE(  6144, 24576) },  /* E6E6 STC12LE5606AD */
+    { 0xE7,  51, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE(  8192, 22528) },  /* E6E7 STC608AD-3V */
+    { 0xE8,  44, STC_MODEL_NAME(1630, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 22528) },  /* E6E8 STC12LE5608AD */
+    { 0xE9,  52, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 16384,     0) },  /* E6E9 IAP616AD-3V */
+    { 0xEA,  53, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 16384, 14336) },  /* E6EA STC616AD-3V */
+    { 0xEC,  44, STC_MODEL_NAME(1846, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288,     0) },  /* E6EC STC12LE5612AD */
+    { 0xF0,  44, STC_MODEL_NAME(1658, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 14336) },  /* E6F0 STC12LE5616AD */
+    { 0xF4,  44, STC_MODEL_NAME(1934, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480, 10240) },  /* E6F4 STC12LE5620AD */
+    { 0xF8,  44, STC_MODEL_NAME(1723, STC_PROTO_STC12 ), STC_MODEL_SIZE( 24576,  6144) },  /* E6F8 STC12LE5624AD */
+    { 0xFC,  44, STC_MODEL_NAME(1609, STC_PROTO_STC12 ), STC_MODEL_SIZE( 28672,     0) },  /* E6FC STC12LE5628AD */
+    { 0xFE,  44, STC_MODEL_NAME(1927, STC_PROTO_STC12 ), STC_MODEL_SIZE( 30720,     0) },  /* E6FE STC12LE5630AD */
+    { 0x01,  61, STC_MODEL_NAME(2021, STC_PROTO_STC89 ), STC_MODEL_SIZE(  4096, 10240) },  /* F001 STC89C51RC/LE51RC */
+    { 0x02,  61, STC_MODEL_NAME(1997, STC_PROTO_STC89 ), STC_MODEL_SIZE(  8192,  6144) },  /* F002 STC89C52RC/LE52RC */
+    { 0x04,  61, STC_MODEL_NAME(1985, STC_PROTO_STC89 ), STC_MODEL_SIZE( 14336,     0) },  /* F004 STC89C53RC/LE53RC */
+    { 0x06,  61, STC_MODEL_NAME(1973, STC_PROTO_STC89 ), STC_MODEL_SIZE(  6144,  8192) },  /* F006 STC89C06RC/LE06RC */
+    { 0x07,  61, STC_MODEL_NAME(1961, STC_PROTO_STC89 ), STC_MODEL_SIZE(  7168,  7168) },  /* F007 STC89C07RC/LE07RC */
+    { 0x0A,  61, STC_MODEL_NAME(2033, STC_PROTO_STC89 ), STC_MODEL_SIZE( 10240,  4096) },  /* F00A STC89C10RC/LE10RC */
+    { 0x0C,  61, STC_MODEL_NAME(2009, STC_PROTO_STC89 ), STC_MODEL_SIZE( 12288,  2048) },  /* F00C STC89C12RC/LE12RC */
+    { 0x21,  65, STC_MODEL_NAME(2028, STC_PROTO_STC89 ), STC_MODEL_SIZE(  4096, 10240) },  /* F021 STC90C51RC */
+    { 0x22,  65, STC_MODEL_NAME(2004, STC_PROTO_STC89 ), STC_MODEL_SIZE(  8192,  6144) },  /* F022 STC90C52RC */
+    { 0x24,  65, STC_MODEL_NAME(1992, STC_PROTO_STC89 ), STC_MODEL_SIZE( 14336,     0) },  /* F024 STC90C53RC */
+    { 0x26,  65, STC_MODEL_NAME(1980, STC_PROTO_STC89 ), STC_MODEL_SIZE(  6144,  8192) },  /* F026 STC90C06RC */
+    { 0x27,  65, STC_MODEL_NAME(1968, STC_PROTO_STC89 ), STC_MODEL_SIZE(  7168,  7168) },  /* F027 STC90C07RC */
+    { 0x2A,  65, STC_MODEL_NAME(2040, STC_PROTO_STC89 ), STC_MODEL_SIZE( 10240,  4096) },  /* F02A STC90C10RC */
+    { 0x2C,  65, STC_MODEL_NAME(2016, STC_PROTO_STC89 ), STC_MODEL_SIZE( 12288,  2048) },  /* F02C STC90C12RC */
+    { 0x41,  45, STC_MODEL_NAME(2028, STC_PROTO_STC89 ), STC_MODEL_SIZE(  4096, 10240) },  /* F041 STC90LE51RC */
+    { 0x42,  45, STC_MODEL_NAME(2004, STC_PROTO_STC89 ), STC_MODEL_SIZE(  8192,  6144) },  /* F042 STC90LE52RC */
+    { 0x44,  45, STC_MODEL_NAME(1992, STC_PROTO_STC89 ), STC_MODEL_SIZE( 14336,     0) },  /* F044 STC90LE53RC */
+    { 0x46,  45, STC_MODEL_NAME(1980, STC_PROTO_STC89 ), STC_MODEL_SIZE(  6144,  8192) },  /* F046 STC90LE06RC */
+    { 0x47,  45, STC_MODEL_NAME(1968, STC_PROTO_STC89 ), STC_MODEL_SIZE(  7168,  7168) },  /* F047 STC90LE07RC */
+    { 0x4A,  45, STC_MODEL_NAME(2040, STC_PROTO_STC89 ), STC_MODEL_SIZE( 10240,  4096) },  /* F04A STC90LE10RC */
+    { 0x4C,  45, STC_MODEL_NAME(2016, STC_PROTO_STC89 ), STC_MODEL_SIZE( 12288,  2048) },  /* F04C STC90LE12RC */
+    { 0x50,  61, STC_MODEL_NAME(3133, STC_PROTO_STC89 ), STC_MODEL_SIZE(  4096, 10240) },  /* F050 STC89C51 */
+    { 0x51,  61, STC_MODEL_NAME(2863, STC_PROTO_STC89 ), STC_MODEL_SIZE(  8192,  6144) },  /* F051 STC89C52 */
+    { 0x52,  61, STC_MODEL_NAME(2518, STC_PROTO_STC89 ), STC_MODEL_SIZE( 12288,  2048) },  /* F052 STC89C53 */
+    { 0x53,  61, STC_MODEL_NAME(2491, STC_PROTO_STC89 ), STC_MODEL_SIZE( 14336,     0) },  /* F053 STC89C14 */
+    { 0x60,  42, STC_MODEL_NAME(3133, STC_PROTO_STC89 ), STC_MODEL_SIZE(  4096, 10240) },  /* F060 STC89LE51 */
+    { 0x61,  42, STC_MODEL_NAME(2863, STC_PROTO_STC89 ), STC_MODEL_SIZE(  8192,  6144) },  /* F061 STC89LE52 */
+    { 0x62,  42, STC_MODEL_NAME(2518, STC_PROTO_STC89 ), STC_MODEL_SIZE( 12288,  2048) },  /* F062 STC89LE53 */
+    { 0x63,  42, STC_MODEL_NAME(2491, STC_PROTO_STC89 ), STC_MODEL_SIZE( 14336,     0) },  /* F063 STC89LE14 */
+    { 0x01,  61, STC_MODEL_NAME(3328, STC_PROTO_STC89 ), STC_MODEL_SIZE(  4096, 59392) },  /* F101 STC89C51RD+/LE51RD+ */
+    { 0x02,  61, STC_MODEL_NAME(3298, STC_PROTO_STC89 ), STC_MODEL_SIZE(  8192, 55296) },  /* F102 STC89C52RD+/LE52RD+ */
+    { 0x04,  61, STC_MODEL_NAME(3252, STC_PROTO_STC89 ), STC_MODEL_SIZE( 16384, 47104) },  /* F104 STC89C54RD+/LE54RD+ */
+    { 0x05,  61, STC_MODEL_NAME(3238, STC_PROTO_STC89 ), STC_MODEL_SIZE( 20480, 43008) },  /* F105 STC89C55RD+/LE55RD+ */
+    { 0x08,  61, STC_MODEL_NAME(3208, STC_PROTO_STC89 ), STC_MODEL_SIZE( 32768, 30720) },  /* F108 STC89C58RD+/LE58RD+ */
+    { 0x0A,  61, STC_MODEL_NAME(3342, STC_PROTO_STC89 ), STC_MODEL_SIZE( 40960, 22528) },  /* F10A STC89C510RD+/LE510RD+ */
+    { 0x0C,  61, STC_MODEL_NAME(3312, STC_PROTO_STC89 ), STC_MODEL_SIZE( 49152, 14336) },  /* F10C STC89C512RD+/LE512RD+ */
+    { 0x0D,  61, STC_MODEL_NAME(3282, STC_PROTO_STC89 ), STC_MODEL_SIZE( 53248, 10240) },  /* F10D STC89C513RD+/LE513RD+ */
+    { 0x0E,  61, STC_MODEL_NAME(3266, STC_PROTO_STC89 ), STC_MODEL_SIZE( 57344,  6144) },  /* F10E STC89C514RD+/LE514RD+ */
+    { 0x10,  61, STC_MODEL_NAME(3222, STC_PROTO_STC89 ), STC_MODEL_SIZE( 63488,     0) },  /* F110 STC89C516RD+/LE516RD+ */
+    { 0x21,  65, STC_MODEL_NAME(3336, STC_PROTO_STC89 ), STC_MODEL_SIZE(  4096, 59392) },  /* F121 STC90C51RD+ */
+    { 0x22,  65, STC_MODEL_NAME(3306, STC_PROTO_STC89 ), STC_MODEL_SIZE(  8192, 55296) },  /* F122 STC90C52RD+ */
+    { 0x24,  65, STC_MODEL_NAME(3260, STC_PROTO_STC89 ), STC_MODEL_SIZE( 16384, 47104) },  /* F124 STC90C54RD+ */
+    { 0x25,  65, STC_MODEL_NAME(3246, STC_PROTO_STC89 ), STC_MODEL_SIZE( 20480, 43008) },  /* F125 STC90C55RD+ */
+    { 0x28,  65, STC_MODEL_NAME(3216, STC_PROTO_STC89 ), STC_MODEL_SIZE( 32768, 30720) },  /* F128 STC90C58RD+ */
+    { 0x2A,  65, STC_MODEL_NAME(3351, STC_PROTO_STC89 ), STC_MODEL_SIZE( 40960, 22528) },  /* F12A STC90C510RD+ */
+    { 0x2C,  65, STC_MODEL_NAME(3321, STC_PROTO_STC89 ), STC_MODEL_SIZE( 49152, 14336) },  /* F12C STC90C512RD+ */
+    { 0x2D,  65, STC_MODEL_NAME(3291, STC_PROTO_STC89 ), STC_MODEL_SIZE( 53248, 10240) },  /* F12D STC90C513RD+ */
+    { 0x2E,  65, STC_MODEL_NAME(3275, STC_PROTO_STC89 ), STC_MODEL_SIZE( 57344,  6144) },  /* F12E STC90C514RD+ */
+    { 0x30,  65, STC_MODEL_NAME(3231, STC_PROTO_STC89 ), STC_MODEL_SIZE( 63488,     0) },  /* F130 STC90C516RD+ */
+    { 0x41,  45, STC_MODEL_NAME(3336, STC_PROTO_STC89 ), STC_MODEL_SIZE(  4096, 59392) },  /* F141 STC90LE51RD+ */
+    { 0x42,  45, STC_MODEL_NAME(3306, STC_PROTO_STC89 ), STC_MODEL_SIZE(  8192, 55296) },  /* F142 STC90LE52RD+ */
+    { 0x44,  45, STC_MODEL_NAME(3260, STC_PROTO_STC89 ), STC_MODEL_SIZE( 16384, 47104) },  /* F144 STC90LE54RD+ */
+    { 0x45,  45, STC_MODEL_NAME(3246, STC_PROTO_STC89 ), STC_MODEL_SIZE( 20480, 43008) },  /* F145 STC90LE55RD+ */
+    { 0x48,  45, STC_MODEL_NAME(3216, STC_PROTO_STC89 ), STC_MODEL_SIZE( 32768, 30720) },  /* F148 STC90LE58RD+ */
+    { 0x4A,  45, STC_MODEL_NAME(3351, STC_PROTO_STC89 ), STC_MODEL_SIZE( 40960, 22528) },  /* F14A STC90LE510RD+ */
+    { 0x4C,  45, STC_MODEL_NAME(3321, STC_PROTO_STC89 ), STC_MODEL_SIZE( 49152, 14336) },  /* F14C STC90LE512RD+ */
+    { 0x4D,  45, STC_MODEL_NAME(3291, STC_PROTO_STC89 ), STC_MODEL_SIZE( 53248, 10240) },  /* F14D STC90LE513RD+ */
+    { 0x4E,  45, STC_MODEL_NAME(3275, STC_PROTO_STC89 ), STC_MODEL_SIZE( 57344,  6144) },  /* F14E STC90LE514RD+ */
+    { 0x50,  45, STC_MODEL_NAME(3231, STC_PROTO_STC89 ), STC_MODEL_SIZE( 63488,     0) },  /* F150 STC90LE516RD+ */
+    { 0x61,  65, STC_MODEL_NAME(1887, STC_PROTO_STC89 ), STC_MODEL_SIZE(  4096, 59392) },  /* F161 STC90C51AD */
+    { 0x62,  65, STC_MODEL_NAME(1834, STC_PROTO_STC89 ), STC_MODEL_SIZE(  8192, 55296) },  /* F162 STC90C52AD */
+    { 0x64,  65, STC_MODEL_NAME(1718, STC_PROTO_STC89 ), STC_MODEL_SIZE( 16384, 47104) },  /* F164 STC90C54AD */
+    { 0x65,  65, STC_MODEL_NAME(1699, STC_PROTO_STC89 ), STC_MODEL_SIZE( 20480, 43008) },  /* F165 STC90C55AD */
+    { 0x68,  65, STC_MODEL_NAME(1597, STC_PROTO_STC89 ), STC_MODEL_SIZE( 32768, 30720) },  /* F168 STC90C58AD */
+    { 0x6A,  65, STC_MODEL_NAME(1948, STC_PROTO_STC89 ), STC_MODEL_SIZE( 40960, 22528) },  /* F16A STC90C510AD */
+    { 0x6C,  65, STC_MODEL_NAME(1853, STC_PROTO_STC89 ), STC_MODEL_SIZE( 49152, 14336) },  /* F16C STC90C512AD */
+    { 0x6D,  65, STC_MODEL_NAME(1764, STC_PROTO_STC89 ), STC_MODEL_SIZE( 53248, 10240) },  /* F16D STC90C513AD */
+    { 0x6E,  65, STC_MODEL_NAME(1737, STC_PROTO_STC89 ), STC_MODEL_SIZE( 57344,  6144) },  /* F16E STC90C514AD */
+    { 0x70,  65, STC_MODEL_NAME(1665, STC_PROTO_STC89 ), STC_MODEL_SIZE( 63488,     0) },  /* F170 STC90C516AD */
+    { 0x81,  45, STC_MODEL_NAME(1887, STC_PROTO_STC89 ), STC_MODEL_SIZE(  4096, 59392) },  /* F181 STC90LE51AD */
+    { 0x82,  45, STC_MODEL_NAME(1834, STC_PROTO_STC89 ), STC_MODEL_SIZE(  8192, 55296) },  /* F182 STC90LE52AD */
+    { 0x84,  45, STC_MODEL_NAME(1718, STC_PROTO_STC89 ), STC_MODEL_SIZE( 16384, 47104) },  /* F184 STC90LE54AD */
+    { 0x85,  45, STC_MODEL_NAME(1699, STC_PROTO_STC89 ), STC_MODEL_SIZE( 20480, 43008) },  /* F185 STC90LE55AD */
+    { 0x88,  45, STC_MODEL_NAME(1597, STC_PROTO_STC89 ), STC_MODEL_SIZE( 32768, 30720) },  /* F188 STC90LE58AD */
+    { 0x8A,  45, STC_MODEL_NAME(1948, STC_PROTO_STC89 ), STC_MODEL_SIZE( 40960, 22528) },  /* F18A STC90LE510AD */
+    { 0x8C,  45, STC_MODEL_NAME(1853, STC_PROTO_STC89 ), STC_MODEL_SIZE( 49152, 14336) },  /* F18C STC90LE512AD */
+    { 0x8D,  45, STC_MODEL_NAME(1764, STC_PROTO_STC89 ), STC_MODEL_SIZE( 53248, 10240) },  /* F18D STC90LE513AD */
+    { 0x8E,  45, STC_MODEL_NAME(1737, STC_PROTO_STC89 ), STC_MODEL_SIZE( 57344,  6144) },  /* F18E STC90LE514AD */
+    { 0x90,  45, STC_MODEL_NAME(1665, STC_PROTO_STC89 ), STC_MODEL_SIZE( 63488,     0) },  /* F190 STC90LE516AD */
+    { 0xA0,  61, STC_MODEL_NAME(2472, STC_PROTO_STC89 ), STC_MODEL_SIZE( 16384, 47104) },  /* F1A0 STC89C54 */
+    { 0xA1,  61, STC_MODEL_NAME(2068, STC_PROTO_STC89 ), STC_MODEL_SIZE( 32768, 30720) },  /* F1A1 STC89C58 */
+    { 0xA2,  61, STC_MODEL_NAME(3195, STC_PROTO_STC89 ), STC_MODEL_SIZE( 40960, 22528) },  /* F1A2 STC89C510 */
+    { 0xA3,  61, STC_MODEL_NAME(3072, STC_PROTO_STC89 ), STC_MODEL_SIZE( 49152, 14336) },  /* F1A3 STC89C512 */
+    { 0xA4,  61, STC_MODEL_NAME(2490, STC_PROTO_STC89 ), STC_MODEL_SIZE( 57344,  6144) },  /* F1A4 STC89C514 */
+    { 0xA5,  61, STC_MODEL_NAME(2169, STC_PROTO_STC89 ), STC_MODEL_SIZE( 63488,     0) },  /* F1A5 STC89C516 */
+    { 0xB0,  42, STC_MODEL_NAME(2472, STC_PROTO_STC89 ), STC_MODEL_SIZE( 16384, 47104) },  /* F1B0 STC89LE54 */
+    { 0xB1,  42, STC_MODEL_NAME(2068, STC_PROTO_STC89 ), STC_MODEL_SIZE( 32768, 30720) },  /* F1B1 STC89LE58 */
+    { 0xB2,  42, STC_MODEL_NAME(3195, STC_PROTO_STC89 ), STC_MODEL_SIZE( 40960, 22528) },  /* F1B2 STC89LE510 */
+    { 0xB3,  42, STC_MODEL_NAME(3072, STC_PROTO_STC89 ), STC_MODEL_SIZE( 49152, 14336) },  /* F1B3 STC89LE512 */
+    { 0xB4,  42, STC_MODEL_NAME(2490, STC_PROTO_STC89 ), STC_MODEL_SIZE( 57344,  6144) },  /* F1B4 STC89LE514 */
+    { 0xB5,  42, STC_MODEL_NAME(2169, STC_PROTO_STC89 ), STC_MODEL_SIZE( 63488,     0) },  /* F1B5 STC89LE516 */
+    { 0x01,  64, STC_MODEL_NAME(2861, STC_PROTO_STC89A), STC_MODEL_SIZE(  1024,  5120) },  /* F201 STC12C1052 */
+    { 0x02,  64, STC_MODEL_NAME(2856, STC_PROTO_STC89A), STC_MODEL_SIZE(  2048,  4096) },  /* F202 STC12C2052 */
+    { 0x03,  64, STC_MODEL_NAME(2851, STC_PROTO_STC89A), STC_MODEL_SIZE(  3072,  3072) },  /* F203 STC12C3052 */
+    { 0x04,  64, STC_MODEL_NAME(2846, STC_PROTO_STC89A), STC_MODEL_SIZE(  4096,  2048) },  /* F204 STC12C4052 */
+    { 0x05,  64, STC_MODEL_NAME(2841, STC_PROTO_STC89A), STC_MODEL_SIZE(  5120,  1024) },  /* F205 STC12C5052 */
+    { 0x11,  64, STC_MODEL_NAME(1832, STC_PROTO_STC89A), STC_MODEL_SIZE(  1024,  5120) },  /* F211 STC12C1052AD */
+    { 0x12,  64, STC_MODEL_NAME(1825, STC_PROTO_STC89A), STC_MODEL_SIZE(  2048,  4096) },  /* F212 STC12C2052AD */
+    { 0x13,  64, STC_MODEL_NAME(1818, STC_PROTO_STC89A), STC_MODEL_SIZE(  3072,  3072) },  /* F213 STC12C3052AD */
+    { 0x14,  64, STC_MODEL_NAME(1811, STC_PROTO_STC89A), STC_MODEL_SIZE(  4096,  2048) },  /* F214 STC12C4052AD */
+    { 0x15,  64, STC_MODEL_NAME(1804, STC_PROTO_STC89A), STC_MODEL_SIZE(  5120,  1024) },  /* F215 STC12C5052AD */
+    { 0x21,  44, STC_MODEL_NAME(2861, STC_PROTO_STC89A), STC_MODEL_SIZE(  1024,  5120) },  /* F221 STC12LE1052 */
+    { 0x22,  44, STC_MODEL_NAME(2856, STC_PROTO_STC89A), STC_MODEL_SIZE(  2048,  4096) },  /* F222 STC12LE2052 */
+    { 0x23,  44, STC_MODEL_NAME(2851, STC_PROTO_STC89A), STC_MODEL_SIZE(  3072,  3072) },  /* F223 STC12LE3052 */
+    { 0x24,  44, STC_MODEL_NAME(2846, STC_PROTO_STC89A), STC_MODEL_SIZE(  4096,  2048) },  /* F224 STC12LE4052 */
+    { 0x25,  44, STC_MODEL_NAME(2841, STC_PROTO_STC89A), STC_MODEL_SIZE(  5120,  1024) },  /* F225 STC12LE5052 */
+    { 0x31,  44, STC_MODEL_NAME(1832, STC_PROTO_STC89A), STC_MODEL_SIZE(  1024,  5120) },  /* F231 STC12LE1052AD */
+    { 0x32,  44, STC_MODEL_NAME(1825, STC_PROTO_STC89A), STC_MODEL_SIZE(  2048,  4096) },  /* F232 STC12LE2052AD */
+    { 0x33,  44, STC_MODEL_NAME(1818, STC_PROTO_STC89A), STC_MODEL_SIZE(  3072,  3072) },  /* F233 STC12LE3052AD */
+    { 0x34,  44, STC_MODEL_NAME(1811, STC_PROTO_STC89A), STC_MODEL_SIZE(  4096,  2048) },  /* F234 STC12LE4052AD */
+    { 0x35,  44, STC_MODEL_NAME(1804, STC_PROTO_STC89A), STC_MODEL_SIZE(  5120,  1024) },  /* F235 STC12LE5052AD */
+    { 0x90,  21, STC_MODEL_NAME( 214, STC_PROTO_STC15 ), STC_MODEL_SIZE(   512,     0) },  /* F290 STC15F100W */
+    { 0x91,  21, STC_MODEL_NAME( 209, STC_PROTO_STC15 ), STC_MODEL_SIZE(  1024,  4096) },  /* F291 STC15F101W */
+    { 0x92,  21, STC_MODEL_NAME( 204, STC_PROTO_STC15 ), STC_MODEL_SIZE(  2048,  3072) },  /* F292 STC15F102W */
+    { 0x93,  21, STC_MODEL_NAME( 199, STC_PROTO_STC15 ), STC_MODEL_SIZE(  3072,  2048) },  /* F293 STC15F103W */
+    { 0x94,  21, STC_MODEL_NAME( 194, STC_PROTO_STC15 ), STC_MODEL_SIZE(  4096,  1024) },  /* F294 STC15F104W */
+    { 0x94,  21, STC_MODEL_NAME(1436, STC_PROTO_STC15A), STC_MODEL_SIZE(  4096,  1024) },  /* F294 STC15F104E */
+    { 0x98,  21, STC_MODEL_NAME(3204, STC_PROTO_STC15A), STC_MODEL_SIZE(   512,     0) },  /* F298 STC15F100 */
+    { 0x99,  21, STC_MODEL_NAME(3151, STC_PROTO_STC15A), STC_MODEL_SIZE(  1024,  4096) },  /* F299 STC15F101 */
+    { 0x9A,  21, STC_MODEL_NAME(3105, STC_PROTO_STC15A), STC_MODEL_SIZE(  2048,  3072) },  /* F29A STC15F102 */
+    { 0x9B,  21, STC_MODEL_NAME(2536, STC_PROTO_STC15A), STC_MODEL_SIZE(  3072,  2048) },  /* F29B STC15F103 */
+    { 0x9C,  21, STC_MODEL_NAME(2514, STC_PROTO_STC15A), STC_MODEL_SIZE(  4096,  1024) },  /* F29C STC15F104 */
+    { 0xA0,   3, STC_MODEL_NAME(3204, STC_PROTO_STC15 ), STC_MODEL_SIZE(   512,     0) },  /* F2A0 STC15W100 */
+    { 0xA1,   3, STC_MODEL_NAME(3151, STC_PROTO_STC15 ), STC_MODEL_SIZE(  1024,  4096) },  /* F2A1 STC15W101 */
+    { 0xA2,   3, STC_MODEL_NAME(3105, STC_PROTO_STC15 ), STC_MODEL_SIZE(  2048,  3072) },  /* F2A2 STC15W102 */
+    { 0xA3,   3, STC_MODEL_NAME(2536, STC_PROTO_STC15 ), STC_MODEL_SIZE(  3072,  2048) },  /* F2A3 STC15W103 */
+    { 0xA4,   3, STC_MODEL_NAME(2514, STC_PROTO_STC15 ), STC_MODEL_SIZE(  4096,  1024) },  /* F2A4 STC15W104 */
+    { 0xA5,   2, STC_MODEL_NAME(2208, STC_PROTO_STC15 ), STC_MODEL_SIZE(  5120,     0) },  /* F2A5 IAP15W105 */
+    { 0xA6,   4, STC_MODEL_NAME(2134, STC_PROTO_STC15 ), STC_MODEL_SIZE(  7168,     0) },  /* F2A6 IRC15W107 */
+    { 0xB5,  20, STC_MODEL_NAME( 189, STC_PROTO_STC15 ), STC_MODEL_SIZE(  5120,     0) },  /* F2B5 IAP15F105W */
+    { 0xB6,  22, STC_MODEL_NAME( 184, STC_PROTO_STC15 ), STC_MODEL_SIZE(  7168,     0) },  /* F2B6 IRC15F107W */
+    { 0xBD,  20, STC_MODEL_NAME(2208, STC_PROTO_STC15A), STC_MODEL_SIZE(  5120,     0) },  /* F2BD IAP15F105 */
+    { 0xBE,  22, STC_MODEL_NAME(2134, STC_PROTO_STC15 ), STC_MODEL_SIZE(  7168,     0) },  /* F2BE IRC15F107 */
+    { 0xD0,   8, STC_MODEL_NAME( 214, STC_PROTO_STC15 ), STC_MODEL_SIZE(   512,     0) },  /* F2D0 STC15L100W */
+    { 0xD1,   8, STC_MODEL_NAME( 209, STC_PROTO_STC15 ), STC_MODEL_SIZE(  1024,  4096) },  /* F2D1 STC15L101W */
+    { 0xD2,   8, STC_MODEL_NAME( 204, STC_PROTO_STC15 ), STC_MODEL_SIZE(  2048,  3072) },  /* F2D2 STC15L102W */
+    { 0xD3,   8, STC_MODEL_NAME( 199, STC_PROTO_STC15 ), STC_MODEL_SIZE(  3072,  2048) },  /* F2D3 STC15L103W */
+    { 0xD4,   8, STC_MODEL_NAME( 194, STC_PROTO_STC15 ), STC_MODEL_SIZE(  4096,  1024) },  /* F2D4 STC15L104W */
+    { 0xD4,   8, STC_MODEL_NAME(1436, STC_PROTO_STC15A), STC_MODEL_SIZE(  4096,  1024) },  /* F2D4 STC15L104E */
+    { 0xD8,   8, STC_MODEL_NAME(3204, STC_PROTO_STC15A), STC_MODEL_SIZE(   512,     0) },  /* F2D8 STC15L100 */
+    { 0xD9,   8, STC_MODEL_NAME(3151, STC_PROTO_STC15A), STC_MODEL_SIZE(  1024,  4096) },  /* F2D9 STC15L101 */
+    { 0xDA,   8, STC_MODEL_NAME(3105, STC_PROTO_STC15A), STC_MODEL_SIZE(  2048,  3072) },  /* F2DA STC15L102 */
+    { 0xDB,   8, STC_MODEL_NAME(2536, STC_PROTO_STC15A), STC_MODEL_SIZE(  3072,  2048) },  /* F2DB STC15L103 */
+    { 0xDC,   8, STC_MODEL_NAME(2514, STC_PROTO_STC15A), STC_MODEL_SIZE(  4096,  1024) },  /* F2DC STC15L104 */
+    { 0xF5,   7, STC_MODEL_NAME( 189, STC_PROTO_STC15 ), STC_MODEL_SIZE(  5120,     0) },  /* F2F5 IAP15L105W */
+    { 0xF6,   9, STC_MODEL_NAME( 184, STC_PROTO_STC15 ), STC_MODEL_SIZE(  7168,     0) },  /* F2F6 IRC15L107W */
+    { 0xFD,   7, STC_MODEL_NAME(2208, STC_PROTO_STC15A), STC_MODEL_SIZE(  5120,     0) },  /* F2FD IAP15L105 */
+    { 0xFE,   9, STC_MODEL_NAME(2134, STC_PROTO_STC15 ), STC_MODEL_SIZE(  7168,     0) },  /* F2FE IRC15L107 */
+    { 0x94,  21, STC_MODEL_NAME(2051, STC_PROTO_STC15A), STC_MODEL_SIZE(  4096,  1024) },  /* F394 STC15F204EA */
+    { 0xB5,  20, STC_MODEL_NAME(2045, STC_PROTO_STC15A), STC_MODEL_SIZE(  5120,     0) },  /* F3B5 IAP15F205EA */
+    { 0xB6,  22, STC_MODEL_NAME(2057, STC_PROTO_STC15 ), STC_MODEL_SIZE(  7168,     0) },  /* F3B6 IRC15F207A */
+    { 0xD4,   8, STC_MODEL_NAME(2051, STC_PROTO_STC15A), STC_MODEL_SIZE(  4096,  1024) },  /* F3D4 STC15L204EA */
+    { 0xF5,   7, STC_MODEL_NAME(2045, STC_PROTO_STC15A), STC_MODEL_SIZE(  5120,     0) },  /* F3F5 IAP15L205EA */
+    { 0xF6,   9, STC_MODEL_NAME(2057, STC_PROTO_STC15 ), STC_MODEL_SIZE(  7168,     0) },  /* F3F6 IRC15L207A */
+    { 0x00,  22, STC_MODEL_NAME(2698, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F400 IRC15F1K63S2 */
+    { 0x01,  21, STC_MODEL_NAME(2572, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F401 STC15F2K08S2 */
+    { 0x02,  21, STC_MODEL_NAME(2628, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F402 STC15F2K16S2 */
+    { 0x03,  21, STC_MODEL_NAME(2670, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F403 STC15F2K24S2 */
+    { 0x04,  21, STC_MODEL_NAME(2726, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F404 STC15F2K32S2 */
+    { 0x05,  21, STC_MODEL_NAME(2803, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F405 STC15F2K40S2 */
+    { 0x06,  21, STC_MODEL_NAME(2551, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F406 STC15F2K48S2 */
+    { 0x07,  21, STC_MODEL_NAME(2600, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F407 STC15F2K56S2 */
+    { 0x08,  21, STC_MODEL_NAME(2782, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F408 STC15F2K60S2 */
+    { 0x09,  20, STC_MODEL_NAME(2768, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F409 IAP15F1K61S2 */
+    { 0x0A,  21, STC_MODEL_NAME(1751, STC_PROTO_STC15 ), STC_MODEL_SIZE(  4096,  9216) },  /* F40A STC15F404AD */
+    { 0x0B,  21, STC_MODEL_NAME(1638, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192,  5120) },  /* F40B STC15F408AD */
+    { 0x0C,  21, STC_MODEL_NAME(1860, STC_PROTO_STC15 ), STC_MODEL_SIZE( 12288,  1024) },  /* F40C STC15F412AD */
+    { 0x10,  22, STC_MODEL_NAME( 548, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F410 IRC15F1K63AS */
+    { 0x11,  21, STC_MODEL_NAME( 461, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F411 STC15F2K08AS */
+    { 0x12,  21, STC_MODEL_NAME( 495, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F412 STC15F2K16AS */
+    { 0x13,  21, STC_MODEL_NAME( 515, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F413 STC15F2K24AS */
+    { 0x14,  21, STC_MODEL_NAME( 561, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F414 STC15F2K32AS */
+    { 0x15,  21, STC_MODEL_NAME( 621, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F415 STC15F2K40AS */
+    { 0x16,  21, STC_MODEL_NAME( 447, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F416 STC15F2K48AS */
+    { 0x17,  21, STC_MODEL_NAME( 481, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F417 STC15F2K56AS */
+    { 0x18,  21, STC_MODEL_NAME( 607, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F418 STC15F2K60AS */
+    { 0x19,  20, STC_MODEL_NAME( 594, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F419 IAP15F1K61AS */
+    { 0x20,  22, STC_MODEL_NAME( 760, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F420 IRC15F1K63S */
+    { 0x21,  21, STC_MODEL_NAME( 666, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F421 STC15F2K08S */
+    { 0x22,  21, STC_MODEL_NAME( 700, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F422 STC15F2K16S */
+    { 0x23,  21, STC_MODEL_NAME( 727, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F423 STC15F2K24S */
+    { 0x24,  21, STC_MODEL_NAME( 781, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F424 STC15F2K32S */
+    { 0x25,  21, STC_MODEL_NAME( 848, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F425 STC15F2K40S */
+    { 0x26,  21, STC_MODEL_NAME( 654, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F426 STC15F2K48S */
+    { 0x27,  21, STC_MODEL_NAME( 688, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F427 STC15F2K56S */
+    { 0x28,  21, STC_MODEL_NAME( 836, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F428 STC15F2K60S */
+    { 0x29,  20, STC_MODEL_NAME( 814, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F429 IAP15F1K61S */
+    { 0x41,  21, STC_MODEL_NAME(2579, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F441 STC15F1K08S2 */
+    { 0x42,  21, STC_MODEL_NAME(2635, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F442 STC15F1K16S2 */
+    { 0x43,  21, STC_MODEL_NAME(2677, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F443 STC15F1K24S2 */
+    { 0x44,  21, STC_MODEL_NAME(2733, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F444 STC15F1K32S2 */
+    { 0x45,  21, STC_MODEL_NAME(2810, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F445 STC15F1K40S2 */
+    { 0x46,  21, STC_MODEL_NAME(2558, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F446 STC15F1K48S2 */
+    { 0x47,  21, STC_MODEL_NAME(2607, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F447 STC15F1K56S2 */
+    { 0x48,  21, STC_MODEL_NAME(2789, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F448 STC15F1K60S2 */
+    { 0x49,  20, STC_MODEL_NAME(2761, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F449 IAP15F2K61S2 */
+    { 0x4A,  22, STC_MODEL_NAME(2691, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F44A IRC15F2K63S2 */
+    { 0x4B,  70, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 62464,     0) },  /* F44B U7-5V */
+    { 0x4C,  69, STC_MODEL_NAME( 293, STC_PROTO_COUNT ), STC_MODEL_SIZE( 62464,     0) },  /* F44C U8-5V */
+    { 0x4D,  20, STC_MODEL_NAME(1770, STC_PROTO_STC15 ), STC_MODEL_SIZE( 13312,     0) },  /* F44D IAP15F413AD */
+    { 0x51,  21, STC_MODEL_NAME( 468, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F451 STC15F1K08AS */
+    { 0x52,  21, STC_MODEL_NAME( 502, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F452 STC15F1K16AS */
+    { 0x53,  21, STC_MODEL_NAME( 522, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F453 STC15F1K24AS */
+    { 0x54,  21, STC_MODEL_NAME( 568, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F454 STC15F1K32AS */
+    { 0x55,  21, STC_MODEL_NAME( 628, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F455 STC15F1K40AS */
+    { 0x56,  21, STC_MODEL_NAME( 454, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F456 STC15F1K48AS */
+    { 0x57,  21, STC_MODEL_NAME( 488, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F457 STC15F1K56AS */
+    { 0x58,  21, STC_MODEL_NAME( 614, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F458 STC15F1K60AS */
+    { 0x59,  20, STC_MODEL_NAME( 587, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F459 IAP15F2K61AS */
+    { 0x5A,  22, STC_MODEL_NAME( 541, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F45A IRC15F2K63AS */
+    { 0x61,  21, STC_MODEL_NAME( 672, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F461 STC15F1K08S */
+    { 0x62,  21, STC_MODEL_NAME( 706, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F462 STC15F1K16S */
+    { 0x63,  21, STC_MODEL_NAME( 733, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F463 STC15F1K24S */
+    { 0x64,  21, STC_MODEL_NAME( 787, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F464 STC15F1K32S */
+    { 0x65,  21, STC_MODEL_NAME( 854, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F465 STC15F1K40S */
+    { 0x66,  21, STC_MODEL_NAME( 660, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F466 STC15F1K48S */
+    { 0x67,  21, STC_MODEL_NAME( 694, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F467 STC15F1K56S */
+    { 0x68,  21, STC_MODEL_NAME( 842, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F468 STC15F1K60S */
+    { 0x69,  20, STC_MODEL_NAME( 808, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F469 IAP15F2K61S */
+    { 0x6A,  22, STC_MODEL_NAME( 754, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F46A IRC15F2K63S */
+    { 0x80,   9, STC_MODEL_NAME(2698, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F480 IRC15L1K63S2 */
+    { 0x81,   8, STC_MODEL_NAME(2572, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F481 STC15L2K08S2 */
+    { 0x82,   8, STC_MODEL_NAME(2628, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F482 STC15L2K16S2 */
+    { 0x83,   8, STC_MODEL_NAME(2670, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F483 STC15L2K24S2 */
+    { 0x84,   8, STC_MODEL_NAME(2726, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F484 STC15L2K32S2 */
+    { 0x85,   8, STC_MODEL_NAME(2803, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F485 STC15L2K40S2 */
+    { 0x86,   8, STC_MODEL_NAME(2551, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F486 STC15L2K48S2 */
+    { 0x87,   8, STC_MODEL_NAME(2600, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F487 STC15L2K56S2 */
+    { 0x88,   8, STC_MODEL_NAME(2782, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F488 STC15L2K60S2 */
+    { 0x89,   7, STC_MODEL_NAME(2768, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F489 IAP15L1K61S2 */
+    { 0x8A,   8, STC_MODEL_NAME(1751, STC_PROTO_STC15 ), STC_MODEL_SIZE(  4096,  9216) },  /* F48A STC15L404AD */
+    { 0x8B,   8, STC_MODEL_NAME(1638, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192,  5120) },  /* F48B STC15L408AD */
+    { 0x8C,   8, STC_MODEL_NAME(1860, STC_PROTO_STC15 ), STC_MODEL_SIZE( 12288,  1024) },  /* F48C STC15L412AD */
+    { 0x90,   9, STC_MODEL_NAME( 548, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F490 IRC15L1K63AS */
+    { 0x91,   8, STC_MODEL_NAME( 461, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F491 STC15L2K08AS */
+    { 0x92,   8, STC_MODEL_NAME( 495, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F492 STC15L2K16AS */
+    { 0x93,   8, STC_MODEL_NAME( 515, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F493 STC15L2K24AS */
+    { 0x94,   8, STC_MODEL_NAME( 561, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F494 STC15L2K32AS */
+    { 0x95,   8, STC_MODEL_NAME( 621, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F495 STC15L2K40AS */
+    { 0x96,   8, STC_MODEL_NAME( 447, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F496 STC15L2K48AS */
+    { 0x97,   8, STC_MODEL_NAME( 481, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F497 STC15L2K56AS */
+    { 0x98,   8, STC_MODEL_NAME( 607, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F498 STC15L2K60AS */
+    { 0x99,   7, STC_MODEL_NAME( 594, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F499 IAP15L1K61AS */
+    { 0xA0,   9, STC_MODEL_NAME( 760, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F4A0 IRC15L1K63S */
+    { 0xA1,   8, STC_MODEL_NAME( 666, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F4A1 STC15L2K08S */
+    { 0xA2,   8, STC_MODEL_NAME( 700, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F4A2 STC15L2K16S */
+    { 0xA3,   8, STC_MODEL_NAME( 727, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F4A3 STC15L2K24S */
+    { 0xA4,   8, STC_MODEL_NAME( 781, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F4A4 STC15L2K32S */
+    { 0xA5,   8, STC_MODEL_NAME( 848, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F4A5 STC15L2K40S */
+    { 0xA6,   8, STC_MODEL_NAME( 654, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F4A6 STC15L2K48S */
+    { 0xA7,   8, STC_MODEL_NAME( 688, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F4A7 STC15L2K56S */
+    { 0xA8,   8, STC_MODEL_NAME( 836, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F4A8 STC15L2K60S */
+    { 0xA9,   7, STC_MODEL_NAME( 814, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F4A9 IAP15L1K61S */
+    { 0xC1,   8, STC_MODEL_NAME(2579, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F4C1 STC15L1K08S2 */
+    { 0xC2,   8, STC_MODEL_NAME(2635, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F4C2 STC15L1K16S2 */
+    { 0xC3,   8, STC_MODEL_NAME(2677, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F4C3 STC15L1K24S2 */
+    { 0xC4,   8, STC_MODEL_NAME(2733, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F4C4 STC15L1K32S2 */
+    { 0xC5,   8, STC_MODEL_NAME(2810, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F4C5 STC15L1K40S2 */
+    { 0xC6,   8, STC_MODEL_NAME(2558, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F4C6 STC15L1K48S2 */
+    { 0xC7,   8, STC_MODEL_NAME(2607, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F4C7 STC15L1K56S2 */
+    { 0xC8,   8, STC_MODEL_NAME(2789, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F4C8 STC15L1K60S2 */
+    { 0xC9,   7, STC_MODEL_NAME(2761, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F4C9 IAP15L2K61S2 */
+    { 0xCA,   9, STC_MODEL_NAME(2691, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F4CA IRC15L2K63S2 */
+    { 0xCB,  70, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 62464,     0) },  /* F4CB U7-3V */
+    { 0xCC,  69, STC_MODEL_NAME( 371, STC_PROTO_COUNT ), STC_MODEL_SIZE( 62464,     0) },  /* F4CC U8-3V */
+    { 0xCD,   7, STC_MODEL_NAME(1770, STC_PROTO_STC15 ), STC_MODEL_SIZE( 13312,     0) },  /* F4CD IAP15L413AD */
+    { 0xD1,   8, STC_MODEL_NAME( 468, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F4D1 STC15L1K08AS */
+    { 0xD2,   8, STC_MODEL_NAME( 502, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F4D2 STC15L1K16AS */
+    { 0xD3,   8, STC_MODEL_NAME( 522, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F4D3 STC15L1K24AS */
+    { 0xD4,   8, STC_MODEL_NAME( 568, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F4D4 STC15L1K32AS */
+    { 0xD5,   8, STC_MODEL_NAME( 628, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F4D5 STC15L1K40AS */
+    { 0xD6,   8, STC_MODEL_NAME( 454, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F4D6 STC15L1K48AS */
+    { 0xD7,   8, STC_MODEL_NAME( 488, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F4D7 STC15L1K56AS */
+    { 0xD8,   8, STC_MODEL_NAME( 614, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F4D8 STC15L1K60AS */
+    { 0xD9,   7, STC_MODEL_NAME( 587, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F4D9 IAP15L2K61AS */
+    { 0xDA,   9, STC_MODEL_NAME( 541, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F4DA IRC15L2K63AS */
+    { 0xE1,   8, STC_MODEL_NAME( 672, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 54272) },  /* F4E1 STC15L1K08S */
+    { 0xE2,   8, STC_MODEL_NAME( 706, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 46080) },  /* F4E2 STC15L1K16S */
+    { 0xE3,   8, STC_MODEL_NAME( 733, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 37888) },  /* F4E3 STC15L1K24S */
+    { 0xE4,   8, STC_MODEL_NAME( 787, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 29696) },  /* F4E4 STC15L1K32S */
+    { 0xE5,   8, STC_MODEL_NAME( 854, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 21504) },  /* F4E5 STC15L1K40S */
+    { 0xE6,   8, STC_MODEL_NAME( 660, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 13312) },  /* F4E6 STC15L1K48S */
+    { 0xE7,   8, STC_MODEL_NAME( 694, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  5120) },  /* F4E7 STC15L1K56S */
+    { 0xE8,   8, STC_MODEL_NAME( 842, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  1024) },  /* F4E8 STC15L1K60S */
+    { 0xE9,   7, STC_MODEL_NAME( 808, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F4E9 IAP15L2K61S */
+    { 0xEA,   9, STC_MODEL_NAME( 754, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F4EA IRC15L2K63S */
+    { 0x01,   3, STC_MODEL_NAME( 178, STC_PROTO_STC15 ), STC_MODEL_SIZE(  1024,  4096) },  /* F501 STC15W101SW */
+    { 0x02,   3, STC_MODEL_NAME( 172, STC_PROTO_STC15 ), STC_MODEL_SIZE(  2048,  3072) },  /* F502 STC15W102SW */
+    { 0x03,   3, STC_MODEL_NAME( 166, STC_PROTO_STC15 ), STC_MODEL_SIZE(  3072,  2048) },  /* F503 STC15W103SW */
+    { 0x04,   3, STC_MODEL_NAME( 160, STC_PROTO_STC15 ), STC_MODEL_SIZE(  4096,  1024) },  /* F504 STC15W104SW */
+    { 0x08,   3, STC_MODEL_NAME( 831, STC_PROTO_STC15 ), STC_MODEL_SIZE(  1024,  4096) },  /* F508 STC15W101S */
+    { 0x0A,   3, STC_MODEL_NAME( 803, STC_PROTO_STC15 ), STC_MODEL_SIZE(  2048,  3072) },  /* F50A STC15W102S */
+    { 0x0B,   3, STC_MODEL_NAME( 776, STC_PROTO_STC15 ), STC_MODEL_SIZE(  3072,  2048) },  /* F50B STC15W103S */
+    { 0x0C,   3, STC_MODEL_NAME( 749, STC_PROTO_STC15 ), STC_MODEL_SIZE(  4096,  1024) },  /* F50C STC15W104S */
+    { 0x11,   3, STC_MODEL_NAME( 826, STC_PROTO_STC15 ), STC_MODEL_SIZE(  1024,  4096) },  /* F511 STC15W201S */
+    { 0x12,   3, STC_MODEL_NAME( 798, STC_PROTO_STC15 ), STC_MODEL_SIZE(  2048,  3072) },  /* F512 STC15W202S */
+    { 0x13,   3, STC_MODEL_NAME( 771, STC_PROTO_STC15 ), STC_MODEL_SIZE(  3072,  2048) },  /* F513 STC15W203S */
+    { 0x14,   3, STC_MODEL_NAME( 744, STC_PROTO_STC15 ), STC_MODEL_SIZE(  4096,  1024) },  /* F514 STC15W204S */
+    { 0x16,   3, STC_MODEL_NAME( 706, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 13312) },  /* F516 STC15W1K16S */
+    { 0x17,   3, STC_MODEL_NAME( 733, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576,  5120) },  /* F517 STC15W1K24S */
+    { 0x19,   3, STC_MODEL_NAME( 739, STC_PROTO_STC15 ), STC_MODEL_SIZE(  4096,  9216) },  /* F519 STC15W404S */
+    { 0x1A,   3, STC_MODEL_NAME( 678, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192,  5120) },  /* F51A STC15W408S */
+    { 0x1B,   3, STC_MODEL_NAME( 866, STC_PROTO_STC15 ), STC_MODEL_SIZE( 10240,  3072) },  /* F51B STC15W410S */
+    { 0x1C,   3, STC_MODEL_NAME( 793, STC_PROTO_STC15 ), STC_MODEL_SIZE( 12288,  1024) },  /* F51C STC15W412S */
+    { 0x1E,   3, STC_MODEL_NAME( 535, STC_PROTO_STC15 ), STC_MODEL_SIZE(  4096,  9216) },  /* F51E STC15W404AS */
+    { 0x1F,   3, STC_MODEL_NAME( 475, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192,  5120) },  /* F51F STC15W408AS */
+    { 0x20,   3, STC_MODEL_NAME( 642, STC_PROTO_STC15 ), STC_MODEL_SIZE( 10240,  3072) },  /* F520 STC15W410AS */
+    { 0x21,   3, STC_MODEL_NAME( 575, STC_PROTO_STC15 ), STC_MODEL_SIZE( 12288,  1024) },  /* F521 STC15W412AS */
+    { 0x23,   3, STC_MODEL_NAME(2268, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 44032) },  /* F523 STC15W4K16S4 */
+    { 0x24,   3, STC_MODEL_NAME(2310, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 35840) },  /* F524 STC15W4K24S4 */
+    { 0x25,   3, STC_MODEL_NAME(2338, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 27648) },  /* F525 STC15W4K32S4 */
+    { 0x26,   3, STC_MODEL_NAME(2380, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 19456) },  /* F526 STC15W4K40S4 */
+    { 0x27,   3, STC_MODEL_NAME(2219, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 11264) },  /* F527 STC15W4K48S4 */
+    { 0x28,   3, STC_MODEL_NAME(2254, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  3072) },  /* F528 STC15W4K56S4 */
+    { 0x2A,   3, STC_MODEL_NAME( 601, STC_PROTO_STC15 ), STC_MODEL_SIZE(  1024, 12288) },  /* F52A STC15W401AS */
+    { 0x2B,   3, STC_MODEL_NAME( 581, STC_PROTO_STC15 ), STC_MODEL_SIZE(  2048, 11264) },  /* F52B STC15W402AS */
+    { 0x2D,   3, STC_MODEL_NAME(1228, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 52224) },  /* F52D STC15W1K08PWM */
+    { 0x2E,   3, STC_MODEL_NAME(1236, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 44032) },  /* F52E STC15W1K16PWM */
+    { 0x2F,   3, STC_MODEL_NAME( 860, STC_PROTO_STC15 ), STC_MODEL_SIZE( 20480, 39936) },  /* F52F STC15W1K20S */
+    { 0x30,   3, STC_MODEL_NAME(2726, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 27648) },  /* F530 STC15W2K32S2 */
+    { 0x31,   3, STC_MODEL_NAME(2551, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 11264) },  /* F531 STC15W2K48S2 */
+    { 0x32,   3, STC_MODEL_NAME( 561, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 27648) },  /* F532 STC15W2K32AS */
+    { 0x33,   3, STC_MODEL_NAME( 447, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 11264) },  /* F533 STC15W2K48AS */
+    { 0x34,   3, STC_MODEL_NAME( 635, STC_PROTO_STC15 ), STC_MODEL_SIZE( 20480, 39936) },  /* F534 STC15W1K20AS */
+    { 0x35,   3, STC_MODEL_NAME( 568, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 27648) },  /* F535 STC15W1K32AS */
+    { 0x36,   3, STC_MODEL_NAME( 454, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 11264) },  /* F536 STC15W1K48AS */
+    { 0x45,   2, STC_MODEL_NAME( 154, STC_PROTO_STC15 ), STC_MODEL_SIZE(  5120,     0) },  /* F545 IAP15W105SW */
+    { 0x4D,   2, STC_MODEL_NAME( 722, STC_PROTO_STC15 ), STC_MODEL_SIZE(  5120,     0) },  /* F54D IAP15W105S */
+    { 0x55,   2, STC_MODEL_NAME( 717, STC_PROTO_STC15 ), STC_MODEL_SIZE(  5120,     0) },  /* F555 IAP15W205S */
+    { 0x56,   4, STC_MODEL_NAME( 683, STC_PROTO_STC15 ), STC_MODEL_SIZE(  7680,     0) },  /* F556 IRC15W207S */
+    { 0x58,   2, STC_MODEL_NAME( 648, STC_PROTO_STC15 ), STC_MODEL_SIZE( 29696,     0) },  /* F558 IAP15W1K29S */
+    { 0x59,   4, STC_MODEL_NAME( 820, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32256,     0) },  /* F559 IRC15W1K31S */
+    { 0x5D,   2, STC_MODEL_NAME( 766, STC_PROTO_STC15 ), STC_MODEL_SIZE( 13312,     0) },  /* F55D IAP15W413S */
+    { 0x5E,   4, STC_MODEL_NAME( 712, STC_PROTO_STC15 ), STC_MODEL_SIZE( 15872,     0) },  /* F55E IRC15W415S */
+    { 0x62,   2, STC_MODEL_NAME( 555, STC_PROTO_STC15 ), STC_MODEL_SIZE( 13312,     0) },  /* F562 IAP15W413AS */
+    { 0x63,   4, STC_MODEL_NAME( 509, STC_PROTO_STC15 ), STC_MODEL_SIZE( 15872,     0) },  /* F563 IRC15W415AS */
+    { 0x64,   2, STC_MODEL_NAME( 529, STC_PROTO_STC15 ), STC_MODEL_SIZE( 14336,     0) },  /* F564 IAP15W414AS */
+    { 0x69,   2, STC_MODEL_NAME(2212, STC_PROTO_STC15 ), STC_MODEL_SIZE( 59392,     0) },  /* F569 IAP15W4K58S4 */
+    { 0x6A,   2, STC_MODEL_NAME(2359, STC_PROTO_STC15 ), STC_MODEL_SIZE( 62464,     0) },  /* F56A IAP15W4K61S4 */
+    { 0x6B,   4, STC_MODEL_NAME(2324, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,     0) },  /* F56B IRC15W4K63S4 */
+    { 0x6C,  69, STC_MODEL_NAME( 217, STC_PROTO_COUNT ), STC_MODEL_SIZE( 62464,     0) },  /* F56C U8W */
+    { 0x6D,   2, STC_MODEL_NAME(   0, STC_PROTO_STC15 ), STC_MODEL_SIZE( 59392,     0) },  /* F56D IAP15W4K58S4-Student */
+    { 0x6E,   2, STC_MODEL_NAME(2331, STC_PROTO_STC15 ), STC_MODEL_SIZE( 63488,     0) },  /* F56E IAP15W4K62S4 */
+    { 0x01,  15, STC_MODEL_NAME(2240, STC_PROTO_STC15 ), STC_MODEL_SIZE(  8192, 57344) },  /* F601 STC15H4K08S4 */
+    { 0x02,  15, STC_MODEL_NAME(2268, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 49152) },  /* F602 STC15H4K16S4 */
+    { 0x03,  15, STC_MODEL_NAME(2310, STC_PROTO_STC15 ), STC_MODEL_SIZE( 24576, 40960) },  /* F603 STC15H4K24S4 */
+    { 0x04,  15, STC_MODEL_NAME(2338, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 32768) },  /* F604 STC15H4K32S4 */
+    { 0x05,  15, STC_MODEL_NAME(2380, STC_PROTO_STC15 ), STC_MODEL_SIZE( 40960, 24576) },  /* F605 STC15H4K40S4 */
+    { 0x06,  15, STC_MODEL_NAME(2219, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 16384) },  /* F606 STC15H4K48S4 */
+    { 0x07,  15, STC_MODEL_NAME(2254, STC_PROTO_STC15 ), STC_MODEL_SIZE( 57344,  8192) },  /* F607 STC15H4K56S4 */
+    { 0x08,  15, STC_MODEL_NAME(2289, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,   512) },  /* F608 STC15H4K64S4 */
+    { 0x11,  19, STC_MODEL_NAME(2897, STC_PROTO_STC8  ), STC_MODEL_SIZE(  8192, 57344) },  /* F611 STC8F8K08S4A12 */
+    { 0x12,  19, STC_MODEL_NAME(2917, STC_PROTO_STC8  ), STC_MODEL_SIZE( 16384, 49152) },  /* F612 STC8F8K16S4A12 */
+    { 0x13,  19, STC_MODEL_NAME(2937, STC_PROTO_STC8  ), STC_MODEL_SIZE( 24576, 40960) },  /* F613 STC8F8K24S4A12 */
+    { 0x14,  19, STC_MODEL_NAME(2947, STC_PROTO_STC8  ), STC_MODEL_SIZE( 32768, 32768) },  /* F614 STC8F8K32S4A12 */
+    { 0x15,  19, STC_MODEL_NAME(2967, STC_PROTO_STC8  ), STC_MODEL_SIZE( 40960, 24576) },  /* F615 STC8F8K40S4A12 */
+    { 0x16,  19, STC_MODEL_NAME(2887, STC_PROTO_STC8  ), STC_MODEL_SIZE( 49152, 16384) },  /* F616 STC8F8K48S4A12 */
+    { 0x17,  19, STC_MODEL_NAME(2907, STC_PROTO_STC8  ), STC_MODEL_SIZE( 57344,  8192) },  /* F617 STC8F8K56S4A12 */
+    { 0x18,  19, STC_MODEL_NAME(2927, STC_PROTO_STC8  ), STC_MODEL_SIZE( 65024,   512) },  /* F618 STC8F8K64S4A12 */
+    { 0x19,  19, STC_MODEL_NAME(2957, STC_PROTO_STC8  ), STC_MODEL_SIZE( 61440,  4096) },  /* F619 STC8F8K60S4A12 */
+    { 0x21,  66, STC_MODEL_NAME(2897, STC_PROTO_STC8  ), STC_MODEL_SIZE(  8192, 57344) },  /* F621 STC8A8K08S4A12 */
+    { 0x22,  66, STC_MODEL_NAME(2917, STC_PROTO_STC8  ), STC_MODEL_SIZE( 16384, 49152) },  /* F622 STC8A8K16S4A12 */
+    { 0x23,  66, STC_MODEL_NAME(2937, STC_PROTO_STC8  ), STC_MODEL_SIZE( 24576, 40960) },  /* F623 STC8A8K24S4A12 */
+    { 0x24,  66, STC_MODEL_NAME(2947, STC_PROTO_STC8  ), STC_MODEL_SIZE( 32768, 32768) },  /* F624 STC8A8K32S4A12 */
+    { 0x25,  66, STC_MODEL_NAME(2967, STC_PROTO_STC8  ), STC_MODEL_SIZE( 40960, 24576) },  /* F625 STC8A8K40S4A12 */
+    { 0x26,  66, STC_MODEL_NAME(2887, STC_PROTO_STC8  ), STC_MODEL_SIZE( 49152, 16384) },  /* F626 STC8A8K48S4A12 */
+    { 0x27,  66, STC_MODEL_NAME(2907, STC_PROTO_STC8  ), STC_MODEL_SIZE( 57344,  8192) },  /* F627 STC8A8K56S4A12 */
+    { 0x28,  66, STC_MODEL_NAME(2927, STC_PROTO_STC8  ), STC_MODEL_SIZE( 65024,   512) },  /* F628 STC8A8K64S4A12 */
+    { 0x29,  66, STC_MODEL_NAME(2957, STC_PROTO_STC8  ), STC_MODEL_SIZE( 61440,  4096) },  /* F629 STC8A8K60S4A12 */
+    { 0x31,  19, STC_MODEL_NAME(2247, STC_PROTO_STC8  ), STC_MODEL_SIZE(  8192, 57344) },  /* F631 STC8F2K08S4 */
+    { 0x32,  19, STC_MODEL_NAME(2282, STC_PROTO_STC8  ), STC_MODEL_SIZE( 16384, 49152) },  /* F632 STC8F2K16S4 */
+    { 0x33,  19, STC_MODEL_NAME(2317, STC_PROTO_STC8  ), STC_MODEL_SIZE( 24576, 40960) },  /* F633 STC8F2K24S4 */
+    { 0x34,  19, STC_MODEL_NAME(2352, STC_PROTO_STC8  ), STC_MODEL_SIZE( 32768, 32768) },  /* F634 STC8F2K32S4 */
+    { 0x35,  19, STC_MODEL_NAME(2387, STC_PROTO_STC8  ), STC_MODEL_SIZE( 40960, 24576) },  /* F635 STC8F2K40S4 */
+    { 0x36,  19, STC_MODEL_NAME(2233, STC_PROTO_STC8  ), STC_MODEL_SIZE( 49152, 16384) },  /* F636 STC8F2K48S4 */
+    { 0x37,  19, STC_MODEL_NAME(2261, STC_PROTO_STC8  ), STC_MODEL_SIZE( 57344,  8192) },  /* F637 STC8F2K56S4 */
+    { 0x38,  19, STC_MODEL_NAME(2303, STC_PROTO_STC8  ), STC_MODEL_SIZE( 65024,   512) },  /* F638 STC8F2K64S4 */
+    { 0x39,  19, STC_MODEL_NAME(2373, STC_PROTO_STC8  ), STC_MODEL_SIZE( 61440,  4096) },  /* F639 STC8F2K60S4 */
+    { 0x41,  19, STC_MODEL_NAME(2572, STC_PROTO_STC8  ), STC_MODEL_SIZE(  8192, 57344) },  /* F641 STC8F2K08S2 */
+    { 0x42,  19, STC_MODEL_NAME(2628, STC_PROTO_STC8  ), STC_MODEL_SIZE( 16384, 49152) },  /* F642 STC8F2K16S2 */
+    { 0x43,  19, STC_MODEL_NAME(2670, STC_PROTO_STC8  ), STC_MODEL_SIZE( 24576, 40960) },  /* F643 STC8F2K24S2 */
+    { 0x44,  19, STC_MODEL_NAME(2726, STC_PROTO_STC8  ), STC_MODEL_SIZE( 32768, 32768) },  /* F644 STC8F2K32S2 */
+    { 0x45,  19, STC_MODEL_NAME(2803, STC_PROTO_STC8  ), STC_MODEL_SIZE( 40960, 24576) },  /* F645 STC8F2K40S2 */
+    { 0x46,  19, STC_MODEL_NAME(2551, STC_PROTO_STC8  ), STC_MODEL_SIZE( 49152, 16384) },  /* F646 STC8F2K48S2 */
+    { 0x47,  19, STC_MODEL_NAME(2600, STC_PROTO_STC8  ), STC_MODEL_SIZE( 57344,  8192) },  /* F647 STC8F2K56S2 */
+    { 0x48,  19, STC_MODEL_NAME(2663, STC_PROTO_STC8  ), STC_MODEL_SIZE( 65024,   512) },  /* F648 STC8F2K64S2 */
+    { 0x49,  19, STC_MODEL_NAME(2782, STC_PROTO_STC8  ), STC_MODEL_SIZE( 61440,  4096) },  /* F649 STC8F2K60S2 */
+    { 0x51,  66, STC_MODEL_NAME(2987, STC_PROTO_STC8  ), STC_MODEL_SIZE(  8192, 57344) },  /* F651 STC8A4K08S2A12 */
+    { 0x52,  66, STC_MODEL_NAME(3007, STC_PROTO_STC8  ), STC_MODEL_SIZE( 16384, 49152) },  /* F652 STC8A4K16S2A12 */
+    { 0x53,  66, STC_MODEL_NAME(3027, STC_PROTO_STC8  ), STC_MODEL_SIZE( 24576, 40960) },  /* F653 STC8A4K24S2A12 */
+    { 0x54,  66, STC_MODEL_NAME(3037, STC_PROTO_STC8  ), STC_MODEL_SIZE( 32768, 32768) },  /* F654 STC8A4K32S2A12 */
+    { 0x55,  66, STC_MODEL_NAME(3057, STC_PROTO_STC8  ), STC_MODEL_SIZE( 40960, 24576) },  /* F655 STC8A4K40S2A12 */
+    { 0x56,  66, STC_MODEL_NAME(2977, STC_PROTO_STC8  ), STC_MODEL_SIZE( 49152, 16384) },  /* F656 STC8A4K48S2A12 */
+    { 0x57,  66, STC_MODEL_NAME(2997, STC_PROTO_STC8  ), STC_MODEL_SIZE( 57344,  8192) },  /* F657 STC8A4K56S2A12 */
+    { 0x58,  66, STC_MODEL_NAME(3017, STC_PROTO_STC8  ), STC_MODEL_SIZE( 65024,   512) },  /* F658 STC8A4K64S2A12 */
+    { 0x59,  66, STC_MODEL_NAME(3047, STC_PROTO_STC8  ), STC_MODEL_SIZE( 61440,  4096) },  /* F659 STC8A4K60S2A12 */
+    { 0x61,  19, STC_MODEL_NAME(2754, STC_PROTO_STC8  ), STC_MODEL_SIZE(  2048, 10240) },  /* F661 STC8F1K02S2 */
+    { 0x62,  19, STC_MODEL_NAME(2684, STC_PROTO_STC8  ), STC_MODEL_SIZE(  4096,  8192) },  /* F662 STC8F1K04S2 */
+    { 0x63,  19, STC_MODEL_NAME(2649, STC_PROTO_STC8  ), STC_MODEL_SIZE(  6144,  6144) },  /* F663 STC8F1K06S2 */
+    { 0x64,  19, STC_MODEL_NAME(2579, STC_PROTO_STC8  ), STC_MODEL_SIZE(  8192,  4096) },  /* F664 STC8F1K08S2 */
+    { 0x65,  19, STC_MODEL_NAME(2824, STC_PROTO_STC8  ), STC_MODEL_SIZE( 10240,  2048) },  /* F665 STC8F1K10S2 */
+    { 0x66,  19, STC_MODEL_NAME(2747, STC_PROTO_STC8  ), STC_MODEL_SIZE( 12288,     0) },  /* F666 STC8F1K12S2 */
+    { 0x67,  19, STC_MODEL_NAME(2593, STC_PROTO_STC8  ), STC_MODEL_SIZE( 17408,     0) },  /* F667 STC8F1K17S2 */
+    { 0x71,  19, STC_MODEL_NAME(3085, STC_PROTO_STC8  ), STC_MODEL_SIZE(  2048, 10240) },  /* F671 STC8F1K02 */
+    { 0x72,  19, STC_MODEL_NAME(2494, STC_PROTO_STC8  ), STC_MODEL_SIZE(  4096,  8192) },  /* F672 STC8F1K04 */
+    { 0x73,  19, STC_MODEL_NAME(2178, STC_PROTO_STC8  ), STC_MODEL_SIZE(  6144,  6144) },  /* F673 STC8F1K06 */
+    { 0x74,  19, STC_MODEL_NAME(2109, STC_PROTO_STC8  ), STC_MODEL_SIZE(  8192,  4096) },  /* F674 STC8F1K08 */
+    { 0x75,  19, STC_MODEL_NAME(3190, STC_PROTO_STC8  ), STC_MODEL_SIZE( 10240,  2048) },  /* F675 STC8F1K10 */
+    { 0x76,  19, STC_MODEL_NAME(2882, STC_PROTO_STC8  ), STC_MODEL_SIZE( 12288,     0) },  /* F676 STC8F1K12 */
+    { 0x77,  19, STC_MODEL_NAME(2129, STC_PROTO_STC8  ), STC_MODEL_SIZE( 17408,     0) },  /* F677 STC8F1K17 */
+    { 0x01,  62, STC_MODEL_NAME(3085, STC_PROTO_STC8  ), STC_MODEL_SIZE(  2048, 10240) },  /* F701 STC8C1K02 */
+    { 0x02,  62, STC_MODEL_NAME(2494, STC_PROTO_STC8  ), STC_MODEL_SIZE(  4096,  8192) },  /* F702 STC8C1K04 */
+    { 0x03,  62, STC_MODEL_NAME(2178, STC_PROTO_STC8  ), STC_MODEL_SIZE(  6144,  6144) },  /* F703 STC8C1K06 */
+    { 0x04,  62, STC_MODEL_NAME(2109, STC_PROTO_STC8  ), STC_MODEL_SIZE(  8192,  4096) },  /* F704 STC8C1K08 */
+    { 0x05,  62, STC_MODEL_NAME(3190, STC_PROTO_STC8  ), STC_MODEL_SIZE( 10240,  2048) },  /* F705 STC8C1K10 */
+    { 0x06,  62, STC_MODEL_NAME(2882, STC_PROTO_STC8  ), STC_MODEL_SIZE( 12288,     0) },  /* F706 STC8C1K12 */
+    { 0x14,   5, STC_MODEL_NAME(2540, STC_PROTO_COUNT ), STC_MODEL_SIZE(  8192,  4096) },  /* F714 GX8S003 */
+    { 0x16,   5, STC_MODEL_NAME(3081, STC_PROTO_COUNT ), STC_MODEL_SIZE( 12288,     0) },  /* F716 GX8S012 */
+    { 0x21,  14, STC_MODEL_NAME(2154, STC_PROTO_STC8G ), STC_MODEL_SIZE( 16384, 12288) },  /* F721 STC8H1K16 */
+    { 0x22,  14, STC_MODEL_NAME(3175, STC_PROTO_STC8G ), STC_MODEL_SIZE( 20480,  8192) },  /* F722 STC8H1K20 */
+    { 0x23,  14, STC_MODEL_NAME(2475, STC_PROTO_STC8G ), STC_MODEL_SIZE( 24576,  4096) },  /* F723 STC8H1K24 */
+    { 0x24,  14, STC_MODEL_NAME(2087, STC_PROTO_STC8G ), STC_MODEL_SIZE( 28672,     0) },  /* F724 STC8H1K28 */
+    { 0x25,  14, STC_MODEL_NAME(2521, STC_PROTO_STC8G ), STC_MODEL_SIZE( 33792,     0) },  /* F725 STC8H1K33 */
+    { 0x31,  14, STC_MODEL_NAME(3085, STC_PROTO_STC8G ), STC_MODEL_SIZE(  2048, 10240) },  /* F731 STC8H1K02 */
+    { 0x32,  14, STC_MODEL_NAME(2494, STC_PROTO_STC8G ), STC_MODEL_SIZE(  4096,  8192) },  /* F732 STC8H1K04 */
+    { 0x33,  14, STC_MODEL_NAME(2178, STC_PROTO_STC8G ), STC_MODEL_SIZE(  6144,  6144) },  /* F733 STC8H1K06 */
+    { 0x34,  14, STC_MODEL_NAME(2109, STC_PROTO_STC8G ), STC_MODEL_SIZE(  8192,  4096) },  /* F734 STC8H1K08 */
+    { 0x35,  14, STC_MODEL_NAME(3190, STC_PROTO_STC8G ), STC_MODEL_SIZE( 10240,  2048) },  /* F735 STC8H1K10 */
+    { 0x36,  14, STC_MODEL_NAME(2882, STC_PROTO_STC8G ), STC_MODEL_SIZE( 12288,     0) },  /* F736 STC8H1K12 */
+    { 0x37,  14, STC_MODEL_NAME(2129, STC_PROTO_STC8G ), STC_MODEL_SIZE( 17408,     0) },  /* F737 STC8H1K17 */
+    { 0x41,  14, STC_MODEL_NAME(2275, STC_PROTO_STC8D ), STC_MODEL_SIZE( 16384, 49152) },  /* F741 STC8H3K16S4 */
+    { 0x42,  14, STC_MODEL_NAME(2345, STC_PROTO_STC8D ), STC_MODEL_SIZE( 32768, 32768) },  /* F742 STC8H3K32S4 */
+    { 0x43,  14, STC_MODEL_NAME(2366, STC_PROTO_STC8D ), STC_MODEL_SIZE( 61440,  4096) },  /* F743 STC8H3K60S4 */
+    { 0x44,  14, STC_MODEL_NAME(2296, STC_PROTO_STC8D ), STC_MODEL_SIZE( 65024,   512) },  /* F744 STC8H3K64S4 */
+    { 0x45,  14, STC_MODEL_NAME(2226, STC_PROTO_STC8D ), STC_MODEL_SIZE( 49152, 16384) },  /* F745 STC8H3K48S4 */
+    { 0x49,  14, STC_MODEL_NAME(2621, STC_PROTO_STC8D ), STC_MODEL_SIZE( 16384, 49152) },  /* F749 STC8H3K16S2 */
+    { 0x4A,  14, STC_MODEL_NAME(2719, STC_PROTO_STC8D ), STC_MODEL_SIZE( 32768, 32768) },  /* F74A STC8H3K32S2 */
+    { 0x4B,  14, STC_MODEL_NAME(2775, STC_PROTO_STC8D ), STC_MODEL_SIZE( 61440,  4096) },  /* F74B STC8H3K60S2 */
+    { 0x4C,  14, STC_MODEL_NAME(2656, STC_PROTO_STC8D ), STC_MODEL_SIZE( 65024,   512) },  /* F74C STC8H3K64S2 */
+    { 0x4D,  14, STC_MODEL_NAME(2544, STC_PROTO_STC8D ), STC_MODEL_SIZE( 49152, 16384) },  /* F74D STC8H3K48S2 */
+    { 0x51,  17, STC_MODEL_NAME(1200, STC_PROTO_STC8G ), STC_MODEL_SIZE(  2048, 10240) },  /* F751 STC8G1K02-20/16PIN */
+    { 0x52,  17, STC_MODEL_NAME(1172, STC_PROTO_STC8G ), STC_MODEL_SIZE(  4096,  8192) },  /* F752 STC8G1K04-20/16PIN */
+    { 0x53,  17, STC_MODEL_NAME(1158, STC_PROTO_STC8G ), STC_MODEL_SIZE(  6144,  6144) },  /* F753 STC8G1K06-20/16PIN */
+    { 0x54,  17, STC_MODEL_NAME(1130, STC_PROTO_STC8G ), STC_MODEL_SIZE(  8192,  4096) },  /* F754 STC8G1K08-20/16PIN */
+    { 0x55,  17, STC_MODEL_NAME(1214, STC_PROTO_STC8G ), STC_MODEL_SIZE( 10240,  2048) },  /* F755 STC8G1K10-20/16PIN */
+    { 0x56,  17, STC_MODEL_NAME(1186, STC_PROTO_STC8G ), STC_MODEL_SIZE( 12288,     0) },  /* F756 STC8G1K12-20/16PIN */
+    { 0x57,  17, STC_MODEL_NAME(1144, STC_PROTO_STC8G ), STC_MODEL_SIZE( 17408,     0) },  /* F757 STC8G1K17-20/16PIN */
+    { 0x61,  17, STC_MODEL_NAME(2282, STC_PROTO_STC8G ), STC_MODEL_SIZE( 16384, 49152) },  /* F761 STC8G2K16S4 */
+    { 0x62,  17, STC_MODEL_NAME(2352, STC_PROTO_STC8G ), STC_MODEL_SIZE( 32768, 32768) },  /* F762 STC8G2K32S4 */
+    { 0x63,  17, STC_MODEL_NAME(2373, STC_PROTO_STC8G ), STC_MODEL_SIZE( 61440,  4096) },  /* F763 STC8G2K60S4 */
+    { 0x64,  17, STC_MODEL_NAME(2303, STC_PROTO_STC8G ), STC_MODEL_SIZE( 65024,   512) },  /* F764 STC8G2K64S4 */
+    { 0x65,  17, STC_MODEL_NAME(2233, STC_PROTO_STC8G ), STC_MODEL_SIZE( 49152, 16384) },  /* F765 STC8G2K48S4 */
+    { 0x69,  17, STC_MODEL_NAME(2628, STC_PROTO_STC8G ), STC_MODEL_SIZE( 16384, 49152) },  /* F769 STC8G2K16S2 */
+    { 0x6A,  17, STC_MODEL_NAME(2726, STC_PROTO_STC8G ), STC_MODEL_SIZE( 32768, 32768) },  /* F76A STC8G2K32S2 */
+    { 0x6B,  17, STC_MODEL_NAME(2782, STC_PROTO_STC8G ), STC_MODEL_SIZE( 61440,  4096) },  /* F76B STC8G2K60S2 */
+    { 0x6C,  17, STC_MODEL_NAME(2663, STC_PROTO_STC8G ), STC_MODEL_SIZE( 65024,   512) },  /* F76C STC8G2K64S2 */
+    { 0x6D,  17, STC_MODEL_NAME(2551, STC_PROTO_STC8G ), STC_MODEL_SIZE( 49152, 16384) },  /* F76D STC8G2K48S2 */
+    { 0x71,  17, STC_MODEL_NAME( 435, STC_PROTO_STC8G ), STC_MODEL_SIZE(  2048, 10240) },  /* F771 STC8G1K02T */
+    { 0x72,  17, STC_MODEL_NAME( 423, STC_PROTO_STC8G ), STC_MODEL_SIZE(  4096,  8192) },  /* F772 STC8G1K04T */
+    { 0x73,  17, STC_MODEL_NAME( 417, STC_PROTO_STC8G ), STC_MODEL_SIZE(  6144,  6144) },  /* F773 STC8G1K06T */
+    { 0x74,  17, STC_MODEL_NAME( 405, STC_PROTO_STC8G ), STC_MODEL_SIZE(  8192,  4096) },  /* F774 STC8G1K08T */
+    { 0x75,  17, STC_MODEL_NAME( 441, STC_PROTO_STC8G ), STC_MODEL_SIZE( 10240,  2048) },  /* F775 STC8G1K10T */
+    { 0x76,  17, STC_MODEL_NAME( 429, STC_PROTO_STC8G ), STC_MODEL_SIZE( 12288,     0) },  /* F776 STC8G1K12T */
+    { 0x77,  17, STC_MODEL_NAME( 411, STC_PROTO_STC8G ), STC_MODEL_SIZE( 17408,     0) },  /* F777 STC8G1K17T */
+    { 0x81,  14, STC_MODEL_NAME( 381, STC_PROTO_STC8D ), STC_MODEL_SIZE( 16384, 49152) },  /* F781 STC8H8K16U */
+    { 0x82,  14, STC_MODEL_NAME( 393, STC_PROTO_STC8D ), STC_MODEL_SIZE( 32768, 32768) },  /* F782 STC8H8K32U */
+    { 0x83,  14, STC_MODEL_NAME( 399, STC_PROTO_STC8D ), STC_MODEL_SIZE( 61440,  4096) },  /* F783 STC8H8K60U */
+    { 0x84,  14, STC_MODEL_NAME( 387, STC_PROTO_STC8D ), STC_MODEL_SIZE( 65024,   512) },  /* F784 STC8H8K64U */
+    { 0x85,  14, STC_MODEL_NAME( 375, STC_PROTO_STC8D ), STC_MODEL_SIZE( 49152, 16384) },  /* F785 STC8H8K48U */
+    { 0x91,  17, STC_MODEL_NAME(1038, STC_PROTO_STC8G ), STC_MODEL_SIZE(  2048, 10240) },  /* F791 STC8G1K02A-8PIN */
+    { 0x92,  17, STC_MODEL_NAME(1016, STC_PROTO_STC8G ), STC_MODEL_SIZE(  4096,  8192) },  /* F792 STC8G1K04A-8PIN */
+    { 0x93,  17, STC_MODEL_NAME(1005, STC_PROTO_STC8G ), STC_MODEL_SIZE(  6144,  6144) },  /* F793 STC8G1K06A-8PIN */
+    { 0x94,  17, STC_MODEL_NAME( 983, STC_PROTO_STC8G ), STC_MODEL_SIZE(  8192,  4096) },  /* F794 STC8G1K08A-8PIN */
+    { 0x95,  17, STC_MODEL_NAME(1049, STC_PROTO_STC8G ), STC_MODEL_SIZE( 10240,  2048) },  /* F795 STC8G1K10A-8PIN */
+    { 0x96,  17, STC_MODEL_NAME(1027, STC_PROTO_STC8G ), STC_MODEL_SIZE( 12288,     0) },  /* F796 STC8G1K12A-8PIN */
+    { 0x97,  17, STC_MODEL_NAME( 994, STC_PROTO_STC8G ), STC_MODEL_SIZE( 17408,     0) },  /* F797 STC8G1K17A-8PIN */
+    { 0xA1,  17, STC_MODEL_NAME(1110, STC_PROTO_STC8G ), STC_MODEL_SIZE(  2048, 10240) },  /* F7A1 STC8G1K02-8PIN */
+    { 0xA2,  17, STC_MODEL_NAME(1090, STC_PROTO_STC8G ), STC_MODEL_SIZE(  4096,  8192) },  /* F7A2 STC8G1K04-8PIN */
+    { 0xA3,  17, STC_MODEL_NAME(1080, STC_PROTO_STC8G ), STC_MODEL_SIZE(  6144,  6144) },  /* F7A3 STC8G1K06-8PIN */
+    { 0xA4,  17, STC_MODEL_NAME(1060, STC_PROTO_STC8G ), STC_MODEL_SIZE(  8192,  4096) },  /* F7A4 STC8G1K08-8PIN */
+    { 0xA5,  17, STC_MODEL_NAME(1120, STC_PROTO_STC8G ), STC_MODEL_SIZE( 10240,  2048) },  /* F7A5 STC8G1K10-8PIN */
+    { 0xA6,  17, STC_MODEL_NAME(1100, STC_PROTO_STC8G ), STC_MODEL_SIZE( 12288,     0) },  /* F7A6 STC8G1K12-8PIN */
+    { 0xA7,  17, STC_MODEL_NAME(1070, STC_PROTO_STC8G ), STC_MODEL_SIZE( 17408,     0) },  /* F7A7 STC8G1K17-8PIN */
+    { 0xB0,  16, STC_MODEL_NAME(2494, STC_PROTO_STC12 ), STC_MODEL_SIZE(  4096, 24576) },  /* F7B0 STC12H1K04 */
+    { 0xB1,  16, STC_MODEL_NAME(2109, STC_PROTO_STC12 ), STC_MODEL_SIZE(  8192, 20480) },  /* F7B1 STC12H1K08 */
+    { 0xB2,  16, STC_MODEL_NAME(2882, STC_PROTO_STC12 ), STC_MODEL_SIZE( 12288, 16384) },  /* F7B2 STC12H1K12 */
+    { 0xB3,  16, STC_MODEL_NAME(2154, STC_PROTO_STC12 ), STC_MODEL_SIZE( 16384, 12288) },  /* F7B3 STC12H1K16 */
+    { 0xB4,  16, STC_MODEL_NAME(3175, STC_PROTO_STC12 ), STC_MODEL_SIZE( 20480,  8192) },  /* F7B4 STC12H1K20 */
+    { 0xB5,  16, STC_MODEL_NAME(2475, STC_PROTO_STC12 ), STC_MODEL_SIZE( 24576,  4096) },  /* F7B5 STC12H1K24 */
+    { 0xB6,  16, STC_MODEL_NAME(2087, STC_PROTO_STC12 ), STC_MODEL_SIZE( 28672,     0) },  /* F7B6 STC12H1K28 */
+    { 0xB7,  16, STC_MODEL_NAME(2521, STC_PROTO_STC12 ), STC_MODEL_SIZE( 33792,     0) },  /* F7B7 STC12H1K33 */
+    { 0xC9,  14, STC_MODEL_NAME( 879, STC_PROTO_STC8D ), STC_MODEL_SIZE( 16384, 49152) },  /* F7C9 STC8H4K16TLR */
+    { 0xCA,  14, STC_MODEL_NAME( 895, STC_PROTO_STC8D ), STC_MODEL_SIZE( 32768, 32768) },  /* F7CA STC8H4K32TLR */
+    { 0xCB,  14, STC_MODEL_NAME( 903, STC_PROTO_STC8D ), STC_MODEL_SIZE( 61440,  4096) },  /* F7CB STC8H4K60TLR */
+    { 0xCC,  14, STC_MODEL_NAME( 887, STC_PROTO_STC8D ), STC_MODEL_SIZE( 65024,   512) },  /* F7CC STC8H4K64TLR */
+    { 0xCD,  14, STC_MODEL_NAME( 871, STC_PROTO_STC8D ), STC_MODEL_SIZE( 49152, 16384) },  /* F7CD STC8H4K48TLR */
+    { 0xD1,  62, STC_MODEL_NAME(2282, STC_PROTO_STC8  ), STC_MODEL_SIZE( 16384, 49152) },  /* F7D1 STC8C2K16S4 */
+    { 0xD2,  62, STC_MODEL_NAME(2352, STC_PROTO_STC8  ), STC_MODEL_SIZE( 32768, 32768) },  /* F7D2 STC8C2K32S4 */
+    { 0xD3,  62, STC_MODEL_NAME(2373, STC_PROTO_STC8  ), STC_MODEL_SIZE( 61440,  4096) },  /* F7D3 STC8C2K60S4 */
+    { 0xD4,  62, STC_MODEL_NAME(2303, STC_PROTO_STC8  ), STC_MODEL_SIZE( 65024,   512) },  /* F7D4 STC8C2K64S4 */
+    { 0xD5,  62, STC_MODEL_NAME(2233, STC_PROTO_STC8  ), STC_MODEL_SIZE( 49152, 16384) },  /* F7D5 STC8C2K48S4 */
+    { 0xD9,  62, STC_MODEL_NAME(2628, STC_PROTO_STC8  ), STC_MODEL_SIZE( 16384, 49152) },  /* F7D9 STC8C2K16S2 */
+    { 0xDA,  62, STC_MODEL_NAME(2726, STC_PROTO_STC8  ), STC_MODEL_SIZE( 32768, 32768) },  /* F7DA STC8C2K32S2 */
+    { 0xDB,  62, STC_MODEL_NAME(2782, STC_PROTO_STC8  ), STC_MODEL_SIZE( 61440,  4096) },  /* F7DB STC8C2K60S2 */
+    { 0xDC,  62, STC_MODEL_NAME(2663, STC_PROTO_STC8  ), STC_MODEL_SIZE( 65024,   512) },  /* F7DC STC8C2K64S2 */
+    { 0xDD,  62, STC_MODEL_NAME(2551, STC_PROTO_STC8  ), STC_MODEL_SIZE( 49152, 16384) },  /* F7DD STC8C2K48S2 */
+    { 0xE0,  60, STC_MODEL_NAME(  49, STC_PROTO_COUNT ), STC_MODEL_SIZE(122880,     0) },  /* F7E0 STC16F40K128-Beta */
+    { 0xE1,  18, STC_MODEL_NAME(  37, STC_PROTO_STC32 ), STC_MODEL_SIZE(131072,     0) },  /* F7E1 STC32G12K128-Beta */
+    { 0xE3,  18, STC_MODEL_NAME(2102, STC_PROTO_STC32 ), STC_MODEL_SIZE(131072,     0) },  /* F7E3 STC32G12K128 */
+    { 0xEE,  60, STC_MODEL_NAME(3122, STC_PROTO_COUNT ), STC_MODEL_SIZE(131072,     0) },  /* F7EE STC-USB Link1 */
+    { 0xEF,  60, STC_MODEL_NAME(3109, STC_PROTO_COUNT ), STC_MODEL_SIZE(131072,     0) },  /* F7EF STC-USB Writer1 */
+    { 0xF1,  66, STC_MODEL_NAME(2408, STC_PROTO_STC8D ), STC_MODEL_SIZE( 16384, 49152) },  /* F7F1 STC8A8K16D4 */
+    { 0xF2,  66, STC_MODEL_NAME(2436, STC_PROTO_STC8D ), STC_MODEL_SIZE( 32768, 32768) },  /* F7F2 STC8A8K32D4 */
+    { 0xF3,  66, STC_MODEL_NAME(2450, STC_PROTO_STC8D ), STC_MODEL_SIZE( 61440,  4096) },  /* F7F3 STC8A8K60D4 */
+    { 0xF4,  66, STC_MODEL_NAME(2422, STC_PROTO_STC8D ), STC_MODEL_SIZE( 65024,   512) },  /* F7F4 STC8A8K64D4 */
+    { 0xF5,  66, STC_MODEL_NAME(2394, STC_PROTO_STC8D ), STC_MODEL_SIZE( 49152, 16384) },  /* F7F5 STC8A8K48D4 */
+    { 0x01,  66, STC_MODEL_NAME(2415, STC_PROTO_STC8  ), STC_MODEL_SIZE( 16384, 49152) },  /* F801 STC8A2K16D4 */
+    { 0x02,  66, STC_MODEL_NAME(2443, STC_PROTO_STC8  ), STC_MODEL_SIZE( 32768, 32768) },  /* F802 STC8A2K32D4 */
+    { 0x03,  66, STC_MODEL_NAME(2457, STC_PROTO_STC8  ), STC_MODEL_SIZE( 61440,  4096) },  /* F803 STC8A2K60D4 */
+    { 0x04,  66, STC_MODEL_NAME(2429, STC_PROTO_STC8  ), STC_MODEL_SIZE( 65024,   512) },  /* F804 STC8A2K64D4 */
+    { 0x05,  66, STC_MODEL_NAME(2401, STC_PROTO_STC8  ), STC_MODEL_SIZE( 49152, 16384) },  /* F805 STC8A2K48D4 */
+    { 0x11,  14, STC_MODEL_NAME(1485, STC_PROTO_STC8D ), STC_MODEL_SIZE( 16384, 49152) },  /* F811 STC8H4K16TLCD */
+    { 0x12,  14, STC_MODEL_NAME(1521, STC_PROTO_STC8D ), STC_MODEL_SIZE( 32768, 32768) },  /* F812 STC8H4K32TLCD */
+    { 0x13,  14, STC_MODEL_NAME(1539, STC_PROTO_STC8D ), STC_MODEL_SIZE( 61440,  4096) },  /* F813 STC8H4K60TLCD */
+    { 0x14,  14, STC_MODEL_NAME(1503, STC_PROTO_STC8D ), STC_MODEL_SIZE( 65024,   512) },  /* F814 STC8H4K64TLCD */
+    { 0x15,  14, STC_MODEL_NAME(1467, STC_PROTO_STC8D ), STC_MODEL_SIZE( 49152, 16384) },  /* F815 STC8H4K48TLCD */
+    { 0x19,  14, STC_MODEL_NAME(1494, STC_PROTO_STC8D ), STC_MODEL_SIZE( 16384, 49152) },  /* F819 STC8H2K16TLCD */
+    { 0x1A,  14, STC_MODEL_NAME(1530, STC_PROTO_STC8D ), STC_MODEL_SIZE( 32768, 32768) },  /* F81A STC8H2K32TLCD */
+    { 0x1B,  14, STC_MODEL_NAME(1548, STC_PROTO_STC8D ), STC_MODEL_SIZE( 61440,  4096) },  /* F81B STC8H2K60TLCD */
+    { 0x1C,  14, STC_MODEL_NAME(1512, STC_PROTO_STC8D ), STC_MODEL_SIZE( 65024,   512) },  /* F81C STC8H2K64TLCD */
+    { 0x1D,  14, STC_MODEL_NAME(1476, STC_PROTO_STC8D ), STC_MODEL_SIZE( 49152, 16384) },  /* F81D STC8H2K48TLCD */
+    { 0x21,  14, STC_MODEL_NAME(1565, STC_PROTO_STC8D ), STC_MODEL_SIZE( 16384, 49152) },  /* F821 STC8H4K16LCD */
+    { 0x22,  14, STC_MODEL_NAME(1581, STC_PROTO_STC8D ), STC_MODEL_SIZE( 32768, 32768) },  /* F822 STC8H4K32LCD */
+    { 0x23,  14, STC_MODEL_NAME(1589, STC_PROTO_STC8D ), STC_MODEL_SIZE( 61440,  4096) },  /* F823 STC8H4K60LCD */
+    { 0x24,  14, STC_MODEL_NAME(1573, STC_PROTO_STC8D ), STC_MODEL_SIZE( 65024,   512) },  /* F824 STC8H4K64LCD */
+    { 0x25,  14, STC_MODEL_NAME(1557, STC_PROTO_STC8D ), STC_MODEL_SIZE( 49152, 16384) },  /* F825 STC8H4K48LCD */
+    { 0x31,  14, STC_MODEL_NAME(1306, STC_PROTO_STC8D ), STC_MODEL_SIZE( 16384, 49152) },  /* F831 STC8H4K16TL */
+    { 0x32,  14, STC_MODEL_NAME(1334, STC_PROTO_STC8D ), STC_MODEL_SIZE( 32768, 32768) },  /* F832 STC8H4K32TL */
+    { 0x33,  14, STC_MODEL_NAME(1348, STC_PROTO_STC8D ), STC_MODEL_SIZE( 61440,  4096) },  /* F833 STC8H4K60TL */
+    { 0x34,  14, STC_MODEL_NAME(1320, STC_PROTO_STC8D ), STC_MODEL_SIZE( 65024,   512) },  /* F834 STC8H4K64TL */
+    { 0x35,  14, STC_MODEL_NAME(1292, STC_PROTO_STC8D ), STC_MODEL_SIZE( 49152, 16384) },  /* F835 STC8H4K48TL */
+    { 0x39,  14, STC_MODEL_NAME(1313, STC_PROTO_STC8D ), STC_MODEL_SIZE( 16384, 49152) },  /* F839 STC8H2K16TL */
+    { 0x3A,  14, STC_MODEL_NAME(1341, STC_PROTO_STC8D ), STC_MODEL_SIZE( 32768, 32768) },  /* F83A STC8H2K32TL */
+    { 0x3B,  14, STC_MODEL_NAME(1355, STC_PROTO_STC8D ), STC_MODEL_SIZE( 61440,  4096) },  /* F83B STC8H2K60TL */
+    { 0x3C,  14, STC_MODEL_NAME(1327, STC_PROTO_STC8D ), STC_MODEL_SIZE( 65024,   512) },  /* F83C STC8H2K64TL */
+    { 0x3D,  14, STC_MODEL_NAME(1299, STC_PROTO_STC8D ), STC_MODEL_SIZE( 49152, 16384) },  /* F83D STC8H2K48TL */
+    { 0x40,  14, STC_MODEL_NAME(  15, STC_PROTO_STC8D ), STC_MODEL_SIZE(  8192,  4096) },  /* F840 STC8H1K08T-Beta */
+    { 0x41,  14, STC_MODEL_NAME( 435, STC_PROTO_STC8D ), STC_MODEL_SIZE(  2048, 10240) },  /* F841 STC8H1K02T */
+    { 0x42,  14, STC_MODEL_NAME( 423, STC_PROTO_STC8D ), STC_MODEL_SIZE(  4096,  8192) },  /* F842 STC8H1K04T */
+    { 0x43,  14, STC_MODEL_NAME( 417, STC_PROTO_STC8D ), STC_MODEL_SIZE(  6144,  6144) },  /* F843 STC8H1K06T */
+    { 0x44,  14, STC_MODEL_NAME( 405, STC_PROTO_STC8D ), STC_MODEL_SIZE(  8192,  4096) },  /* F844 STC8H1K08T */
+    { 0x45,  14, STC_MODEL_NAME( 441, STC_PROTO_STC8D ), STC_MODEL_SIZE( 10240,  2048) },  /* F845 STC8H1K10T */
+    { 0x46,  14, STC_MODEL_NAME( 429, STC_PROTO_STC8D ), STC_MODEL_SIZE( 12288,     0) },  /* F846 STC8H1K12T */
+    { 0x47,  14, STC_MODEL_NAME( 411, STC_PROTO_STC8D ), STC_MODEL_SIZE( 17408,     0) },  /* F847 STC8H1K17T */
+    { 0x48,  14, STC_MODEL_NAME(  26, STC_PROTO_STC8D ), STC_MODEL_SIZE( 17408,     0) },  /* F848 STC8H1K17T-Beta */
+    { 0x50,  18, STC_MODEL_NAME(  64, STC_PROTO_STC32 ), STC_MODEL_SIZE( 65536,     0) },  /* F850 STC32G8K64-Beta */
+    { 0x51,  18, STC_MODEL_NAME(2143, STC_PROTO_STC32 ), STC_MODEL_SIZE( 16384, 49152) },  /* F851 STC32G8K16 */
+    { 0x52,  18, STC_MODEL_NAME(2866, STC_PROTO_STC32 ), STC_MODEL_SIZE( 32768, 32768) },  /* F852 STC32G8K32 */
+    { 0x53,  18, STC_MODEL_NAME(3155, STC_PROTO_STC32 ), STC_MODEL_SIZE( 61440,  4096) },  /* F853 STC32G8K60 */
+    { 0x54,  18, STC_MODEL_NAME(2464, STC_PROTO_STC32 ), STC_MODEL_SIZE( 65536,     0) },  /* F854 STC32G8K64 */
+    { 0x55,  18, STC_MODEL_NAME(2071, STC_PROTO_STC32 ), STC_MODEL_SIZE( 49152, 16384) },  /* F855 STC32G8K48 */
+    { 0x61,  15, STC_MODEL_NAME(2282, STC_PROTO_STC15 ), STC_MODEL_SIZE( 16384, 49152) },  /* F861 STC15H2K16S4 */
+    { 0x62,  15, STC_MODEL_NAME(2352, STC_PROTO_STC15 ), STC_MODEL_SIZE( 32768, 32768) },  /* F862 STC15H2K32S4 */
+    { 0x63,  15, STC_MODEL_NAME(2373, STC_PROTO_STC15 ), STC_MODEL_SIZE( 61440,  4096) },  /* F863 STC15H2K60S4 */
+    { 0x64,  15, STC_MODEL_NAME(2303, STC_PROTO_STC15 ), STC_MODEL_SIZE( 65024,   512) },  /* F864 STC15H2K64S4 */
+    { 0x65,  15, STC_MODEL_NAME(2233, STC_PROTO_STC15 ), STC_MODEL_SIZE( 49152, 16384) },  /* F865 STC15H2K48S4 */
+    { 0x71,  23, STC_MODEL_NAME(2148, STC_PROTO_STC32 ), STC_MODEL_SIZE( 16384, 38912) },  /* F871 STC32F12K16 */
+    { 0x72,  23, STC_MODEL_NAME(2871, STC_PROTO_STC32 ), STC_MODEL_SIZE( 32768, 22528) },  /* F872 STC32F12K32 */
+    { 0x73,  23, STC_MODEL_NAME(2076, STC_PROTO_STC32 ), STC_MODEL_SIZE( 49152,  6144) },  /* F873 STC32F12K48 */
+    { 0x74,  23, STC_MODEL_NAME(2469, STC_PROTO_STC32 ), STC_MODEL_SIZE( 55296,     0) },  /* F874 STC32F12K54 */
+    { 0x75,  23, STC_MODEL_NAME(2062, STC_PROTO_STC32 ), STC_MODEL_SIZE( 60416,     0) },  /* F875 STC32F12K59 */
+    { 0xFF,  61, STC_MODEL_NAME(1453, STC_PROTO_STC89 ), STC_MODEL_SIZE( 65536,     0) },  /* FFFF STC89C516RD/LV516RD */
+};
+
+/*============================================================================
+ * 名称索引（g_model_db下标，按名称字节序升序）
+ *============================================================================*/
+static const uint16_t g_model_name_index[STC_MODEL_DB_COUNT] = {
+     984,  985,  500,  473,  160,  186,  161,  187,  162,  188,  163,  189,
+     164,  190,  165,  191,  166,  192,  199,  225,  200,  226,  201,  227,
+     202,  228,  203,  229,  204,  230,  205,  231,  460,  474,  461,  475,
+     462,  476,  463,  477,  479,  481,  482,  232,  251,  273,  234,  253,
+     277,  236,  255,  279,  238,  257,  285,  240,  259,  288,  242,  261,
+     290,  244,  263,  292,  246,  265,  294,  248,  267,  296,  250,  269,
+     487,  501,  488,  502,  489,  503,  490,  504,  506,  508,  509,  298,
+     317,  339,  300,  319,  343,  302,  321,  345,  304,  323,  351,  306,
+     325,  354,  308,  327,  356,  310,  329,  358,  312,  331,  360,  314,
+     333,  362,  316,  335,    0,   34,   17,   54,    2,   36,   19,   58,
+       4,   38,   21,   64,    6,   40,   23,   66,    8,   42,   25,   68,
+      10,   44,   27,   70,   12,   46,   29,   72,   14,   48,   31,   74,
+      16,   50,   33,   76,   77,  111,   94,  131,   79,  113,   96,  135,
+      81,  115,   98,  141,   83,  117,  100,  143,   85,  119,  102,  145,
+      87,  121,  104,  147,   89,  123,  106,  149,   91,  125,  108,  151,
+      93,  127,  110,  153,  223,  184,  699,  697,  744,  754,  731,  717,
+     776,  786,  763,  767,  714,  712,  810,  820,  797,  720,  842,  852,
+     829,  833,  695,  895,  894,  898,  896,  902,  900,  904,  905,  909,
+     906,  910,  140,   63,  560,  531,  353,  287,  700,  698,  735,  745,
+     722,  718,  777,  787,  764,  715,  713,  801,  811,  788,  721,  843,
+     853,  830,  696,  899,  897,  903,  901,  907, 1077, 1078,  491,  464,
+     496,  469,  212,  173,  497,  470,  498,  471,  213,  174,  499,  472,
+     215,  176,  217,  336,  178,  270,  154,  167,  175,  155,  168,  177,
+     156,  169,  179,  157,  170,  181,  158,  171,  183,  159,  172,  185,
+     193,  206,  214,  194,  207,  216,  195,  208,  218,  196,  209,  220,
+     197,  210,  222,  198,  211,  224,  219,  180,  456,  465,  457,  466,
+     458,  467,  459,  468,  478,  480,  233,  252,  274,  235,  254,  278,
+     237,  256,  280,  239,  258,  286,  241,  260,  289,  243,  262,  291,
+     245,  264,  293,  247,  266,  295,  249,  268,  297,  483,  492,  484,
+     493,  485,  494,  486,  495,  505,  507,  299,  318,  340,  301,  320,
+     344,  303,  322,  346,  305,  324,  352,  307,  326,  355,  309,  328,
+     357,  311,  330,  359,  313,  332,  361,  315,  334,  363,  659,  664,
+     660,  665,  661,  666,  662,  667,  663,  668,  408,  420,  414,  409,
+     421,  415,  410,  422,  416,  411,  423,  417,  412,  424,  418,  413,
+     425,  419,  364,  375,  365,  376,  366,  377,  367,  378,  368,  379,
+     369,  380,  370,  381,  371,  382,  372,  383,  373,  384,  374,  385,
+     510,  523,  511,  524,  512,  525,  513,  526,  514,  527,  515,  528,
+     516,  530,  517,  533,  518,  534,  519,  535,  520,  536,  521,  537,
+     522,  538,   35,   18,   55,    1,   37,   20,   59,    3,   39,   22,
+      65,    5,   41,   24,   67,    7,   43,   26,   69,    9,   45,   28,
+      71,   11,   47,   30,   73,   13,   49,   32,   75,   15, 1051, 1052,
+    1053, 1054, 1055, 1056, 1057, 1058,  669,  674,  670,  675,  671,  676,
+     672,  677,  673,  678,  432,  444,  438,  433,  445,  439,  434,  446,
+     440,  435,  447,  441,  436,  448,  442,  437,  449,  443,  386,  397,
+     387,  398,  388,  399,  389,  400,  390,  401,  391,  402,  392,  403,
+     393,  404,  394,  405,  395,  406,  396,  407,  539,  552,  540,  553,
+     541,  554,  542,  555,  543,  556,  544,  557,  545,  559,  546,  562,
+     547,  563,  548,  564,  549,  565,  550,  566,  551,  567,  112,   95,
+     132,   78,  114,   97,  136,   80,  116,   99,  142,   82,  118,  101,
+     144,   84,  120,  103,  146,   86,  122,  105,  148,   88,  124,  107,
+     150,   90,  126,  109,  152,   92,  221,  182,  685,  679,  686,  680,
+     687,  681,  688,  682,  689,  684,  683,  768,  778,  755,  769,  779,
+     756,  770,  780,  757,  771,  781,  758,  772,  782,  759,  773,  783,
+     760,  774,  784,  761,  775,  785,  762,  716,  736,  746,  723,  737,
+     747,  724,  738,  748,  725,  739,  749,  726,  740,  750,  727,  741,
+     751,  728,  742,  752,  729,  743,  753,  730,  732,  733,  734, 1129,
+    1130, 1133, 1131, 1132,  911,  912,  913,  914,  915,  916,  917,  918,
+     707,  701,  708,  702,  709,  703,  710,  704,  711,  706,  705,  834,
+     844,  821,  835,  845,  822,  836,  846,  823,  837,  847,  824,  838,
+     848,  825,  839,  849,  826,  840,  850,  827,  841,  851,  828,  719,
+     802,  812,  789,  803,  813,  790,  804,  814,  791,  805,  815,  792,
+     806,  816,  793,  807,  817,  794,  808,  818,  795,  809,  819,  796,
+     798,  799,  800,  690,  691,  858,  854,  692,  859,  855,  693,  860,
+     856,  694,  861,  857,  884,  885,  866,  891,  886,  867,  892,  893,
+     862,  863,  864,  865,  889,  887,  890,  888,  882,  883,  872,  868,
+     873,  869,  874,  870,  875,  871,  876,  877,  878,  879,  880,  881,
+    1074,  337,  271,  338,  272, 1134, 1135, 1136, 1137, 1138, 1076, 1075,
+    1124, 1125, 1128, 1126, 1127, 1123,  341,  275,  342,  276,  347,  281,
+     450,  426,  451,  427,  452,  428,  453,  429,  454,  430,  455,  431,
+     348,  282,  349,  283,  128,   51,  129,   52,  130,   53,  133,   56,
+     134,   57,  137,   60,  138,   61,  139,   62,  558,  529,  350,  284,
+     561,  532,  571,  572,  573,  574,  592,  589,  649,  602,  650,  603,
+     604,  651,  605,  652,  606, 1139,  568,  597,  590,  569,  598,  591,
+     570,  647,  599,  600,  648,  601,  596,  593,  655,  656,  657,  658,
+     594,  595,  653,  654, 1084, 1085, 1088, 1086, 1087,  955,  956,  957,
+     958,  959,  960,  961,  963,  962,  928, 1079,  929,  930, 1080,  931,
+     932, 1083,  933,  934, 1081,  936, 1082,  935,  978,  979,  980,  981,
+     982,  983, 1069, 1064, 1070, 1065, 1073, 1068, 1071, 1066, 1072, 1067,
+     971,  964,  972,  965,  973,  966,  974,  967,  975,  968,  976,  969,
+     977,  970,  946,  937,  947,  938,  948,  939,  949,  940,  950,  941,
+     951,  942,  952,  943,  954,  945,  953,  944,  919,  920,  921,  922,
+     923,  924,  925,  927,  926, 1008, 1044, 1037, 1025, 1009, 1045, 1038,
+    1026, 1010, 1046, 1039, 1027, 1011, 1047, 1040, 1028, 1012, 1048, 1041,
+    1029, 1013, 1049, 1042, 1030, 1014, 1050, 1043, 1031, 1020, 1015, 1021,
+    1016, 1024, 1019, 1022, 1017, 1023, 1018,  991, 1115,  992, 1116,  993,
+    1117,  994, 1118, 1114,  995, 1119,  996, 1120,  986,  997, 1121, 1122,
+     987,  988,  989,  990, 1109, 1094, 1110, 1095, 1113, 1098, 1111, 1096,
+    1112, 1097, 1003,  998, 1004,  999, 1007, 1002, 1005, 1000, 1006, 1001,
+    1099, 1104, 1089, 1059, 1100, 1105, 1090, 1060, 1103, 1108, 1093, 1063,
+    1101, 1106, 1091, 1061, 1102, 1107, 1092, 1062, 1032, 1033, 1036, 1034,
+    1035,  578,  579,  580,  581,  632,  612,  633,  613,  634,  614,  635,
+     615,  636,  616,  627,  575,  607,  628,  576,  608,  577,  629,  609,
+     630,  610,  631,  611,  585,  586,  587,  588,  642,  622,  643,  623,
+     644,  624,  645,  625,  646,  626,  637,  582,  617,  638,  583,  618,
+     584,  639,  619,  640,  620,  641,  621,  831,  765,  832,  766,  908,
+};
+
+#endif /* __STC_MODEL_DB_TABLE_H__ */
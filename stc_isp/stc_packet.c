@@ -7,34 +7,139 @@
 #include <string.h>
 
 /*============================================================================
- * 校验和计算
+ * 字节累加内核
+ * Cortex-M4（ARMv7E-M）使用USADA8每条指令累加4字节；
+ * 其他平台（主机编译）使用SWAR：按16位通道并行累加奇偶字节
  *============================================================================*/
+#if defined(__CC_ARM) && defined(__TARGET_ARCH_7E_M)
+    /* ARMCC 5：__usada8为内建函数 */
+    #define STC_SUM_USE_SIMD32  1
+#elif defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+    #include <arm_acle.h>
+    #define STC_SUM_USE_SIMD32  1
+#else
+    #define STC_SUM_USE_SIMD32  0
+#endif
 
-uint8_t stc_checksum_8bit(const uint8_t* data, uint16_t len)
+/* SWAR累加：每个16位通道每个字最多增加2*255，128个字后需要折叠一次 */
+#define SWAR_FOLD_WORDS     128
+
+static inline uint32_t load_word(const uint8_t* p)
+{
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));   /* 允许非对齐地址，编译为单条LDR */
+    return w;
+}
+
+#if !STC_SUM_USE_SIMD32
+static inline uint32_t swar_fold(uint32_t lanes)
 {
-    uint8_t sum = 0;
-    for (uint16_t i = 0; i < len; i++) {
-        sum += data[i];
+    return (lanes & 0xFFFF) + (lanes >> 16);
+}
+#endif
+
+/**
+ * @brief 字节累加（整字处理，结果按需截断为8/16位）
+ * @param data 数据指针
+ * @param len 数据长度
+ * @return 所有字节之和
+ */
+static uint32_t sum_bytes(const uint8_t* data, uint16_t len)
+{
+    uint32_t sum = 0;
+    uint16_t words = len / 4;
+    
+#if STC_SUM_USE_SIMD32
+    while (words--) {
+        sum = __usada8(load_word(data), 0, sum);
+        data += 4;
+    }
+#else
+    while (words) {
+        uint16_t n = (words > SWAR_FOLD_WORDS) ? SWAR_FOLD_WORDS : words;
+        uint32_t lanes = 0;
+        words -= n;
+        while (n--) {
+            uint32_t w = load_word(data);
+            lanes += (w & 0x00FF00FF) + ((w >> 8) & 0x00FF00FF);
+            data += 4;
+        }
+        sum += swar_fold(lanes);
+    }
+#endif
+    
+    for (len &= 3; len; len--) {
+        sum += *data++;
     }
     return sum;
 }
 
-uint16_t stc_checksum_16bit(const uint8_t* data, uint16_t len)
+/**
+ * @brief 复制并累加（填充帧时一次遍历完成复制和校验和）
+ * @param dst 目标地址
+ * @param src 源地址
+ * @param len 数据长度
+ * @return 所有字节之和
+ */
+static uint32_t copy_sum_bytes(uint8_t* dst, const uint8_t* src, uint16_t len)
 {
-    uint16_t sum = 0;
-    for (uint16_t i = 0; i < len; i++) {
-        sum += data[i];
+    uint32_t sum = 0;
+    uint16_t words = len / 4;
+    
+#if STC_SUM_USE_SIMD32
+    while (words--) {
+        uint32_t w = load_word(src);
+        memcpy(dst, &w, sizeof(w));
+        sum = __usada8(w, 0, sum);
+        src += 4;
+        dst += 4;
+    }
+#else
+    while (words) {
+        uint16_t n = (words > SWAR_FOLD_WORDS) ? SWAR_FOLD_WORDS : words;
+        uint32_t lanes = 0;
+        words -= n;
+        while (n--) {
+            uint32_t w = load_word(src);
+            memcpy(dst, &w, sizeof(w));
+            lanes += (w & 0x00FF00FF) + ((w >> 8) & 0x00FF00FF);
+            src += 4;
+            dst += 4;
+        }
+        sum += swar_fold(lanes);
+    }
+#endif
+    
+    for (len &= 3; len; len--) {
+        sum += *src;
+        *dst++ = *src++;
     }
     return sum;
 }
 
+/*============================================================================
+ * 校验和计算
+ *============================================================================*/
+
+uint8_t stc_checksum_8bit(const uint8_t* data, uint16_t len)
+{
+    return (uint8_t)sum_bytes(data, len);
+}
+
+uint16_t stc_checksum_16bit(const uint8_t* data, uint16_t len)
+{
+    return (uint16_t)sum_bytes(data, len);
+}
+
+uint16_t stc_checksum_copy(uint8_t* dst, const uint8_t* src, uint16_t len)
+{
+    return (uint16_t)copy_sum_bytes(dst, src, len);
+}
+
 uint8_t stc_checksum_usb_block(const uint8_t* data, uint16_t len)
 {
-    uint8_t sum = 0;
-    for (uint16_t i = 0; i < len; i++) {
-        sum = (sum - data[i]) & 0xFF;
-    }
-    return sum;
+    /* 逐字节减法等价于0减去字节和 */
+    return (uint8_t)(0 - sum_bytes(data, len));
 }
 
 uint16_t stc_calc_checksum(const stc_protocol_config_t* config, const uint8_t* data, uint16_t len)
@@ -62,63 +167,117 @@ uint16_t stc_calc_checksum(const stc_protocol_config_t* config, const uint8_t* d
  * 数据包构建
  *============================================================================*/
 
-int stc_build_packet(const stc_protocol_config_t* config,
-                     const uint8_t* payload, uint16_t payload_len,
-                     uint8_t* output, uint16_t output_size)
+/**
+ * @brief 计算数据包总长度
+ * @param config 协议配置
+ * @param payload_len 载荷长度
+ * @return 帧头(2) + 方向(1) + 长度(2) + 载荷 + 校验和 + 帧尾(1)
+ */
+static uint16_t frame_length(const stc_protocol_config_t* config, uint16_t payload_len)
+{
+    uint8_t checksum_bytes = (config->checksum_type == STC_CHECKSUM_DOUBLE_BYTE) ? 2 : 1;
+    return STC_PACKET_HEADROOM + payload_len + checksum_bytes + 1;
+}
+
+/**
+ * @brief 写入帧头、校验和与帧尾（载荷已位于frame + STC_PACKET_HEADROOM）
+ * @param config 协议配置
+ * @param frame 帧缓冲区
+ * @param payload_len 载荷长度
+ * @param payload_sum 载荷字节和
+ * @return 数据包总长度
+ */
+static int finalize_frame(const stc_protocol_config_t* config, uint8_t* frame,
+                          uint16_t payload_len, uint32_t payload_sum)
 {
-    if (config == NULL || payload == NULL || output == NULL) {
-        return -1;
-    }
-    
     /* 计算校验和字节数 */
     uint8_t checksum_bytes = (config->checksum_type == STC_CHECKSUM_DOUBLE_BYTE) ? 2 : 1;
     
-    /* 计算总长度：帧头(2) + 方向(1) + 长度(2) + 载荷 + 校验和 + 帧尾(1) */
-    uint16_t total_len = 2 + 1 + 2 + payload_len + checksum_bytes + 1;
-    
-    if (output_size < total_len) {
-        return -2;  /* 缓冲区不足 */
-    }
-    
-    uint16_t pos = 0;
-    
     /* 帧起始 */
-    output[pos++] = STC_FRAME_START1;   /* 0x46 */
-    output[pos++] = STC_FRAME_START2;   /* 0xB9 */
+    frame[0] = STC_FRAME_START1;    /* 0x46 */
+    frame[1] = STC_FRAME_START2;    /* 0xB9 */
     
     /* 方向标志（Host -> MCU） */
-    output[pos++] = STC_FRAME_DIR_HOST; /* 0x6A */
+    frame[2] = STC_FRAME_DIR_HOST;  /* 0x6A */
     
     /* 数据长度（大端序）：长度字段包含方向(1) + 长度本身(2) + 载荷 + 校验和 */
     uint16_t len_field = 1 + 2 + payload_len + checksum_bytes;
-    output[pos++] = (len_field >> 8) & 0xFF;
-    output[pos++] = len_field & 0xFF;
+    frame[3] = (len_field >> 8) & 0xFF;
+    frame[4] = len_field & 0xFF;
     
-    /* 数据载荷 */
-    memcpy(&output[pos], payload, payload_len);
-    pos += payload_len;
+    /* 校验和（从方向字节开始到载荷结束） */
+    uint32_t sum = payload_sum + frame[2] + frame[3] + frame[4];
+    uint16_t checksum;
     
-    /* 计算校验和（从方向字节开始到载荷结束） */
-    uint16_t checksum = stc_calc_checksum(config, &output[2], pos - 2);
+    switch (config->checksum_type) {
+        case STC_CHECKSUM_DOUBLE_BYTE:
+            checksum = (uint16_t)sum;
+            break;
+        case STC_CHECKSUM_USB_BLOCK:
+            checksum = (uint8_t)(0 - sum);
+            break;
+        default:
+            checksum = (uint8_t)sum;
+            break;
+    }
+    
+    uint16_t pos = STC_PACKET_HEADROOM + payload_len;
     
-    /* 添加校验和 */
     if (checksum_bytes == 2) {
-        output[pos++] = (checksum >> 8) & 0xFF;
-        output[pos++] = checksum & 0xFF;
+        frame[pos++] = (checksum >> 8) & 0xFF;
+        frame[pos++] = checksum & 0xFF;
     } else {
-        output[pos++] = checksum & 0xFF;
+        frame[pos++] = checksum & 0xFF;
     }
     
     /* 帧结束 */
-    output[pos++] = STC_FRAME_END;      /* 0x16 */
+    frame[pos++] = STC_FRAME_END;   /* 0x16 */
     
     return pos;
 }
 
-int stc_build_usb_packet(const uint8_t* payload, uint16_t payload_len,
-                         uint8_t* output, uint16_t output_size)
+int stc_packet_finalize(const stc_protocol_config_t* config, uint8_t* frame,
+                        uint16_t payload_len, uint16_t frame_size)
 {
-    if (payload == NULL || output == NULL) {
+    if (config == NULL || frame == NULL) {
+        return -1;
+    }
+    
+    if (frame_size < frame_length(config, payload_len)) {
+        return -2;  /* 缓冲区不足 */
+    }
+    
+    return finalize_frame(config, frame, payload_len,
+                          sum_bytes(STC_PACKET_PAYLOAD(frame), payload_len));
+}
+
+int stc_build_packet(const stc_protocol_config_t* config,
+                     const uint8_t* payload, uint16_t payload_len,
+                     uint8_t* output, uint16_t output_size)
+{
+    if (config == NULL || payload == NULL || output == NULL) {
+        return -1;
+    }
+    
+    if (output_size < frame_length(config, payload_len)) {
+        return -2;  /* 缓冲区不足 */
+    }
+    
+    /* 载荷已在输出缓冲区中就位时不再复制 */
+    uint8_t* dst = STC_PACKET_PAYLOAD(output);
+    uint32_t sum;
+    if (payload == dst) {
+        sum = sum_bytes(dst, payload_len);
+    } else {
+        sum = copy_sum_bytes(dst, payload, payload_len);
+    }
+    
+    return finalize_frame(config, output, payload_len, sum);
+}
+
+int stc_packet_finalize_usb(uint8_t* frame, uint16_t payload_len, uint16_t frame_size)
+{
+    if (frame == NULL) {
         return -1;
     }
     
@@ -126,32 +285,48 @@ int stc_build_usb_packet(const uint8_t* payload, uint16_t payload_len,
     uint16_t num_blocks = (payload_len + 6) / 7;  /* 向上取整 */
     uint16_t total_len = payload_len + num_blocks;
     
-    if (output_size < total_len) {
+    if (frame_size < total_len) {
         return -2;
     }
     
-    uint16_t out_pos = 0;
-    uint16_t in_pos = 0;
-    
-    while (in_pos < payload_len) {
-        /* 计算当前块大小（最多7字节） */
+    /* 从最后一块向前展开：块的目标位置不小于源位置，原地移动不会覆盖未处理数据 */
+    uint16_t block = num_blocks;
+    while (block > 0) {
+        block--;
+        uint16_t in_pos = block * 7;
+        uint16_t out_pos = block * 8;
         uint16_t block_len = payload_len - in_pos;
         if (block_len > 7) {
             block_len = 7;
         }
         
-        /* 复制数据 */
-        memcpy(&output[out_pos], &payload[in_pos], block_len);
-        out_pos += block_len;
-        
-        /* 计算并添加校验和（减法校验） */
-        uint8_t checksum = stc_checksum_usb_block(&payload[in_pos], block_len);
-        output[out_pos++] = checksum;
-        
-        in_pos += block_len;
+        /* 计算校验和（减法校验）后移动数据 */
+        uint8_t checksum = (uint8_t)(0 - sum_bytes(&frame[in_pos], block_len));
+        if (out_pos != in_pos) {
+            memmove(&frame[out_pos], &frame[in_pos], block_len);
+        }
+        frame[out_pos + block_len] = checksum;
+    }
+    
+    return total_len;
+}
+
+int stc_build_usb_packet(const uint8_t* payload, uint16_t payload_len,
+                         uint8_t* output, uint16_t output_size)
+{
+    if (payload == NULL || output == NULL) {
+        return -1;
+    }
+    
+    if (output_size < payload_len) {
+        return -2;
+    }
+    
+    if (payload != output) {
+        memmove(output, payload, payload_len);
     }
     
-    return out_pos;
+    return stc_packet_finalize_usb(output, payload_len, output_size);
 }
 
 /*============================================================================
@@ -33,6 +33,15 @@ uint8_t stc_checksum_8bit(const uint8_t* data, uint16_t len);
  */
 uint16_t stc_checksum_16bit(const uint8_t* data, uint16_t len);
 
+/**
+ * @brief 复制数据并计算字节和（构建帧时一次遍历完成复制和校验）
+ * @param dst 目标地址
+ * @param src 源地址
+ * @param len 数据长度
+ * @return 字节和（低16位，单字节校验和取低8位）
+ */
+uint16_t stc_checksum_copy(uint8_t* dst, const uint8_t* src, uint16_t len);
+
 /**
  * @brief 计算USB块校验和（每7字节一组，减法校验）
  * @param data 数据指针
@@ -54,8 +63,39 @@ uint16_t stc_calc_checksum(const stc_protocol_config_t* config, const uint8_t* d
  * 数据包构建
  *============================================================================*/
 
+/**
+ * @brief 原地构建帧布局：帧头(2) + 方向(1) + 长度(2) | 载荷 | 校验和(1-2) + 帧尾(1)
+ * 调用者先将载荷直接写入STC_PACKET_PAYLOAD(frame)，再调用stc_packet_finalize()
+ */
+#define STC_PACKET_HEADROOM         5   // 载荷前保留的帧头字节数
+#define STC_PACKET_TAILROOM         3   // 载荷后保留的校验和+帧尾最大字节数
+#define STC_PACKET_PAYLOAD(frame)   ((frame) + STC_PACKET_HEADROOM)
+#define STC_PACKET_FRAME_SIZE(payload_len) \
+    ((uint16_t)(STC_PACKET_HEADROOM + (payload_len) + STC_PACKET_TAILROOM))
+
+/**
+ * @brief 原地完成数据包（Host -> MCU），填写帧头、长度、校验和与帧尾
+ * @param config 协议配置
+ * @param frame 帧缓冲区，载荷已写入STC_PACKET_PAYLOAD(frame)
+ * @param payload_len 载荷长度
+ * @param frame_size 帧缓冲区大小
+ * @return 数据包总长度，<0失败
+ */
+int stc_packet_finalize(const stc_protocol_config_t* config, uint8_t* frame,
+                        uint16_t payload_len, uint16_t frame_size);
+
+/**
+ * @brief 原地完成USB数据包，将frame起始处的载荷展开为每7字节+1校验
+ * @param frame 帧缓冲区，载荷已写入frame起始处
+ * @param payload_len 载荷长度
+ * @param frame_size 帧缓冲区大小
+ * @return 数据包总长度，<0失败
+ */
+int stc_packet_finalize_usb(uint8_t* frame, uint16_t payload_len, uint16_t frame_size);
+
 /**
  * @brief 构建写入数据包（Host -> MCU）
+ * 载荷位于STC_PACKET_PAYLOAD(output)时不复制，等同stc_packet_finalize()
  * @param config 协议配置
  * @param payload 载荷数据
  * @param payload_len 载荷长度
@@ -69,6 +109,7 @@ int stc_build_packet(const stc_protocol_config_t* config,
 
 /**
  * @brief 构建USB数据包（每7字节+1校验）
+ * 载荷复制到output起始处后调用stc_packet_finalize_usb()
  * @param payload 载荷数据
  * @param payload_len 载荷长度
  * @param output 输出缓冲区
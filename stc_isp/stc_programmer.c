@@ -25,14 +25,39 @@ static const char* g_error_strings[] = {
     "参数无效",                      // STC_ERR_INVALID_PARAM
     "无响应",                        // STC_ERR_NO_RESPONSE
     "MCU已锁定",                     // STC_ERR_MCU_LOCKED
+    "帧缓冲区繁忙",                  // STC_ERR_BUSY
 };
 
+/*============================================================================
+ * 镜像数据源
+ * RAM镜像直接返回指针；流式镜像使用帧缓冲区中的双缓冲：cur为正在编程的块，
+ * 另一块由空闲回调在等待目标响应时预读
+ *============================================================================*/
+typedef struct {
+    const uint8_t*      data;           // RAM镜像（流式时为NULL）
+    stc_image_read_cb_t read_cb;        // 流式读取回调
+    void*               user_data;      // 回调用户数据
+    uint32_t            len;            // 镜像长度
+    uint8_t*            buf[2];         // 预读缓冲区
+    uint32_t            base[2];        // 缓冲区对应的镜像偏移
+    uint16_t            fill[2];        // 缓冲区有效长度（0为空闲）
+    uint8_t             cur;            // 当前编程使用的缓冲区
+    uint32_t            next;           // 下一个待预读的偏移
+    int                 error;          // 读取错误（STC_OK为正常）
+} image_feed_t;
+
 /*============================================================================
  * 内部函数声明
  *============================================================================*/
 static int wait_for_status_packet(stc_context_t* ctx, uint32_t timeout_ms);
 static int parse_status_and_identify(stc_context_t* ctx);
 static void update_progress(stc_context_t* ctx, uint32_t current, uint32_t total);
+static int connect_target(stc_context_t* ctx, uint32_t timeout_ms);
+static int program_target(stc_context_t* ctx, image_feed_t* feed,
+                          const stc_program_config_t* config);
+static int erase_target(stc_context_t* ctx);
+static void feed_prefetch(void* user_data);
+static const uint8_t* feed_block(image_feed_t* feed, uint32_t addr, uint16_t len);
 
 /*============================================================================
  * API实现
@@ -80,6 +105,19 @@ int stc_connect(stc_context_t* ctx, uint32_t timeout_ms)
     /* 重置上下文 */
     stc_context_reset(ctx);
     
+    /* 操作期间租用帧缓冲区 */
+    int ret = stc_context_acquire_frame(ctx);
+    if (ret != STC_OK) {
+        return ret;
+    }
+    
+    ret = connect_target(ctx, timeout_ms);
+    stc_context_release_frame(ctx);
+    return ret;
+}
+
+static int connect_target(stc_context_t* ctx, uint32_t timeout_ms)
+{
     /* 设置握手波特率 */
     ctx->hal->set_baudrate(ctx->uart_handle, ctx->comm_config.baud_handshake);
     
@@ -121,7 +159,7 @@ int stc_select_protocol(stc_context_t* ctx)
     }
     
     /* 自动模式：根据型号名称匹配协议 */
-    if (ctx->mcu_info.model_name == NULL) {
+    if (ctx->mcu_info.model_name[0] == '\0') {
         return STC_ERR_UNKNOWN_MODEL;
     }
     
@@ -146,7 +184,63 @@ int stc_program(stc_context_t* ctx, const uint8_t* data, uint32_t len,
         return STC_ERR_PROTOCOL;
     }
     
+    int ret = stc_context_acquire_frame(ctx);
+    if (ret != STC_OK) {
+        return ret;
+    }
+    
+    image_feed_t feed;
+    memset(&feed, 0, sizeof(feed));
+    feed.data = data;
+    feed.len = len;
+    
+    ret = program_target(ctx, &feed, config);
+    stc_context_release_frame(ctx);
+    return ret;
+}
+
+int stc_program_stream(stc_context_t* ctx, stc_image_read_cb_t read_cb, void* user_data,
+                       uint32_t len, stc_prefetch_buf_t* prefetch,
+                       const stc_program_config_t* config)
+{
+    if (ctx == NULL || read_cb == NULL || prefetch == NULL || len == 0) {
+        return STC_ERR_INVALID_PARAM;
+    }
+    
+    if (ctx->config == NULL || ctx->ops == NULL) {
+        return STC_ERR_PROTOCOL;
+    }
+    
+    int ret = stc_context_acquire_frame(ctx);
+    if (ret != STC_OK) {
+        return ret;
+    }
+    
+    image_feed_t feed;
+    memset(&feed, 0, sizeof(feed));
+    feed.read_cb = read_cb;
+    feed.user_data = user_data;
+    feed.len = len;
+    feed.buf[0] = prefetch->image[0];
+    feed.buf[1] = prefetch->image[1];
+    
+    /* 等待目标响应期间预读镜像（握手、校准、擦除、编程应答） */
+    stc_idle_cb_t idle_cb = ctx->idle_cb;
+    void* idle_user_data = ctx->idle_user_data;
+    stc_context_set_idle_callback(ctx, feed_prefetch, &feed);
+    
+    ret = program_target(ctx, &feed, config);
+    
+    stc_context_set_idle_callback(ctx, idle_cb, idle_user_data);
+    stc_context_release_frame(ctx);
+    return ret;
+}
+
+static int program_target(stc_context_t* ctx, image_feed_t* feed,
+                          const stc_program_config_t* config)
+{
     int ret;
+    uint32_t len = feed->len;
     
     /* 应用配置 */
     if (config != NULL) {
@@ -191,8 +285,12 @@ int stc_program(stc_context_t* ctx, const uint8_t* data, uint32_t len,
         
         while (addr < len) {
             uint16_t block_len = (len - addr < block_size) ? (len - addr) : block_size;
+            const uint8_t* block = feed_block(feed, addr, block_len);
+            if (block == NULL) {
+                return (feed->error != STC_OK) ? feed->error : STC_ERR_INVALID_PARAM;
+            }
             
-            ret = ctx->ops->program_block(ctx, addr, &data[addr], block_len, is_first);
+            ret = ctx->ops->program_block(ctx, addr, block, block_len, is_first);
             if (ret != STC_OK) {
                 return ret;
             }
@@ -232,6 +330,18 @@ int stc_erase_only(stc_context_t* ctx, uint8_t erase_eeprom)
         return STC_ERR_INVALID_PARAM;
     }
     
+    int ret = stc_context_acquire_frame(ctx);
+    if (ret != STC_OK) {
+        return ret;
+    }
+    
+    ret = erase_target(ctx);
+    stc_context_release_frame(ctx);
+    return ret;
+}
+
+static int erase_target(stc_context_t* ctx)
+{
     int ret;
     
     /* 握手 */
@@ -273,7 +383,12 @@ int stc_disconnect(stc_context_t* ctx)
     }
     
     if (ctx->ops != NULL && ctx->ops->disconnect != NULL) {
+        int ret = stc_context_acquire_frame(ctx);
+        if (ret != STC_OK) {
+            return ret;
+        }
         ctx->ops->disconnect(ctx);
+        stc_context_release_frame(ctx);
     }
     
     return STC_OK;
@@ -313,6 +428,74 @@ const char* stc_get_error_string(int error)
  * 内部函数实现
  *============================================================================*/
 
+/**
+ * @brief 预读一个镜像块到空闲缓冲区（空闲回调）
+ * @note 优先填充当前缓冲区，其次填充下一个缓冲区；两块都满时不做任何事
+ */
+static void feed_prefetch(void* user_data)
+{
+    image_feed_t* feed = (image_feed_t*)user_data;
+    uint8_t idx;
+    
+    if (feed->error != STC_OK || feed->next >= feed->len) {
+        return;
+    }
+    
+    if (feed->fill[feed->cur] == 0) {
+        idx = feed->cur;
+    } else if (feed->fill[feed->cur ^ 1] == 0) {
+        idx = feed->cur ^ 1;
+    } else {
+        return;
+    }
+    
+    uint16_t n = (uint16_t)MIN(feed->len - feed->next, STC_PREFETCH_CHUNK);
+    int ret = feed->read_cb(feed->user_data, feed->next, feed->buf[idx], n);
+    if (ret != STC_OK) {
+        feed->error = ret;
+        return;
+    }
+    
+    feed->base[idx] = feed->next;
+    feed->fill[idx] = n;
+    feed->next += n;
+}
+
+/**
+ * @brief 获取编程块数据
+ * @return 数据指针，读取失败返回NULL
+ * @note 块按编程块大小对齐，不会跨越预读块边界；
+ *       返回的指针在下一次调用前有效
+ */
+static const uint8_t* feed_block(image_feed_t* feed, uint32_t addr, uint16_t len)
+{
+    if (feed->data != NULL) {
+        return &feed->data[addr];
+    }
+    
+    /* 当前缓冲区已用完：释放并切换到预读好的下一块 */
+    if (feed->fill[feed->cur] != 0 &&
+        addr >= feed->base[feed->cur] + feed->fill[feed->cur]) {
+        feed->fill[feed->cur] = 0;
+        feed->cur ^= 1;
+    }
+    
+    /* 预读未赶上时同步读取 */
+    while (feed->fill[feed->cur] == 0) {
+        feed_prefetch(feed);
+        if (feed->error != STC_OK || (feed->fill[feed->cur] == 0 && feed->next >= feed->len)) {
+            return NULL;
+        }
+    }
+    
+    if (addr < feed->base[feed->cur] ||
+        addr + len > feed->base[feed->cur] + feed->fill[feed->cur]) {
+        return NULL;
+    }
+    
+    return &feed->buf[feed->cur][addr - feed->base[feed->cur]];
+}
+
 static int wait_for_status_packet(stc_context_t* ctx, uint32_t timeout_ms)
 {
     uint32_t start_tick = ctx->hal->get_tick_ms();
@@ -325,15 +508,15 @@ static int wait_for_status_packet(stc_context_t* ctx, uint32_t timeout_ms)
         ctx->hal->delay_ms(30);
         
         /* 尝试读取状态包 */
-        int rx_len = ctx->hal->read(ctx->uart_handle, ctx->rx_buffer, 
-                                     sizeof(ctx->rx_buffer), 100);
+        int rx_len = ctx->hal->read(ctx->uart_handle, ctx->frame->rx, 
+                                     sizeof(ctx->frame->rx), 100);
         
         if (rx_len > 0) {
             /* 检查是否为有效的状态包 */
             if (rx_len >= 20 && 
-                ctx->rx_buffer[0] == STC_FRAME_START1 && 
-                ctx->rx_buffer[1] == STC_FRAME_START2) {
-                ctx->rx_len = rx_len;
+                ctx->frame->rx[0] == STC_FRAME_START1 && 
+                ctx->frame->rx[1] == STC_FRAME_START2) {
+                ctx->frame->rx_len = rx_len;
                 return STC_OK;
             }
         }
@@ -354,11 +537,11 @@ static int parse_status_and_identify(stc_context_t* ctx)
     stc_packet_info_t info;
     
     /* 尝试用默认配置解析 */
-    int ret = stc_parse_packet(&stc_config_stc15, ctx->rx_buffer, ctx->rx_len, &info);
+    int ret = stc_parse_packet(&stc_config_stc15, ctx->frame->rx, ctx->frame->rx_len, &info);
     
     if (ret != STC_OK) {
         /* 尝试用单字节校验和解析（STC89） */
-        ret = stc_parse_packet(&stc_config_stc89, ctx->rx_buffer, ctx->rx_len, &info);
+        ret = stc_parse_packet(&stc_config_stc89, ctx->frame->rx, ctx->frame->rx_len, &info);
         if (ret != STC_OK) {
             return STC_ERR_FRAME;
         }
@@ -373,16 +556,20 @@ static int parse_status_and_identify(stc_context_t* ctx)
     }
     
     /* 查找型号 */
-    const stc_model_info_t* model = stc_find_model_by_magic(ctx->mcu_info.magic);
-    if (model != NULL) {
-        ctx->mcu_info.model_name = model->name;
-        ctx->mcu_info.flash_size = model->flash_size;
-        ctx->mcu_info.eeprom_size = model->eeprom_size;
+    stc_model_info_t model;
+    if (stc_find_model_by_magic(ctx->mcu_info.magic, &model) == STC_OK) {
+        memcpy(ctx->mcu_info.model_name, model.name, sizeof(ctx->mcu_info.model_name));
+        ctx->mcu_info.flash_size = model.flash_size;
+        ctx->mcu_info.eeprom_size = model.eeprom_size;
         
         /* 自动模式下根据型号选择协议 */
         if (ctx->select_mode == STC_SELECT_AUTO) {
-            stc_get_protocol_by_id(model->protocol_id, &ctx->config, &ctx->ops);
-            ctx->detected_proto_id = model->protocol_id;
+            if (model.protocol_id >= STC_PROTO_COUNT) {
+                /* 型号已知但无对应协议，需手动选择 */
+                return STC_ERR_UNKNOWN_MODEL;
+            }
+            stc_get_protocol_by_id(model.protocol_id, &ctx->config, &ctx->ops);
+            ctx->detected_proto_id = model.protocol_id;
             ctx->proto_detected = 1;
         }
     } else {
@@ -79,6 +79,23 @@ int stc_select_protocol(stc_context_t* ctx);
 int stc_program(stc_context_t* ctx, const uint8_t* data, uint32_t len, 
                 const stc_program_config_t* config);
 
+/**
+ * @brief 流式烧录（镜像不必整体位于RAM，例如从SD卡读取）
+ * @param ctx 上下文指针
+ * @param read_cb 镜像读取回调
+ * @param user_data 回调用户数据
+ * @param len 镜像长度
+ * @param prefetch 预读双缓冲（调用方提供，执行期间独占）
+ * @param config 烧录配置（NULL使用默认）
+ * @return STC_OK成功
+ * @note 镜像按STC_PREFETCH_CHUNK分块读入prefetch的双缓冲，读取在等待目标
+ *       响应期间（擦除、每块编程应答）通过空闲回调完成，与串口通信重叠；
+ *       执行期间占用上下文的空闲回调，结束后恢复
+ */
+int stc_program_stream(stc_context_t* ctx, stc_image_read_cb_t read_cb, void* user_data,
+                       uint32_t len, stc_prefetch_buf_t* prefetch,
+                       const stc_program_config_t* config);
+
 /**
  * @brief 仅执行擦除
  * @param ctx 上下文指针
@@ -31,6 +31,7 @@ typedef enum {
     STC_ERR_INVALID_PARAM = -11,
     STC_ERR_NO_RESPONSE = -12,
     STC_ERR_MCU_LOCKED = -13,
+    STC_ERR_BUSY = -14,
 } stc_error_t;
 
 /*============================================================================
@@ -129,6 +130,8 @@ typedef enum {
 #define STC_MAX_PACKET_SIZE         512
 #define STC_MAX_PAYLOAD_SIZE        256
 #define STC_UID_SIZE                7
+#define STC_STATUS_PACKET_SIZE      64      // 状态包保存长度（各协议解析最大偏移57）
+#define STC_MODEL_NAME_MAX          24      // 型号名称最大长度（含结束符）
 
 /*============================================================================
  * 进度回调函数类型
@@ -140,6 +143,17 @@ typedef void (*stc_progress_cb_t)(uint32_t current, uint32_t total, void* user_d
  *============================================================================*/
 typedef void (*stc_log_cb_t)(const char* message, void* user_data);
 
+/*============================================================================
+ * 空闲回调函数类型（等待目标响应期间调用，用于后台预读等）
+ *============================================================================*/
+typedef void (*stc_idle_cb_t)(void* user_data);
+
+/*============================================================================
+ * 固件镜像读取回调类型（流式烧录，返回STC_OK成功）
+ *============================================================================*/
+typedef int (*stc_image_read_cb_t)(void* user_data, uint32_t offset,
+                                   uint8_t* buf, uint32_t len);
+
 /*============================================================================
  * 工具宏
  *============================================================================*/
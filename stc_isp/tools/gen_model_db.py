@@ -0,0 +1,314 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+STC型号数据库生成器
+
+从 stcgal 的 models.py 读取完整型号列表，生成紧凑的 stc_model_db_table.h：
+- g_model_name_pool:   共享字符串池，型号名称拆分为"前缀+后缀"两段，相同片段只存一份
+- g_model_prefix:      名称前缀在字符串池中的16位偏移
+- g_model_magic_start: 按Magic高字节分桶的起始下标（Magic查找O(1)定位到桶）
+- g_model_db:          每型号6字节的打包条目，按Magic值升序
+- g_model_name_index:  按名称排序的索引（名称查找使用二分法）
+
+打包格式（宏定义见stc_model_db.c）：
+- Magic只存低字节，高字节由所在的桶给出
+- 名称后缀偏移12位，协议ID放在同一个16位字的高4位
+- Flash/EEPROM大小以512字节为单位（部分型号为x.5KB，不能用1KB单位）
+
+用法:
+    python3 gen_model_db.py [--models 路径] [--output 路径]
+
+型号表变更（更新stcgal、调整协议映射）后重新运行本脚本并提交生成文件。
+"""
+
+import argparse
+import collections
+import importlib.util
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_ROOT = os.path.normpath(os.path.join(SCRIPT_DIR, "..", ".."))
+
+DEFAULT_MODELS = os.path.join(REPO_ROOT, "other", "stcgal-master", "stcgal", "models.py")
+DEFAULT_OUTPUT = os.path.join(SCRIPT_DIR, "..", "stc_model_db_table.h")
+
+# 型号名称 -> 协议ID 映射规则（与stcgal StcAutoProtocol的匹配顺序一致）
+# 未匹配的型号使用 STC_PROTO_COUNT，表示需要手动选择协议
+PROTOCOL_RULES = [
+    (r"STC(89|90)(C|LE)\d",             "STC_PROTO_STC89"),
+    (r"STC12(C|LE)\d052",               "STC_PROTO_STC89A"),
+    (r"STC12(C|LE)(52|56)",             "STC_PROTO_STC12"),
+    (r"(STC|IAP)(10|11|12)\D",          "STC_PROTO_STC12"),
+    (r"(STC|IAP)15[FL][012]0\d(E|EA|)$", "STC_PROTO_STC15A"),
+    (r"(STC|IAP|IRC)15\D",              "STC_PROTO_STC15"),
+    (r"STC8H1K\d\d$",                   "STC_PROTO_STC8G"),
+    (r"STC8G",                          "STC_PROTO_STC8G"),
+    (r"STC8H",                          "STC_PROTO_STC8D"),
+    (r"STC32",                          "STC_PROTO_STC32"),
+    (r"STC8A8K\d\dD\d",                 "STC_PROTO_STC8D"),
+    (r"STC8\D",                         "STC_PROTO_STC8"),
+]
+
+PROTOCOL_NONE = "STC_PROTO_COUNT"
+
+# 打包字段范围（须与stc_model_db.c中的宏一致）
+SIZE_UNIT = 512
+FLASH_UNITS_MAX = (1 << 9) - 1
+EEPROM_UNITS_MAX = (1 << 7) - 1
+SUFFIX_OFFSET_MAX = (1 << 12) - 1
+PREFIX_COUNT_MAX = 256
+NAME_MAX = 24               # STC_MODEL_NAME_MAX，含结束符
+
+
+def load_models(path):
+    """导入models.py并返回型号列表（保持原始顺序）"""
+    spec = importlib.util.spec_from_file_location("stcgal_models", path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return list(module.MCUModelDatabase.models)
+
+
+def match_protocol(name):
+    for pattern, proto in PROTOCOL_RULES:
+        if re.match(pattern, name):
+            return proto
+    return PROTOCOL_NONE
+
+
+def split_names(names):
+    """
+    为每个名称选择前缀/后缀拆分点，使去重后的片段总长度最小。
+    初始按"字母族+首个数字段+字母"拆分，再逐个名称做局部最优调整直到收敛。
+    """
+    split = {}
+    for n in names:
+        m = re.match(r"^(.*?[A-Z]+\d*[A-Z]+)(.*)$", n)
+        split[n] = (m.group(1), m.group(2)) if m else ("", n)
+
+    prefixes = collections.Counter(p for p, _ in split.values())
+    suffixes = collections.Counter(s for _, s in split.values())
+
+    changed = True
+    while changed:
+        changed = False
+        for n in names:
+            p0, s0 = split[n]
+            prefixes[p0] -= 1
+            suffixes[s0] -= 1
+            best = None
+            for k in range(len(n) + 1):
+                p, s = n[:k], n[k:]
+                cost = (0 if prefixes[p] > 0 else len(p) + 1) + \
+                       (0 if suffixes[s] > 0 else len(s) + 1)
+                if best is None or cost < best[0]:
+                    best = (cost, p, s)
+            _, p, s = best
+            prefixes[p] += 1
+            suffixes[s] += 1
+            if (p, s) != (p0, s0):
+                split[n] = (p, s)
+                changed = True
+
+    return split
+
+
+def build_pool(strings):
+    """
+    构建NUL结尾的字符串池，是其他片段尾部的片段直接复用其存储。
+    返回(池字节串, {片段: 偏移})
+    """
+    ordered = sorted(set(strings), key=lambda s: s[::-1], reverse=True)
+    pool = bytearray()
+    offsets = {}
+    prev = None
+    for s in ordered:
+        if prev is not None and prev.endswith(s):
+            offsets[s] = offsets[prev] + len(prev) - len(s)
+            continue
+        offsets[s] = len(pool)
+        pool += s.encode("ascii") + b"\0"
+        prev = s
+    return bytes(pool), offsets
+
+
+def build_tables(models):
+    # 稳定排序：同一Magic的多个型号保持stcgal中的先后顺序（stcgal取第一个匹配）
+    by_magic = sorted(models, key=lambda m: m.magic)
+    name_index = sorted(range(len(by_magic)),
+                        key=lambda i: (by_magic[i].name.encode("ascii"), i))
+
+    split = split_names(sorted(set(m.name for m in by_magic)))
+
+    # 后缀放在池前部，保证12位偏移可达；前缀放在后部，通过前缀表的16位偏移访问
+    suffix_pool, suffix_off = build_pool(s for _, s in split.values())
+    prefix_pool, prefix_off = build_pool(p for p, _ in split.values())
+    pool = suffix_pool + prefix_pool
+    prefix_list = sorted(prefix_off, key=lambda p: (prefix_off[p], p))
+    prefix_id = {p: i for i, p in enumerate(prefix_list)}
+    prefix_table = [len(suffix_pool) + prefix_off[p] for p in prefix_list]
+
+    hi_first = by_magic[0].magic >> 8
+    hi_last = by_magic[-1].magic >> 8
+    magic_start = []
+    i = 0
+    for hi in range(hi_first, hi_last + 2):
+        while i < len(by_magic) and (by_magic[i].magic >> 8) < hi:
+            i += 1
+        magic_start.append(i)
+
+    entries = []
+    for m in by_magic:
+        p, s = split[m.name]
+        entries.append((m, prefix_id[p], suffix_off[s], match_protocol(m.name)))
+
+    return {
+        "by_magic": by_magic,
+        "name_index": name_index,
+        "pool": pool,
+        "prefix_table": prefix_table,
+        "hi_first": hi_first,
+        "magic_start": magic_start,
+        "entries": entries,
+        "split": split,
+    }
+
+
+def decode_name(t, prefix, suffix_off):
+    pool = t["pool"]
+    start = t["prefix_table"][prefix]
+    p = pool[start:pool.index(b"\0", start)]
+    s = pool[suffix_off:pool.index(b"\0", suffix_off)]
+    return (p + s).decode("ascii")
+
+
+def verify(t):
+    """生成前自检：排序、索引、打包字段范围，并按打包数据回解校验每个型号"""
+    by_magic = t["by_magic"]
+    assert len(by_magic) < 0xFFFF, "索引超出uint16_t范围"
+    for a, b in zip(by_magic, by_magic[1:]):
+        assert a.magic <= b.magic
+    assert sorted(t["name_index"]) == list(range(len(by_magic)))
+    names = [by_magic[i].name.encode("ascii") for i in t["name_index"]]
+    assert names == sorted(names)
+    assert len(t["prefix_table"]) <= PREFIX_COUNT_MAX, "前缀数超出8位"
+    assert len(t["pool"]) <= 0xFFFF, "字符串池超出16位偏移"
+
+    for idx, (m, prefix, suffix_off, _) in enumerate(t["entries"]):
+        assert suffix_off <= SUFFIX_OFFSET_MAX, "后缀偏移超出12位: %s" % m.name
+        assert m.code % SIZE_UNIT == 0 and m.code // SIZE_UNIT <= FLASH_UNITS_MAX, m.name
+        assert m.eeprom % SIZE_UNIT == 0 and m.eeprom // SIZE_UNIT <= EEPROM_UNITS_MAX, m.name
+        assert len(m.name) < NAME_MAX, "名称过长: %s" % m.name
+        assert decode_name(t, prefix, suffix_off) == m.name
+        hi = (m.magic >> 8) - t["hi_first"]
+        assert t["magic_start"][hi] <= idx < t["magic_start"][hi + 1]
+
+
+def render(models_path, t):
+    rel_src = os.path.relpath(models_path, REPO_ROOT).replace(os.sep, "/")
+    entries = t["entries"]
+    manual = sum(1 for e in entries if e[3] == PROTOCOL_NONE)
+    total = (len(t["pool"]) + 2 * len(t["prefix_table"]) + 2 * len(t["magic_start"]) +
+             6 * len(entries) + 2 * len(t["name_index"]))
+
+    out = []
+    out.append("/**")
+    out.append(" * @file stc_model_db_table.h")
+    out.append(" * @brief STC型号数据库表（由tools/gen_model_db.py自动生成，请勿手动修改）")
+    out.append(" *")
+    out.append(" * 数据来源: %s" % rel_src)
+    out.append(" * 型号总数: %d（其中%d个需要手动选择协议）" % (len(entries), manual))
+    out.append(" * 字符串池: %d字节，前缀%d个" % (len(t["pool"]), len(t["prefix_table"])))
+    out.append(" * 总占用:   约%d字节Flash" % total)
+    out.append(" *")
+    out.append(" * 仅供stc_model_db.c包含使用")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef __STC_MODEL_DB_TABLE_H__")
+    out.append("#define __STC_MODEL_DB_TABLE_H__")
+    out.append("")
+    out.append("#define STC_MODEL_DB_COUNT      %d" % len(entries))
+    out.append("#define STC_MODEL_PREFIX_COUNT  %d" % len(t["prefix_table"]))
+    out.append("#define STC_MODEL_MAGIC_HI_FIRST 0x%02X" % t["hi_first"])
+    out.append("#define STC_MODEL_MAGIC_BUCKETS %d" % (len(t["magic_start"]) - 1))
+    out.append("")
+    out.append("/*============================================================================")
+    out.append(" * 名称字符串池（后缀片段在前，前缀片段在后）")
+    out.append(" *============================================================================*/")
+    out.append("static const char g_model_name_pool[%d] =" % len(t["pool"]))
+    frags = t["pool"].split(b"\0")[:-1]
+    line = ""
+    for frag in frags:
+        piece = '"%s\\0"' % frag.decode("ascii")
+        if len(line) + len(piece) + 1 > 76:
+            out.append("    " + line.rstrip())
+            line = ""
+        line += piece + " "
+    if line:
+        out.append("    " + line.rstrip())
+    out[-1] += ";"
+    out.append("")
+    out.append("/*============================================================================")
+    out.append(" * 名称前缀偏移表（条目prefix字段的下标）")
+    out.append(" *============================================================================*/")
+    out.append("static const uint16_t g_model_prefix[STC_MODEL_PREFIX_COUNT] = {")
+    pt = t["prefix_table"]
+    for i in range(0, len(pt), 10):
+        out.append("    %s," % ", ".join("%5d" % v for v in pt[i:i + 10]))
+    out.append("};")
+    out.append("")
+    out.append("/*============================================================================")
+    out.append(" * Magic高字节分桶：高字节为(STC_MODEL_MAGIC_HI_FIRST + i)的型号位于")
+    out.append(" * g_model_db[g_model_magic_start[i]] ~ g_model_db[g_model_magic_start[i + 1] - 1]")
+    out.append(" *============================================================================*/")
+    out.append("static const uint16_t g_model_magic_start[STC_MODEL_MAGIC_BUCKETS + 1] = {")
+    ms = t["magic_start"]
+    for i in range(0, len(ms), 10):
+        out.append("    %s," % ", ".join("%4d" % v for v in ms[i:i + 10]))
+    out.append("};")
+    out.append("")
+    out.append("/*============================================================================")
+    out.append(" * 型号表（按Magic值升序）")
+    out.append(" *============================================================================*/")
+    out.append("static const stc_model_packed_t g_model_db[STC_MODEL_DB_COUNT] = {")
+    for m, prefix, suffix_off, proto in entries:
+        out.append("    { 0x%02X, %3d, STC_MODEL_NAME(%4d, %-16s), STC_MODEL_SIZE(%6d, %5d) },  /* %04X %s */" % (
+            m.magic & 0xFF, prefix, suffix_off, proto, m.code, m.eeprom, m.magic, m.name))
+    out.append("};")
+    out.append("")
+    out.append("/*============================================================================")
+    out.append(" * 名称索引（g_model_db下标，按名称字节序升序）")
+    out.append(" *============================================================================*/")
+    out.append("static const uint16_t g_model_name_index[STC_MODEL_DB_COUNT] = {")
+    ni = t["name_index"]
+    for i in range(0, len(ni), 12):
+        out.append("    %s," % ", ".join("%4d" % v for v in ni[i:i + 12]))
+    out.append("};")
+    out.append("")
+    out.append("#endif /* __STC_MODEL_DB_TABLE_H__ */")
+    out.append("")
+    return "\n".join(out), total
+
+
+def main():
+    parser = argparse.ArgumentParser(description="生成STC型号数据库表")
+    parser.add_argument("--models", default=DEFAULT_MODELS, help="stcgal models.py路径")
+    parser.add_argument("--output", default=DEFAULT_OUTPUT, help="输出头文件路径")
+    args = parser.parse_args()
+
+    models = load_models(args.models)
+    tables = build_tables(models)
+    verify(tables)
+
+    text, total = render(args.models, tables)
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+
+    print("生成 %s: %d 个型号，约 %d 字节" % (os.path.normpath(args.output),
+                                          len(tables["entries"]), total))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
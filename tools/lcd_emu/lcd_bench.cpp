@@ -0,0 +1,312 @@
+/**
+  ******************************************************************************
+  * @file    lcd_bench.cpp
+  * @brief   LCD驱动主机回归测试：总线操作预算与绘制正确性
+  *          在模拟器上运行Src/lcd.c，逐个API调用统计总线操作并与预算比较
+  * @note    用法：make -C tools/lcd_emu run
+  *          任一项超预算、像素校验失败、出现时序错误，或驱动自身的
+  *          LCD_GetBusStats与模拟器解码结果不一致时返回非0；
+  *          结束时输出lcd_bench.ppm供目视检查
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lcd.h"
+#include "fonts.h"
+#include "lcd_progress.h"
+#include "lcd_emu.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief 测试项：一次API调用（或一小段调用序列）及其总线操作预算
+ */
+typedef struct {
+    const char   *name;
+    void        (*run)(void);
+    bool        (*check)(void);     /**< 像素校验，可为NULL */
+    unsigned long budget;           /**< 总线操作上限（WR+RD选通） */
+} bench_case_t;
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 检查矩形区域（lcd.c坐标，含边界）是否全为指定颜色
+ */
+static bool expect_area(int x0, int x1, int y0, int y1, uint16_t color)
+{
+    int x, y;
+
+    for (x = x0; x <= x1; x++) {
+        for (y = y0; y <= y1; y++) {
+            if (lcd_emu_pixel(x, y) != color) {
+                printf("    pixel (%d,%d) = %04X, expected %04X\n", x, y, lcd_emu_pixel(x, y), color);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 按字库直接计算的参考结果检查一行文本
+ * @note  第i位为1的像素位于(Line + 行号, 列 - i)
+ */
+static bool expect_text(uint8_t line, const char *text, uint16_t text_color, uint16_t back_color)
+{
+    int n, row, bit;
+    uint16_t column = 319, glyph, expected;
+
+    for (n = 0; text[n] != '\0' && n < LCD_TEXT_COLUMNS; n++, column -= 16) {
+        for (row = 0; row < 24; row++) {
+            glyph = ASCII_Table[(text[n] - 32) * 24 + row];
+            for (bit = 0; bit < 16; bit++) {
+                expected = (glyph & (1 << bit)) ? text_color : back_color;
+                if (lcd_emu_pixel(line + row, column - bit) != expected) {
+                    printf("    '%c' row %d bit %d: %04X, expected %04X\n", text[n], row, bit,
+                           lcd_emu_pixel(line + row, column - bit), expected);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/* 测试项 --------------------------------------------------------------------*/
+
+static void run_clear(void)          { LCD_Clear(Blue); }
+static bool check_clear(void)        { return expect_area(0, 239, 0, 319, Blue); }
+
+static void run_text_first(void)
+{
+    LCD_SetTextColor(White);
+    LCD_SetBackColor(Blue);
+    LCD_DisplayStringLine(Line1, (u8 *)"Hello World 01234567");
+}
+static bool check_text_first(void)   { return expect_text(Line1, "Hello World 01234567", White, Blue); }
+
+static void run_text_same(void)      { LCD_DisplayStringLine(Line1, (u8 *)"Hello World 01234567"); }
+
+static void run_text_one(void)       { LCD_DisplayStringLine(Line1, (u8 *)"Hello World 01234568"); }
+static bool check_text_one(void)     { return expect_text(Line1, "Hello World 01234568", White, Blue); }
+
+static void run_text_color(void)
+{
+    LCD_SetTextColor(Yellow);
+    LCD_DisplayStringLine(Line1, (u8 *)"Hello World 01234568");
+}
+static bool check_text_color(void)   { return expect_text(Line1, "Hello World 01234568", Yellow, Blue); }
+
+static void run_clear_line(void)     { LCD_ClearLine(Line1); }
+static bool check_clear_line(void)   { return expect_area(Line1, Line1 + 23, 0, 319, Blue); }
+
+static void run_hline(void)
+{
+    LCD_SetTextColor(Red);
+    LCD_DrawLine(120, 300, 200, Horizontal);
+}
+static bool check_hline(void)        { return expect_area(120, 120, 101, 300, Red); }
+
+static void run_vline(void)          { LCD_DrawLine(130, 250, 60, Vertical); }
+static bool check_vline(void)        { return expect_area(130, 189, 250, 250, Red); }
+
+static void run_rect(void)           { LCD_DrawRect(140, 200, 40, 80); }
+
+static void run_fill_rect(void)      { LCD_FillRect(200, 300, 16, 100, Green); }
+static bool check_fill_rect(void)    { return expect_area(200, 215, 201, 300, Green); }
+
+static void run_fill_column(void)    { LCD_FillRect(200, 200, 16, 1, Magenta); }
+static bool check_fill_column(void)  { return expect_area(200, 215, 200, 200, Magenta); }
+
+/* 读回：索引写入与RD选通，读回的值与模拟器寄存器/GRAM一致 */
+static u16 s_read_reg, s_read_ram;
+
+static void run_read_back(void)
+{
+    s_read_reg = LCD_ReadReg(R3);
+    LCD_SetCursor(208, 250);
+    s_read_ram = LCD_ReadRAM();
+}
+static bool check_read_back(void)    { return s_read_reg == 0x1018 && s_read_ram == Green; }
+
+static void run_circle(void)         { LCD_DrawCircle(60, 80, 30); }
+
+static void run_text_after_fill(void)
+{
+    LCD_SetTextColor(White);
+    LCD_DisplayStringLine(Line9, (u8 *)"Done");
+}
+static bool check_text_after_fill(void) { return expect_text(Line9, "Done", White, Blue); }
+
+/* 进度条：64KB镜像按128字节块回调，每块约12ms（115200波特） */
+#define PROGRESS_TOTAL      65536UL
+#define PROGRESS_BLOCK      128UL
+#define PROGRESS_BLOCK_MS   12
+
+static const lcd_progress_config_t s_bar_cfg = {
+    100, 299, 12, 280, Green, Black, Line3, "Writing", 0,
+};
+static lcd_progress_t s_bar;
+
+/**
+ * @brief 检查进度条：前columns列为bar_color，其余为back_color，文本行显示percent
+ */
+static bool expect_progress(uint16_t columns, unsigned percent)
+{
+    const lcd_progress_config_t *c = &s_bar_cfg;
+    char line[LCD_TEXT_COLUMNS + 1];
+    int  right = c->y - c->width + 1;
+
+    snprintf(line, sizeof(line), "%-14s%5u%%", c->label, percent);
+    if (columns > 0 && !expect_area(c->x, c->x + c->height - 1, c->y - columns + 1, c->y, c->bar_color)) {
+        return false;
+    }
+    if (columns < c->width && !expect_area(c->x, c->x + c->height - 1, right, c->y - columns, c->back_color)) {
+        return false;
+    }
+    return expect_text(c->text_line, line, White, Blue);
+}
+
+static void run_progress_init(void)
+{
+    LCD_SetTextColor(White);
+    LCD_SetBackColor(Blue);
+    lcd_progress_init(&s_bar, &s_bar_cfg);
+}
+static bool check_progress_init(void)
+{
+    /* 回调计时不依赖SD卡初始化使能DWT */
+    if (!(CoreDebug->DEMCR & CoreDebug_DEMCR_TRCENA_Msk) || !(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        printf("    DWT cycle counter not enabled\n");
+        return false;
+    }
+    return expect_progress(0, 0);
+}
+
+static void run_progress_write(void)
+{
+    uint32_t current;
+
+    for (current = PROGRESS_BLOCK; current <= PROGRESS_TOTAL; current += PROGRESS_BLOCK) {
+        lcd_emu_advance_ms(PROGRESS_BLOCK_MS);
+        lcd_progress_update(current, PROGRESS_TOTAL, &s_bar);
+    }
+}
+static bool check_progress_write(void)
+{
+    if (s_bar.stats.calls.count != PROGRESS_TOTAL / PROGRESS_BLOCK ||
+        s_bar.stats.columns != s_bar_cfg.width) {
+        printf("    %lu call(s), %lu column(s)\n", (unsigned long)s_bar.stats.calls.count,
+               (unsigned long)s_bar.stats.columns);
+        return false;
+    }
+    return expect_progress(s_bar_cfg.width, 100);
+}
+
+static void run_progress_same(void)
+{
+    lcd_progress_update(PROGRESS_TOTAL, PROGRESS_TOTAL, &s_bar);
+    lcd_progress_finish(&s_bar);
+}
+
+/* 接近16MB的镜像：current * width超过32位 */
+static void run_progress_large(void)
+{
+    lcd_progress_init(&s_bar, &s_bar_cfg);
+    lcd_emu_advance_ms(1000);
+    lcd_progress_update(0x00F00000UL, 0x00FFFFFFUL, &s_bar);
+}
+static bool check_progress_large(void)
+{
+    /* 15728640 * 280 / 16777215 = 262.5，百分比93 */
+    return expect_progress(262, 93);
+}
+
+/* 预算按当前实现的实测值留少量余量；驱动优化后同步收紧 */
+static const bench_case_t s_cases[] = {
+    { "LCD_Clear",                      run_clear,           check_clear,           76810 },
+    { "DisplayStringLine (20 chars)",   run_text_first,      check_text_first,       8000 },
+    { "DisplayStringLine (unchanged)",  run_text_same,       NULL,                      0 },
+    { "DisplayStringLine (1 changed)",  run_text_one,        check_text_one,          400 },
+    { "DisplayStringLine (new color)",  run_text_color,      check_text_color,       8000 },
+    { "LCD_ClearLine",                  run_clear_line,      check_clear_line,       7300 },
+    { "DrawLine horizontal 200",        run_hline,           check_hline,             220 },
+    { "DrawLine vertical 60",           run_vline,           check_vline,             380 },
+    { "DrawRect 40x80",                 run_rect,            NULL,                    700 },
+    { "FillRect 16x100",                run_fill_rect,       check_fill_rect,        1620 },
+    { "FillRect 16x1",                  run_fill_column,     check_fill_column,        40 },
+    { "ReadReg + SetCursor + ReadRAM",  run_read_back,       check_read_back,          16 },
+    { "DrawCircle r30",                 run_circle,          NULL,                   1100 },
+    { "DisplayStringLine after fill",   run_text_after_fill, check_text_after_fill,  1650 },
+    { "lcd_progress_init",              run_progress_init,   check_progress_init,   11300 },
+    /* 每次回调重画整条进度条和文本行约需512 x 11000次；增量绘制只写新列与变化的字符 */
+    { "lcd_progress_update x512",       run_progress_write,  check_progress_write,  21500 },
+    { "lcd_progress_update (same)",     run_progress_same,   NULL,                      0 },
+    { "lcd_progress 15 MB of 16 MB",    run_progress_large,  check_progress_large,   8200 },
+};
+
+/* Exported functions --------------------------------------------------------*/
+
+int main(int argc, char **argv)
+{
+    const char *ppm = (argc > 1) ? argv[1] : "lcd_bench.ppm";
+    lcd_emu_ops_t ops;
+    LCD_BusStats  stats;
+    unsigned long driver_ops;
+    bool ok;
+    int failures = 0;
+    size_t i;
+
+    lcd_emu_reset();
+    LCD_Init();
+    ops = lcd_emu_ops(true);
+    printf("LCD_Init: %lu bus ops, %lu GPIO stores, R3 = %04X\n",
+           ops.bus_ops(), ops.gpio_stores, lcd_emu_reg(R3));
+    if (lcd_emu_reg(R3) != 0x1018) {
+        printf("FAIL: unexpected entry mode after LCD_Init\n");
+        failures++;
+    }
+
+    printf("\n%-32s %8s %8s %8s %8s %6s\n", "case", "bus ops", "budget", "pixels", "stores", "result");
+    for (i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++) {
+        const bench_case_t *c = &s_cases[i];
+
+        LCD_ResetBusStats();
+        lcd_emu_ops(true);
+        c->run();
+        ops = lcd_emu_ops(true);
+        LCD_GetBusStats(&stats);
+        driver_ops = stats.WriteCycles + stats.ReadCycles;
+
+        ok = (ops.bus_ops() <= c->budget) && (ops.glitches == 0) && (driver_ops == ops.bus_ops());
+        printf("%-32s %8lu %8lu %8lu %8lu %6s\n", c->name, ops.bus_ops(), c->budget,
+               ops.gram_writes, ops.gpio_stores, ok ? "ok" : "FAIL");
+        if (ops.glitches) {
+            printf("    %lu strobe(s) with CS high\n", ops.glitches);
+        }
+        if (driver_ops != ops.bus_ops()) {
+            printf("    LCD_GetBusStats reports %lu\n", driver_ops);
+        }
+        if (c->check != NULL && !c->check()) {
+            ok = false;
+            printf("    pixel check failed\n");
+        }
+        if (!ok) {
+            failures++;
+        }
+    }
+
+    if (lcd_emu_write_ppm(ppm) != 0) {
+        printf("cannot write %s\n", ppm);
+        failures++;
+    }
+    printf("\nframe hash %016llX, %s\n", (unsigned long long)lcd_emu_hash(), ppm);
+    printf("%d failure(s)\n", failures);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,304 @@
+/**
+  ******************************************************************************
+  * @file    lcd_emu.cpp
+  * @brief   LCD主机模拟器实现文件
+  *          假GPIO寄存器的写钩子 + ILI932x控制器模型
+  * @note    引脚：PB9=CS、PB8=RS、PB5=WR、PA8=RD，数据线为GPIOC；
+  *          WR上升沿锁存ODR，RD下降沿把数据放到IDR。
+  *          GRAM读不模拟首次读的空读周期，读后地址按写入规则前进
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lcd_emu_hw.h"
+#include "lcd_emu.h"
+#include "log.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define PIN_CS          GPIO_PIN_9      /* GPIOB */
+#define PIN_RS          GPIO_PIN_8      /* GPIOB */
+#define PIN_WR          GPIO_PIN_5      /* GPIOB */
+#define PIN_RD          GPIO_PIN_8      /* GPIOA */
+
+#define REG_ID          0x00
+#define REG_ENTRY_MODE  0x03
+#define REG_GRAM_X      0x20
+#define REG_GRAM_Y      0x21
+#define REG_GRAM        0x22
+#define REG_WIN_X_START 0x50
+#define REG_WIN_X_END   0x51
+#define REG_WIN_Y_START 0x52
+#define REG_WIN_Y_END   0x53
+
+#define CHIP_ID         0x9320
+
+/* Private variables ---------------------------------------------------------*/
+
+GPIO_TypeDef lcd_emu_gpioa, lcd_emu_gpiob, lcd_emu_gpioc;
+DWT_Type       lcd_emu_dwt;
+CoreDebug_Type lcd_emu_core_debug;
+uint32_t       SystemCoreClock = 80000000U;
+
+static uint16_t      s_regs[256];
+static uint16_t      s_gram[LCD_EMU_ROWS][LCD_EMU_COLUMNS];
+static uint8_t       s_index;
+static uint16_t      s_x, s_y;                  /* GRAM地址计数器 */
+static bool          s_cs, s_rs, s_wr, s_rd;    /* 引脚电平（true为高） */
+static lcd_emu_ops_t s_ops;
+static uint32_t      s_tick;                    /* HAL_GetTick（毫秒） */
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief GRAM访问后按R3的AM/ID与窗口移动地址计数器
+ * @note  AM=1时先沿列方向（Ypos）移动，到窗口边界后回绕并换行；AM=0相反
+ */
+static void emu_advance(void)
+{
+    uint16_t x0 = s_regs[REG_WIN_X_START], x1 = s_regs[REG_WIN_X_END];
+    uint16_t y0 = s_regs[REG_WIN_Y_START], y1 = s_regs[REG_WIN_Y_END];
+    bool am    = (s_regs[REG_ENTRY_MODE] >> 3) & 1;
+    bool x_inc = (s_regs[REG_ENTRY_MODE] >> 4) & 1;
+    bool y_inc = (s_regs[REG_ENTRY_MODE] >> 5) & 1;
+    bool wrap;
+
+    if (am) {
+        wrap = y_inc ? (s_y >= y1) : (s_y <= y0);
+        s_y  = wrap ? (y_inc ? y0 : y1) : (uint16_t)(y_inc ? s_y + 1 : s_y - 1);
+        if (wrap) {
+            s_x = x_inc ? ((s_x >= x1) ? x0 : s_x + 1) : ((s_x <= x0) ? x1 : s_x - 1);
+        }
+    } else {
+        wrap = x_inc ? (s_x >= x1) : (s_x <= x0);
+        s_x  = wrap ? (x_inc ? x0 : x1) : (uint16_t)(x_inc ? s_x + 1 : s_x - 1);
+        if (wrap) {
+            s_y = y_inc ? ((s_y >= y1) ? y0 : s_y + 1) : ((s_y <= y0) ? y1 : s_y - 1);
+        }
+    }
+}
+
+/**
+ * @brief WR上升沿：锁存数据线
+ */
+static void emu_write_cycle(uint16_t data)
+{
+    if (!s_rs) {
+        s_index = (uint8_t)data;
+        s_ops.index_writes++;
+        return;
+    }
+
+    if (s_index == REG_GRAM) {
+        if (s_x < LCD_EMU_ROWS && s_y < LCD_EMU_COLUMNS) {
+            s_gram[s_x][s_y] = data;
+        }
+        emu_advance();
+        s_ops.gram_writes++;
+        return;
+    }
+
+    s_regs[s_index] = data;
+    if (s_index == REG_GRAM_X) {
+        s_x = data;
+    } else if (s_index == REG_GRAM_Y) {
+        s_y = data;
+    }
+    s_ops.reg_writes++;
+}
+
+/**
+ * @brief RD下降沿：把数据放到数据线
+ */
+static void emu_read_cycle(void)
+{
+    uint16_t data;
+
+    if (!s_rs) {
+        data = 0;
+    } else if (s_index == REG_ID) {
+        data = CHIP_ID;
+    } else if (s_index == REG_GRAM) {
+        data = (s_x < LCD_EMU_ROWS && s_y < LCD_EMU_COLUMNS) ? s_gram[s_x][s_y] : 0;
+        emu_advance();
+    } else {
+        data = s_regs[s_index];
+    }
+
+    lcd_emu_gpioc.IDR.v = data;
+    s_ops.reads++;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * @brief GPIO寄存器写钩子
+ */
+void lcd_emu_bus_write(struct lcd_emu_reg *reg, uint32_t value)
+{
+    bool set;
+    bool wr_was, rd_was;
+
+    s_ops.gpio_stores++;
+
+    if (reg == &lcd_emu_gpiob.BSRR || reg == &lcd_emu_gpiob.BRR) {
+        set    = (reg == &lcd_emu_gpiob.BSRR);
+        wr_was = s_wr;
+        if (value & PIN_CS) s_cs = set;
+        if (value & PIN_RS) s_rs = set;
+        if (value & PIN_WR) s_wr = set;
+
+        if (!wr_was && s_wr) {
+            if (s_cs) {
+                s_ops.glitches++;
+            } else {
+                emu_write_cycle((uint16_t)lcd_emu_gpioc.ODR.v);
+            }
+        }
+    } else if (reg == &lcd_emu_gpioa.BSRR || reg == &lcd_emu_gpioa.BRR) {
+        rd_was = s_rd;
+        if (value & PIN_RD) s_rd = (reg == &lcd_emu_gpioa.BSRR);
+
+        if (rd_was && !s_rd) {
+            if (s_cs) {
+                s_ops.glitches++;
+            } else {
+                emu_read_cycle();
+            }
+        }
+    }
+}
+
+/**
+ * @brief 复位模拟器
+ */
+void lcd_emu_reset(void)
+{
+    memset(s_regs, 0, sizeof(s_regs));
+    memset(s_gram, 0, sizeof(s_gram));
+    memset(&s_ops, 0, sizeof(s_ops));
+
+    /* 上电默认值：全屏窗口，AM=0、ID=11 */
+    s_regs[REG_ENTRY_MODE]  = 0x0030;
+    s_regs[REG_WIN_X_END]   = LCD_EMU_ROWS - 1;
+    s_regs[REG_WIN_Y_END]   = LCD_EMU_COLUMNS - 1;
+
+    s_index = 0;
+    s_x = s_y = 0;
+    s_cs = s_rs = s_wr = s_rd = true;
+
+    s_tick = 0;
+    memset(&lcd_emu_dwt, 0, sizeof(lcd_emu_dwt));
+    memset(&lcd_emu_core_debug, 0, sizeof(lcd_emu_core_debug));
+}
+
+/**
+ * @brief 推进HAL_GetTick
+ */
+void lcd_emu_advance_ms(uint32_t ms)
+{
+    s_tick += ms;
+}
+
+/**
+ * @brief 读取并可选清零操作计数
+ */
+lcd_emu_ops_t lcd_emu_ops(bool clear)
+{
+    lcd_emu_ops_t ops = s_ops;
+
+    if (clear) {
+        memset(&s_ops, 0, sizeof(s_ops));
+    }
+    return ops;
+}
+
+/**
+ * @brief 读取寄存器当前值
+ */
+uint16_t lcd_emu_reg(uint8_t index)
+{
+    return s_regs[index];
+}
+
+/**
+ * @brief 读取GRAM像素
+ */
+uint16_t lcd_emu_pixel(int x, int y)
+{
+    if (x < 0 || x >= LCD_EMU_ROWS || y < 0 || y >= LCD_EMU_COLUMNS) {
+        return 0;
+    }
+    return s_gram[x][y];
+}
+
+/**
+ * @brief GRAM内容的64位哈希（FNV-1a）
+ */
+uint64_t lcd_emu_hash(void)
+{
+    uint64_t h = 0xCBF29CE484222325ULL;
+    int x, y;
+
+    for (x = 0; x < LCD_EMU_ROWS; x++) {
+        for (y = 0; y < LCD_EMU_COLUMNS; y++) {
+            h = (h ^ (s_gram[x][y] & 0xFF)) * 0x100000001B3ULL;
+            h = (h ^ (s_gram[x][y] >> 8)) * 0x100000001B3ULL;
+        }
+    }
+    return h;
+}
+
+/**
+ * @brief 输出PPM图像
+ */
+int lcd_emu_write_ppm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    uint8_t rgb[3];
+    uint16_t p;
+    int x, y;
+
+    if (f == NULL) {
+        return -1;
+    }
+
+    fprintf(f, "P6\n%d %d\n255\n", LCD_EMU_COLUMNS, LCD_EMU_ROWS);
+    for (x = 0; x < LCD_EMU_ROWS; x++) {
+        for (y = LCD_EMU_COLUMNS - 1; y >= 0; y--) {
+            p = s_gram[x][y];
+            rgb[0] = (uint8_t)(((p >> 11) & 0x1F) << 3);
+            rgb[1] = (uint8_t)(((p >> 5) & 0x3F) << 2);
+            rgb[2] = (uint8_t)((p & 0x1F) << 3);
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+
+    return (fclose(f) == 0) ? 0 : -1;
+}
+
+/* HAL与日志 -----------------------------------------------------------------*/
+
+uint32_t HAL_GetTick(void)
+{
+    return s_tick;
+}
+
+void log_write_module(log_module_t module, log_level_t level, const char *format, ...)
+{
+    (void)module;
+    (void)level;
+    (void)format;
+}
+
+void log_write_bin(log_module_t module, log_level_t level, const char *format, uint32_t nargs, ...)
+{
+    (void)module;
+    (void)level;
+    (void)format;
+    (void)nargs;
+}
@@ -0,0 +1,79 @@
+/**
+  ******************************************************************************
+  * @file    lcd_emu.h
+  * @brief   LCD主机模拟器头文件
+  *          把假GPIO上的CS/RS/WR/RD时序解码为ILI932x寄存器与GRAM操作
+  * @note    模型覆盖lcd.c用到的部分：索引/寄存器读写、R3的AM/ID地址方向、
+  *          R80~R83窗口、R32/R33光标与R34 GRAM读写；R0读出0x9320
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __LCD_EMU_H__
+#define __LCD_EMU_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+
+#define LCD_EMU_ROWS        240     /**< GRAM行数（lcd.c中的Xpos） */
+#define LCD_EMU_COLUMNS     320     /**< GRAM列数（lcd.c中的Ypos） */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief 总线操作计数
+ * @note  bus_ops()为WR与RD选通总数，与LCD_GetBusStats的计数口径一致
+ */
+typedef struct {
+    unsigned long gpio_stores;      /**< 对GPIO寄存器的写入次数（CPU开销） */
+    unsigned long index_writes;     /**< 写索引（RS低） */
+    unsigned long reg_writes;       /**< 写寄存器（RS高，索引不是R34） */
+    unsigned long gram_writes;      /**< 写GRAM像素 */
+    unsigned long reads;            /**< RD选通 */
+    unsigned long glitches;         /**< CS为高时的WR/RD选通（驱动时序错误） */
+
+    unsigned long bus_ops() const { return index_writes + reg_writes + gram_writes + reads; }
+} lcd_emu_ops_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief 复位模拟器：寄存器清零、GRAM填0、引脚空闲、计数清零
+ */
+void lcd_emu_reset(void);
+
+/**
+ * @brief 推进HAL_GetTick返回的毫秒数（复位后为0）
+ */
+void lcd_emu_advance_ms(uint32_t ms);
+
+/**
+ * @brief 读取并可选清零操作计数
+ */
+lcd_emu_ops_t lcd_emu_ops(bool clear);
+
+/**
+ * @brief 读取寄存器当前值
+ */
+uint16_t lcd_emu_reg(uint8_t index);
+
+/**
+ * @brief 读取GRAM像素（lcd.c坐标：x为行0~239，y为列0~319）
+ */
+uint16_t lcd_emu_pixel(int x, int y);
+
+/**
+ * @brief GRAM内容的64位哈希（回归比对用）
+ */
+uint64_t lcd_emu_hash(void);
+
+/**
+ * @brief 按屏幕方向（320x240，y=319在最左）输出PPM图像
+ * @return 0成功，-1文件写入失败
+ */
+int lcd_emu_write_ppm(const char *path);
+
+#endif /* __LCD_EMU_H__ */
@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file    lcd_emu_hw.h
+  * @brief   LCD主机模拟器：替代main.h的假硬件定义
+  *          编译Src/lcd.c与Service/lcd_progress.c时用-include强制包含（C++编译）
+  * @note    GPIO寄存器是带写钩子的对象，每次写入都交给lcd_emu_bus_write()，
+  *          由模拟器按CS/RS/WR/RD引脚状态解码为ILI932x总线操作；
+  *          预先定义__MAIN_H，使Inc/main.h不再包含HAL头文件
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __LCD_EMU_HW_H__
+#define __LCD_EMU_HW_H__
+
+#define __MAIN_H    /* 屏蔽Inc/main.h */
+
+#include <stdint.h>
+
+/* 主机上没有TIM8/DMA1，只走CPU写总线的路径 */
+#define LCD_USE_DMA     0
+
+/* 驱动自身的总线计数，与模拟器解码结果核对 */
+#define LCD_BUS_STATS   1
+
+#define __IO volatile
+
+/**
+ * @brief 带写钩子的GPIO寄存器
+ */
+struct lcd_emu_reg;
+void lcd_emu_bus_write(struct lcd_emu_reg *reg, uint32_t value);
+
+struct lcd_emu_reg {
+    uint32_t v;
+
+    lcd_emu_reg &operator=(uint32_t x)  { v = x;  lcd_emu_bus_write(this, x); return *this; }
+    lcd_emu_reg &operator|=(uint32_t x) { v |= x; lcd_emu_bus_write(this, x); return *this; }
+    operator uint32_t() const { return v; }
+};
+
+/**
+ * @brief 假GPIO端口：只有lcd.c用到的寄存器
+ */
+typedef struct {
+    lcd_emu_reg BRR;
+    lcd_emu_reg BSRR;
+    lcd_emu_reg ODR;
+    lcd_emu_reg IDR;
+} GPIO_TypeDef;
+
+extern GPIO_TypeDef lcd_emu_gpioa, lcd_emu_gpiob, lcd_emu_gpioc;
+
+#define GPIOA   (&lcd_emu_gpioa)
+#define GPIOB   (&lcd_emu_gpiob)
+#define GPIOC   (&lcd_emu_gpioc)
+
+#define GPIO_PIN_5      0x0020U
+#define GPIO_PIN_8      0x0100U
+#define GPIO_PIN_9      0x0200U
+#define GPIO_PIN_All    0xFFFFU
+
+typedef struct {
+    uint32_t Pin;
+    uint32_t Mode;
+    uint32_t Pull;
+    uint32_t Speed;
+} GPIO_InitTypeDef;
+
+#define GPIO_MODE_INPUT             0U
+#define GPIO_MODE_OUTPUT_PP         1U
+#define GPIO_NOPULL                 0U
+#define GPIO_SPEED_FREQ_LOW         0U
+#define GPIO_SPEED_FREQ_VERY_HIGH   3U
+
+static inline void HAL_GPIO_Init(GPIO_TypeDef *port, GPIO_InitTypeDef *init) { (void)port; (void)init; }
+static inline void HAL_Delay(uint32_t ms) { (void)ms; }
+
+#define __HAL_RCC_GPIOA_CLK_ENABLE()
+#define __HAL_RCC_GPIOB_CLK_ENABLE()
+#define __HAL_RCC_GPIOC_CLK_ENABLE()
+#define __nop()
+
+/* 内核：Service/lcd_progress.c用DWT计时、HAL_GetTick限频。模拟器不计CPU时间，CYCCNT保持不变 */
+typedef struct {
+    uint32_t CTRL;
+    uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type       lcd_emu_dwt;
+extern CoreDebug_Type lcd_emu_core_debug;
+extern uint32_t       SystemCoreClock;
+
+#define DWT                         (&lcd_emu_dwt)
+#define CoreDebug                   (&lcd_emu_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+
+uint32_t HAL_GetTick(void);
+
+#endif /* __LCD_EMU_HW_H__ */
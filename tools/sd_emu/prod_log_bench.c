@@ -0,0 +1,213 @@
+/**
+  ******************************************************************************
+  * @file    prod_log_bench.c
+  * @brief   生产记录主机测试：追加与写批次的耗时
+  *          在模拟卡上运行FatFs + diskio_sdcard.c + Service/prod_log.c，
+  *          模拟逐个烧录目标：每个目标烧录若干秒，完成后追加一条记录，主循环周期调用prod_log_poll
+  * @note    用法：make -C tools/sd_emu run
+  *          耗时为模型时间（SPI字节与卡端延迟），不含CPU执行prod_log本身的时间；
+  *          正常调用prod_log_poll时追加访问了SD卡、重新打开后记录数不符时返回非0
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "prod_log.h"
+#include "bsp_sdcard.h"
+#include "sd_emu.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define BENCH_UNITS         60      /* 每项烧录的目标数 */
+#define BENCH_POLL_MS       10      /* 主循环调用prod_log_poll的间隔 */
+#define BENCH_CLUSTER       4       /* 每簇扇区数（2KB簇） */
+
+#define MS_TO_CYCLES(ms)    ((uint64_t)(ms) * (SD_EMU_CPU_HZ / 1000UL))
+#define CYCLES_TO_US(c)     ((unsigned long)((c) / (SD_EMU_CPU_HZ / 1000000UL)))
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief 测试项
+ */
+typedef struct {
+    const char *name;
+    uint32_t    program_ms;     /**< 每个目标的烧录时间 */
+    bool        poll;           /**< 烧录期间是否调用prod_log_poll */
+} bench_case_t;
+
+/**
+ * @brief 单项结果（模型时间，CPU周期）
+ */
+typedef struct {
+    uint64_t append_max;        /**< 单次prod_log_append最大耗时 */
+    uint64_t append_total;
+    uint64_t poll_max;          /**< 单次prod_log_poll最大耗时 */
+    uint64_t poll_total;
+    prod_log_stats_t stats;     /**< prod_log自身的统计（DWT即模型时间） */
+    cycle_stats_t    writes;    /**< 写批次的次数与耗时 */
+} bench_result_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static FATFS      s_fs;
+static prod_log_t s_plog;
+
+static const bench_case_t s_cases[] = {
+    { "poll, 500 ms/unit",  500, true },    /* 攒满15条写一次 */
+    { "poll, 3 s/unit",    3000, true },    /* 超过空闲时间，每条记录写一次 */
+    { "poll stalled",       500, false },   /* 不调用poll，批次满后由append同步写 */
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 烧录一个目标：主循环按BENCH_POLL_MS调用prod_log_poll
+ */
+static FRESULT program_unit(const bench_case_t *c, bench_result_t *r)
+{
+    uint32_t ms;
+    uint64_t start, elapsed;
+    FRESULT  res;
+
+    for (ms = 0; ms < c->program_ms; ms += BENCH_POLL_MS) {
+        sd_emu_run(MS_TO_CYCLES(BENCH_POLL_MS));
+        if (!c->poll) {
+            continue;
+        }
+        start = sd_emu_now();
+        res   = prod_log_poll(&s_plog);
+        elapsed = sd_emu_now() - start;
+        r->poll_total += elapsed;
+        if (elapsed > r->poll_max) {
+            r->poll_max = elapsed;
+        }
+        if (res != FR_OK) {
+            return res;
+        }
+    }
+    return FR_OK;
+}
+
+/**
+ * @brief 追加一条记录
+ */
+static FRESULT append_unit(const bench_case_t *c, uint32_t n, bench_result_t *r)
+{
+    prod_log_record_t rec;
+    uint64_t          start, elapsed;
+    FRESULT           res;
+
+    memset(&rec, 0, sizeof(rec));
+    rec.image_crc32 = 0x1234ABCDU;
+    rec.uid[0]      = (uint8_t)n;
+    rec.uid[1]      = (uint8_t)(n >> 8);
+    rec.magic       = 0xF794;
+    rec.program_ms  = c->program_ms;
+    rec.total_ms    = c->program_ms;
+
+    start   = sd_emu_now();
+    res     = prod_log_append(&s_plog, &rec);
+    elapsed = sd_emu_now() - start;
+    r->append_total += elapsed;
+    if (elapsed > r->append_max) {
+        r->append_max = elapsed;
+    }
+    return res;
+}
+
+/**
+ * @brief 运行一项：BENCH_UNITS个目标后关闭日志
+ */
+static FRESULT run_case(const bench_case_t *c, bench_result_t *r)
+{
+    uint32_t n;
+    FRESULT  res;
+
+    memset(r, 0, sizeof(*r));
+    res = prod_log_open(&s_plog, "0:/PROD.LOG");
+    for (n = 0; n < BENCH_UNITS && res == FR_OK; n++) {
+        res = program_unit(c, r);
+        if (res == FR_OK) {
+            res = append_unit(c, n, r);
+        }
+    }
+    r->stats  = s_plog.stats;
+    r->writes = s_plog.sf.writes;
+    if (res == FR_OK) {
+        res = prod_log_close(&s_plog);
+    }
+    return res;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+int main(void)
+{
+    bench_result_t r;
+    uint64_t       start;
+    uint32_t       expected = 0;
+    int            failures = 0;
+    size_t         i;
+
+    sd_emu_reset();
+    sd_emu_format(BENCH_CLUSTER);
+    if (bsp_sdcard_init() != BSP_SDCARD_OK || f_mount(&s_fs, "0:", 1) != FR_OK) {
+        printf("SD/FatFs init failed\n");
+        return 1;
+    }
+
+    start = sd_emu_now();
+    if (prod_log_open(&s_plog, "0:/PROD.LOG") != FR_OK) {
+        printf("prod_log_open failed\n");
+        return 1;
+    }
+    printf("prod_log on emulated SD (FAT16, %u KB clusters), SPI %lu kHz\n",
+           (unsigned)(BENCH_CLUSTER / 2), (unsigned long)(sd_emu_spi_hz() / 1000));
+    printf("create + f_expand %lu KB: %lu us\n\n", (unsigned long)(PROD_LOG_FILE_SIZE / 1024),
+           CYCLES_TO_US(sd_emu_now() - start));
+    prod_log_close(&s_plog);
+
+    printf("%-19s %7s %7s %11s %9s %10s %10s %6s %8s\n", "case", "records", "batches",
+           "append max", "poll max", "flush avg", "per record", "sync", "result");
+
+    for (i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++) {
+        const bench_case_t *c = &s_cases[i];
+        FRESULT             res = run_case(c, &r);
+        bool                ok  = (res == FR_OK);
+
+        expected += BENCH_UNITS;
+
+        /* 正常调用poll时追加只复制到RAM，从不访问SD卡 */
+        if (c->poll && (r.append_max != 0 || r.stats.append_writes != 0)) {
+            ok = false;
+        }
+
+        printf("%-19s %7lu %7lu %8lu us %6lu us %7lu us %7lu us %6lu %8s\n", c->name,
+               (unsigned long)r.stats.append.count, (unsigned long)r.writes.count,
+               CYCLES_TO_US(r.append_max), CYCLES_TO_US(r.poll_max),
+               r.writes.count ? CYCLES_TO_US(r.writes.cycles / r.writes.count) : 0UL,
+               CYCLES_TO_US((r.append_total + r.poll_total) / BENCH_UNITS),
+               (unsigned long)r.stats.append_writes, ok ? "ok" : "FAIL");
+        if (res != FR_OK) {
+            printf("    FatFs error %d\n", (int)res);
+        }
+        failures += !ok;
+    }
+
+    /* 重新打开：按批次CRC恢复全部记录 */
+    if (prod_log_open(&s_plog, "0:/PROD.LOG") != FR_OK || s_plog.next_seq != expected) {
+        printf("\nreopen: %lu record(s) recovered, %lu expected\n",
+               (unsigned long)s_plog.next_seq, (unsigned long)expected);
+        failures++;
+    } else {
+        printf("\nreopen: %lu record(s) recovered\n", (unsigned long)s_plog.next_seq);
+    }
+    prod_log_close(&s_plog);
+
+    printf("%d failure(s)\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,212 @@
+/**
+  ******************************************************************************
+  * @file    sd_bench.c
+  * @brief   SD卡驱动主机测试：逐扇区与CMD18/CMD25多块传输的吞吐对比，
+  *          以及CMD12/CMD55/ACMD23出错时的返回值
+  *          在模拟卡上运行BSP/bsp_sdcard.c（含初始化与SPI时钟调优）
+  * @note    用法：make -C tools/sd_emu run
+  *          数据不一致、多块传输不快于逐扇区、或注入的错误未被报告时返回非0
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "bsp_sdcard.h"
+#include "sd_emu.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define BENCH_BASE      1000    /* 测试区起始扇区 */
+#define BENCH_MAX       64      /* 最长一次传输的扇区数 */
+#define BENCH_SIZE      (BENCH_MAX * SD_EMU_SECTOR_SIZE)
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint8_t s_src[BENCH_SIZE];
+static uint8_t s_buf[BENCH_SIZE];
+
+static const uint32_t s_runs[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 吞吐（KB/s），elapsed为CPU周期
+ */
+static double kbps(uint32_t sectors, uint64_t elapsed)
+{
+    return elapsed ? (double)sectors * SD_EMU_SECTOR_SIZE / 1024.0 *
+                         (double)SD_EMU_CPU_HZ / (double)elapsed
+                   : 0.0;
+}
+
+static void fill(uint32_t seed)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_SIZE; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        s_src[i] = (uint8_t)(seed >> 24);
+    }
+}
+
+/**
+ * @brief 读n个扇区：逐扇区CMD17或一次CMD18
+ */
+static bool bench_read(uint32_t n, bool multi, uint64_t *elapsed)
+{
+    uint64_t start = sd_emu_now();
+    uint32_t i;
+    bool     ok = true;
+
+    memset(s_buf, 0, n * SD_EMU_SECTOR_SIZE);
+    if (multi) {
+        ok = bsp_sdcard_read_multi_sector(BENCH_BASE, s_buf, n) == BSP_SDCARD_OK;
+    } else {
+        for (i = 0; i < n && ok; i++) {
+            ok = bsp_sdcard_read_sector(BENCH_BASE + i, s_buf + i * SD_EMU_SECTOR_SIZE) ==
+                 BSP_SDCARD_OK;
+        }
+    }
+    *elapsed = sd_emu_now() - start;
+    return ok && memcmp(s_buf, s_src, n * SD_EMU_SECTOR_SIZE) == 0;
+}
+
+/**
+ * @brief 写n个扇区：逐扇区CMD24或一次ACMD23 + CMD25
+ */
+static bool bench_write(uint32_t n, bool multi, uint64_t *elapsed)
+{
+    uint64_t start = sd_emu_now();
+    uint32_t i;
+    bool     ok = true;
+
+    for (i = 0; i < n; i++) {
+        memset(sd_emu_sector(BENCH_BASE + i), 0, SD_EMU_SECTOR_SIZE);
+    }
+    if (multi) {
+        ok = bsp_sdcard_write_multi_sector(BENCH_BASE, s_src, n) == BSP_SDCARD_OK;
+    } else {
+        for (i = 0; i < n && ok; i++) {
+            ok = bsp_sdcard_write_sector(BENCH_BASE + i, s_src + i * SD_EMU_SECTOR_SIZE) ==
+                 BSP_SDCARD_OK;
+        }
+    }
+    *elapsed = sd_emu_now() - start;
+
+    for (i = 0; i < n && ok; i++) {
+        ok = memcmp(sd_emu_sector(BENCH_BASE + i), s_src + i * SD_EMU_SECTOR_SIZE,
+                    SD_EMU_SECTOR_SIZE) == 0;
+    }
+    return ok;
+}
+
+/**
+ * @brief 注入一次故障，检查驱动返回失败，且之后的传输恢复正常
+ */
+static bool check_fault(const char *name, sd_emu_fault_t fault, bool write)
+{
+    sd_emu_counts_t counts;
+    uint64_t        elapsed;
+    bool            failed, recovered;
+
+    sd_emu_counts(true);
+    sd_emu_fault(fault);
+    if (write) {
+        failed = bsp_sdcard_write_multi_sector(BENCH_BASE, s_src, 8) != BSP_SDCARD_OK;
+    } else {
+        failed = bsp_sdcard_read_multi_sector(BENCH_BASE, s_buf, 8) != BSP_SDCARD_OK;
+    }
+    counts = sd_emu_counts(false);
+    sd_emu_fault(SD_EMU_FAULT_NONE);
+
+    recovered = write ? bench_write(8, true, &elapsed) : bench_read(8, true, &elapsed);
+
+    printf("%-28s %-8s %-9s CMD25 x%lu\n", name, failed ? "error" : "ok",
+           recovered ? "recovered" : "stuck", counts.cmds[25]);
+
+    /* CMD55/ACMD23出错时不应继续发CMD25 */
+    if (write && counts.cmds[25] != 0) {
+        return false;
+    }
+    return failed && recovered;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+int main(void)
+{
+    bsp_sdcard_stats_t stats;
+    uint64_t           t_single, t_multi;
+    sd_emu_counts_t    counts;
+    int                failures = 0;
+    size_t             i;
+
+    sd_emu_reset();
+    if (bsp_sdcard_init() != BSP_SDCARD_OK) {
+        printf("bsp_sdcard_init failed\n");
+        return 1;
+    }
+    printf("SD card (emulated SDHC), SPI %lu kHz, CPU %lu MHz\n\n",
+           (unsigned long)(sd_emu_spi_hz() / 1000), (unsigned long)(SD_EMU_CPU_HZ / 1000000));
+
+    fill(0x5D5D0001U);
+    for (i = 0; i < BENCH_MAX; i++) {
+        memcpy(sd_emu_sector(BENCH_BASE + i), s_src + i * SD_EMU_SECTOR_SIZE,
+               SD_EMU_SECTOR_SIZE);
+    }
+
+    printf("%-8s %12s %12s %8s   %12s %12s %8s\n", "sectors", "CMD17 KB/s", "CMD18 KB/s",
+           "speedup", "CMD24 KB/s", "CMD25 KB/s", "speedup");
+
+    for (i = 0; i < sizeof(s_runs) / sizeof(s_runs[0]); i++) {
+        uint32_t n = s_runs[i];
+        double   rd1, rdn, wr1, wrn;
+        bool     ok = true;
+
+        ok &= bench_read(n, false, &t_single);
+        ok &= bench_read(n, true, &t_multi);
+        rd1 = kbps(n, t_single);
+        rdn = kbps(n, t_multi);
+
+        ok &= bench_write(n, false, &t_single);
+        ok &= bench_write(n, true, &t_multi);
+        wr1 = kbps(n, t_single);
+        wrn = kbps(n, t_multi);
+
+        printf("%-8lu %12.0f %12.0f %7.2fx   %12.0f %12.0f %7.2fx%s\n", (unsigned long)n, rd1,
+               rdn, rdn / rd1, wr1, wrn, wrn / wr1, ok ? "" : "  DATA MISMATCH");
+        if (!ok || (n >= 4 && (rdn <= rd1 || wrn <= wr1))) {
+            failures++;
+        }
+    }
+
+    /* 多块写须带ACMD23预擦除 */
+    sd_emu_counts(true);
+    (void)bench_write(16, true, &t_multi);
+    counts = sd_emu_counts(false);
+    if (counts.pre_erased != 16) {
+        printf("ACMD23 pre-erased %lu of 16 block(s)\n", counts.pre_erased);
+        failures++;
+    }
+
+    printf("\n%-28s %-8s %-9s\n", "fault", "result", "after");
+    failures += !check_fault("CMD12 R1 parameter error", SD_EMU_FAULT_CMD12, false);
+    failures += !check_fault("CMD55 illegal command", SD_EMU_FAULT_CMD55, true);
+    failures += !check_fault("ACMD23 illegal command", SD_EMU_FAULT_ACMD23, true);
+    failures += !check_fault("DMA timeout", SD_EMU_FAULT_DMA, false);
+
+    bsp_sdcard_get_stats(&stats);
+    printf("\ndriver: %lu DMA block(s), %lu polled, %lu CRC error(s), %lu DMA error(s)\n",
+           (unsigned long)stats.dma_blocks, (unsigned long)stats.polled_blocks,
+           (unsigned long)stats.crc_errors, (unsigned long)stats.dma_errors);
+    /* 只注入了一次DMA超时，超时的块不计入dma_blocks */
+    if (stats.crc_errors || stats.dma_errors != 1) {
+        failures++;
+    }
+
+    printf("%d failure(s)\n", failures);
+    return failures ? 1 : 0;
+}
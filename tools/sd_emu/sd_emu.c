@@ -0,0 +1,574 @@
+/**
+  ******************************************************************************
+  * @file    sd_emu.c
+  * @brief   SD卡主机模拟器实现文件
+  *          SPI模式SDHC卡模型 + bsp_sdcard.c用到的SPI/DMA/GPIO/HAL函数
+  * @note    MISO在处理本字节MOSI之前确定（全双工）：busy时为0x00，
+  *          其次为待发的命令响应，再次为已到时间的数据块，否则为0xFF；
+  *          CMD12后的第一个字节输出未完成数据块中的字节（最高位为0），
+  *          不丢弃填充字节的驱动会把它当成R1
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sd_emu_hw.h"
+#include "sd_emu.h"
+#include "bsp_spi.h"
+#include "../../Service/crc.h"
+#include "../../Service/log.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define US_TO_CYCLES(us)    ((uint64_t)(us) * (SD_EMU_CPU_HZ / 1000000UL))
+
+#define R1_IDLE             0x01
+#define R1_ILLEGAL          0x04
+#define R1_PARAM            0x40
+#define DATA_ACCEPTED       0xE5
+#define CMD12_STUFF         0x5A    /* 数据流中的字节，最高位为0 */
+
+#define RESP_MAX            8
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief MOSI接收状态
+ */
+typedef enum {
+    RX_CMD = 0,         /**< 等待/接收命令 */
+    RX_TOKEN,           /**< 写命令后等待数据令牌 */
+    RX_BLOCK,           /**< 接收数据块（512字节 + CRC16） */
+} rx_state_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+DWT_Type       sd_emu_dwt;
+CoreDebug_Type sd_emu_core_debug;
+uint32_t       SystemCoreClock = SD_EMU_CPU_HZ;
+uint8_t        sd_emu_uid[12]  = { 0x31, 0x00, 0x47, 0x00, 0x12, 0x51, 0x34, 0x33,
+                                   0x38, 0x36, 0x32, 0x30 };
+GPIO_TypeDef   sd_emu_gpiob;
+SPI_TypeDef    sd_emu_spi1;
+
+static uint8_t         s_card[SD_EMU_SECTORS][SD_EMU_SECTOR_SIZE];
+static uint64_t        s_now;
+static uint32_t        s_prescaler = LL_SPI_BAUDRATEPRESCALER_DIV256;
+static uint8_t         s_spi_rx;
+static sd_emu_fault_t  s_fault;
+static sd_emu_counts_t s_counts;
+
+/* 卡状态 */
+static bool            s_cs;            /* CS为低（选中） */
+static bool            s_idle;          /* 处于空闲态（未完成ACMD41） */
+static bool            s_acmd;          /* 上一条为CMD55 */
+static uint32_t        s_acmd41_polls;
+static uint64_t        s_busy_until;
+static uint64_t        s_busy_after;    /* 响应发完后进入的busy时长 */
+
+/* 命令响应 */
+static uint8_t         s_resp[RESP_MAX];
+static uint32_t        s_resp_len, s_resp_pos;
+
+/* 读：待发数据块（令牌 + 数据 + CRC16） */
+static uint8_t         s_blk[1 + SD_EMU_SECTOR_SIZE + 2];
+static uint32_t        s_blk_len, s_blk_pos;
+static uint64_t        s_blk_at;
+static bool            s_blk_sector;    /* 扇区数据块（计入blocks_read） */
+static bool            s_read_multi;
+static uint32_t        s_read_sector;
+
+/* 写 */
+static rx_state_t      s_rx;
+static uint8_t         s_cmd[6];
+static uint32_t        s_cmd_len;
+static uint8_t         s_wr_buf[SD_EMU_SECTOR_SIZE + 2];
+static uint32_t        s_wr_len;
+static uint32_t        s_wr_sector;
+static bool            s_wr_multi;
+static uint32_t        s_pre_erase;
+
+/* Private functions ---------------------------------------------------------*/
+
+static void put_le16(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+    put_le16(p, v);
+    put_le16(p + 2, v >> 16);
+}
+
+/**
+ * @brief 一个SPI字节的时长（CPU周期）
+ */
+static uint64_t byte_cycles(void)
+{
+    return 8ULL * (2U << (s_prescaler >> SPI_CR1_BR_Pos));
+}
+
+static void respond(const uint8_t *resp, uint32_t len)
+{
+    /* Ncr = 1：命令后先出一个0xFF */
+    s_resp[0] = 0xFF;
+    memcpy(&s_resp[1], resp, len);
+    s_resp_len = len + 1;
+    s_resp_pos = 0;
+}
+
+static void respond_r1(uint8_t r1)
+{
+    respond(&r1, 1);
+}
+
+/**
+ * @brief 准备一个数据块，at时刻起开始输出
+ */
+static void queue_block(const uint8_t *data, uint32_t len, uint64_t at)
+{
+    uint16_t crc = crc_crc16_ccitt(0, data, len);
+
+    s_blk[0] = 0xFE;
+    memcpy(&s_blk[1], data, len);
+    s_blk[1 + len] = (uint8_t)(crc >> 8);
+    s_blk[2 + len] = (uint8_t)crc;
+    s_blk_len    = len + 3;
+    s_blk_pos    = 0;
+    s_blk_at     = at;
+    s_blk_sector = false;
+}
+
+static void queue_sector(uint32_t sector, uint64_t at)
+{
+    static const uint8_t zero[SD_EMU_SECTOR_SIZE];
+
+    queue_block(sector < SD_EMU_SECTORS ? s_card[sector] : zero, SD_EMU_SECTOR_SIZE, at);
+    s_blk_sector = true;
+}
+
+/**
+ * @brief 执行一条收齐的命令
+ */
+static void execute(void)
+{
+    static const uint8_t cid[16] = { 0x03, 'S', 'D', 'E', 'M', 'U', '1', '6', 0x10,
+                                     0x12, 0x34, 0x56, 0x78, 0x01, 0x19, 0x01 };
+    uint8_t  cmd  = s_cmd[0] & 0x3F;
+    uint32_t arg  = ((uint32_t)s_cmd[1] << 24) | ((uint32_t)s_cmd[2] << 16) |
+                    ((uint32_t)s_cmd[3] << 8) | s_cmd[4];
+    bool     acmd = s_acmd;
+    uint8_t  r1   = s_idle ? R1_IDLE : 0;
+    uint8_t  resp[5];
+
+    s_acmd = false;
+    s_counts.cmds[cmd]++;
+
+    /* CMD12：停止数据流，输出填充字节、R1，然后短暂busy */
+    if (cmd == 12) {
+        s_read_multi = false;
+        s_blk_len    = 0;
+        if (s_fault == SD_EMU_FAULT_CMD12) {
+            s_fault = SD_EMU_FAULT_NONE;
+            r1 |= R1_PARAM;
+        }
+        s_resp[0]    = CMD12_STUFF;
+        s_resp[1]    = 0xFF;
+        s_resp[2]    = r1;
+        s_resp_len   = 3;
+        s_resp_pos   = 0;
+        s_busy_after = US_TO_CYCLES(SD_EMU_CMD12_BUSY_US);
+        return;
+    }
+
+    switch (cmd) {
+    case 0:
+        s_idle = true;
+        s_acmd41_polls = 0;
+        s_read_multi = false;
+        s_blk_len = 0;
+        respond_r1(R1_IDLE);
+        break;
+    case 8:
+        resp[0] = r1;
+        resp[1] = 0x00;
+        resp[2] = 0x00;
+        resp[3] = 0x01;
+        resp[4] = 0xAA;
+        respond(resp, 5);
+        break;
+    case 55:
+        if (!s_idle && s_fault == SD_EMU_FAULT_CMD55) {
+            s_fault = SD_EMU_FAULT_NONE;
+            respond_r1(R1_ILLEGAL);
+            break;
+        }
+        s_acmd = true;
+        respond_r1(r1);
+        break;
+    case 41:
+        if (acmd && ++s_acmd41_polls >= 3) {
+            s_idle = false;
+        }
+        respond_r1(acmd ? (s_idle ? R1_IDLE : 0) : (r1 | R1_ILLEGAL));
+        break;
+    case 58:
+        resp[0] = r1;
+        resp[1] = 0xC0;     /* 上电完成，CCS=1（SDHC） */
+        resp[2] = 0xFF;
+        resp[3] = 0x80;
+        resp[4] = 0x00;
+        respond(resp, 5);
+        break;
+    case 16:
+        respond_r1(r1);
+        break;
+    case 10:
+        respond_r1(r1);
+        queue_block(cid, sizeof(cid), s_now + US_TO_CYCLES(SD_EMU_READ_US));
+        break;
+    case 13:
+        resp[0] = r1;
+        resp[1] = 0x00;
+        respond(resp, 2);
+        break;
+    case 17:
+    case 18:
+        respond_r1(r1);
+        s_read_sector = arg;
+        s_read_multi  = (cmd == 18);
+        queue_sector(s_read_sector, s_now + US_TO_CYCLES(SD_EMU_READ_US));
+        break;
+    case 23:
+        if (!acmd || s_fault == SD_EMU_FAULT_ACMD23) {
+            s_fault = acmd ? SD_EMU_FAULT_NONE : s_fault;
+            respond_r1(r1 | R1_ILLEGAL);
+            break;
+        }
+        s_pre_erase = arg & 0x7FFFFF;
+        respond_r1(r1);
+        break;
+    case 24:
+    case 25:
+        respond_r1(r1);
+        s_wr_sector = arg;
+        s_wr_multi  = (cmd == 25);
+        s_rx        = RX_TOKEN;
+        break;
+    default:
+        respond_r1(r1 | R1_ILLEGAL);
+        break;
+    }
+}
+
+/**
+ * @brief 收齐一个写数据块：存入卡中，回数据响应，响应发完后busy
+ */
+static void commit_block(void)
+{
+    uint64_t busy_us;
+
+    if (s_wr_sector < SD_EMU_SECTORS) {
+        memcpy(s_card[s_wr_sector], s_wr_buf, SD_EMU_SECTOR_SIZE);
+    }
+    s_counts.blocks_written++;
+
+    if (!s_wr_multi) {
+        busy_us = SD_EMU_WRITE_US;
+        s_rx    = RX_CMD;
+    } else if (s_pre_erase > 0) {
+        busy_us = SD_EMU_WRITE_NEXT_US;
+        s_pre_erase--;
+        s_counts.pre_erased++;
+        s_rx = RX_TOKEN;
+    } else {
+        busy_us = SD_EMU_WRITE_NEXT_RAW_US;
+        s_rx    = RX_TOKEN;
+    }
+    s_wr_sector++;
+
+    s_resp[0]    = DATA_ACCEPTED;
+    s_resp_len   = 1;
+    s_resp_pos   = 0;
+    s_busy_after = US_TO_CYCLES(busy_us);
+}
+
+/**
+ * @brief 卡交换一个字节
+ */
+static uint8_t card_xfer(uint8_t mosi)
+{
+    uint8_t miso = 0xFF;
+
+    s_counts.spi_bytes++;
+    if (!s_cs) {
+        return 0xFF;
+    }
+
+    /* MISO */
+    if (s_now < s_busy_until) {
+        miso = 0x00;
+    } else if (s_resp_pos < s_resp_len) {
+        miso = s_resp[s_resp_pos++];
+        if (s_resp_pos == s_resp_len && s_busy_after) {
+            s_busy_until = s_now + byte_cycles() + s_busy_after;
+            s_busy_after = 0;
+        }
+    } else if (s_blk_pos < s_blk_len && s_now >= s_blk_at) {
+        miso = s_blk[s_blk_pos++];
+        if (s_blk_pos == s_blk_len) {
+            s_blk_len = s_blk_pos = 0;
+            s_counts.blocks_read += s_blk_sector;
+            if (s_read_multi) {
+                queue_sector(++s_read_sector, s_now + US_TO_CYCLES(SD_EMU_READ_NEXT_US));
+            }
+        }
+    }
+
+    /* MOSI */
+    switch (s_rx) {
+    case RX_CMD:
+        if (s_cmd_len == 0 && (mosi & 0xC0) != 0x40) {
+            break;
+        }
+        s_cmd[s_cmd_len++] = mosi;
+        if (s_cmd_len == sizeof(s_cmd)) {
+            s_cmd_len = 0;
+            execute();
+        }
+        break;
+    case RX_TOKEN:
+        if (mosi == (s_wr_multi ? 0xFC : 0xFE)) {
+            s_rx     = RX_BLOCK;
+            s_wr_len = 0;
+        } else if (s_wr_multi && mosi == 0xFD) {
+            /* 停止令牌：一个字节后busy */
+            s_rx          = RX_CMD;
+            s_pre_erase   = 0;
+            s_busy_until  = s_now + 2 * byte_cycles() + US_TO_CYCLES(SD_EMU_STOP_US);
+        }
+        break;
+    case RX_BLOCK:
+        s_wr_buf[s_wr_len++] = mosi;
+        if (s_wr_len == sizeof(s_wr_buf)) {
+            commit_block();
+        }
+        break;
+    }
+
+    return miso;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+void sd_emu_reset(void)
+{
+    memset(s_card, 0, sizeof(s_card));
+    s_now        = 0;
+    s_prescaler  = LL_SPI_BAUDRATEPRESCALER_DIV256;
+    s_fault      = SD_EMU_FAULT_NONE;
+    s_cs         = false;
+    s_idle       = true;
+    s_acmd       = false;
+    s_acmd41_polls = 0;
+    s_busy_until = s_busy_after = 0;
+    s_resp_len   = s_resp_pos = 0;
+    s_blk_len    = s_blk_pos = 0;
+    s_read_multi = false;
+    s_rx         = RX_CMD;
+    s_cmd_len    = 0;
+    s_pre_erase  = 0;
+    memset(&s_counts, 0, sizeof(s_counts));
+    sd_emu_dwt.CYCCNT = 0;
+}
+
+void sd_emu_format(uint32_t sectors_per_cluster)
+{
+    const uint32_t total = SD_EMU_SECTORS;
+    const uint32_t rsvd = 1, nfats = 2, root_ents = 512;
+    const uint32_t root_secs = root_ents * 32 / SD_EMU_SECTOR_SIZE;
+    uint32_t clusters = (total - rsvd - root_secs) / sectors_per_cluster;
+    uint32_t fat_secs = ((clusters + 2) * 2 + SD_EMU_SECTOR_SIZE - 1) / SD_EMU_SECTOR_SIZE;
+    uint8_t *bs = s_card[0];
+    uint32_t i;
+
+    memset(s_card, 0, (size_t)(rsvd + nfats * fat_secs + root_secs) * SD_EMU_SECTOR_SIZE);
+
+    bs[0] = 0xEB;
+    bs[1] = 0x3C;
+    bs[2] = 0x90;
+    memcpy(&bs[3], "SDEMU1.0", 8);
+    put_le16(&bs[11], SD_EMU_SECTOR_SIZE);
+    bs[13] = (uint8_t)sectors_per_cluster;
+    put_le16(&bs[14], rsvd);
+    bs[16] = (uint8_t)nfats;
+    put_le16(&bs[17], root_ents);
+    put_le16(&bs[19], 0);
+    bs[21] = 0xF8;
+    put_le16(&bs[22], fat_secs);
+    put_le16(&bs[24], 63);
+    put_le16(&bs[26], 255);
+    put_le32(&bs[28], 0);
+    put_le32(&bs[32], total);
+    bs[36] = 0x80;
+    bs[38] = 0x29;
+    put_le32(&bs[39], 0x20250101);
+    memcpy(&bs[43], "SDEMU      ", 11);
+    memcpy(&bs[54], "FAT16   ", 8);
+    bs[510] = 0x55;
+    bs[511] = 0xAA;
+
+    for (i = 0; i < nfats; i++) {
+        uint8_t *fat = s_card[rsvd + i * fat_secs];
+        put_le16(&fat[0], 0xFFF8);
+        put_le16(&fat[2], 0xFFFF);
+    }
+}
+
+uint8_t *sd_emu_sector(uint32_t sector)
+{
+    return s_card[sector % SD_EMU_SECTORS];
+}
+
+void sd_emu_run(uint64_t cycles)
+{
+    s_now += cycles;
+    sd_emu_dwt.CYCCNT = (uint32_t)s_now;
+}
+
+uint64_t sd_emu_now(void)
+{
+    return s_now;
+}
+
+uint32_t sd_emu_spi_hz(void)
+{
+    return (uint32_t)(SD_EMU_CPU_HZ / (2U << (s_prescaler >> SPI_CR1_BR_Pos)));
+}
+
+void sd_emu_fault(sd_emu_fault_t fault)
+{
+    s_fault = fault;
+}
+
+sd_emu_counts_t sd_emu_counts(bool clear)
+{
+    sd_emu_counts_t counts = s_counts;
+
+    if (clear) {
+        memset(&s_counts, 0, sizeof(s_counts));
+    }
+    return counts;
+}
+
+/* HAL / LL ------------------------------------------------------------------*/
+
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(s_now / (SD_EMU_CPU_HZ / 1000));
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    sd_emu_run(US_TO_CYCLES(Delay * 1000ULL));
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void)
+{
+    return SD_EMU_CPU_HZ;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    (void)GPIOx;
+    (void)GPIO_Pin;
+    s_cs = (PinState == GPIO_PIN_RESET);
+    if (!s_cs) {
+        s_cmd_len = 0;      /* 取消选择时丢弃未收齐的命令 */
+    }
+}
+
+void LL_SPI_TransmitData8(SPI_TypeDef *SPIx, uint8_t TxData)
+{
+    (void)SPIx;
+    s_spi_rx = card_xfer(TxData);
+    sd_emu_run(byte_cycles() + SD_EMU_BYTE_CYCLES);
+}
+
+uint8_t LL_SPI_ReceiveData8(SPI_TypeDef *SPIx)
+{
+    (void)SPIx;
+    return s_spi_rx;
+}
+
+uint32_t LL_SPI_IsActiveFlag_RXNE(SPI_TypeDef *SPIx)
+{
+    (void)SPIx;
+    return 1;
+}
+
+/* BSP SPI（DMA总线管理器） --------------------------------------------------*/
+
+bool bsp_spi_dma_lock(bsp_spi_dma_device_t device)
+{
+    (void)device;
+    return true;
+}
+
+void bsp_spi_dma_unlock(bsp_spi_dma_device_t device)
+{
+    (void)device;
+}
+
+bsp_spi_dma_status_t bsp_spi_dma_transmit_receive(const uint8_t *tx_buf, uint8_t *rx_buf,
+                                                  uint16_t len, uint32_t timeout_ms)
+{
+    uint16_t i;
+    uint8_t  data;
+
+    sd_emu_run(SD_EMU_DMA_CYCLES);
+    if (s_fault == SD_EMU_FAULT_DMA) {
+        s_fault = SD_EMU_FAULT_NONE;
+        sd_emu_run(US_TO_CYCLES(timeout_ms * 1000ULL));
+        return BSP_SPI_DMA_TIMEOUT;
+    }
+    for (i = 0; i < len; i++) {
+        data = card_xfer(tx_buf ? tx_buf[i] : 0xFF);
+        if (rx_buf) {
+            rx_buf[i] = data;
+        }
+        sd_emu_run(byte_cycles());
+    }
+    return BSP_SPI_DMA_OK;
+}
+
+void bsp_spi_set_data_width(uint32_t data_width)
+{
+    (void)data_width;
+}
+
+void bsp_spi_set_baudrate_prescaler(uint32_t prescaler)
+{
+    s_prescaler = prescaler;
+}
+
+/* 日志 ----------------------------------------------------------------------*/
+
+void log_write_module(log_module_t module, log_level_t level, const char *format, ...)
+{
+    (void)module;
+    (void)level;
+    (void)format;
+}
+
+void log_write_bin(log_module_t module, log_level_t level, const char *format, uint32_t nargs, ...)
+{
+    (void)module;
+    (void)level;
+    (void)format;
+    (void)nargs;
+}
@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    sd_emu.h
+  * @brief   SD卡主机模拟器头文件
+  *          SPI模式SD卡（SDHC）按字节的命令/数据状态机 + 按CPU周期推进的时间模型
+  * @note    时钟80MHz（PCLK2 = SYSCLK），SPI每位2 << BR个周期；
+  *          卡端的读延迟、写busy按下面的估算值计时，期间卡输出0xFF（读）或0x00（busy）；
+  *          卡容量SD_EMU_SECTORS个扇区，可用sd_emu_format()格式化为FAT16
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __SD_EMU_H__
+#define __SD_EMU_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Exported constants --------------------------------------------------------*/
+
+#define SD_EMU_CPU_HZ               80000000UL  /**< SYSCLK/PCLK2（HSI 16MHz /2 x20 /2） */
+#define SD_EMU_SECTORS              32768       /**< 卡容量（16MB） */
+#define SD_EMU_SECTOR_SIZE          512
+
+/* 主机侧开销估算（CPU周期） */
+#define SD_EMU_BYTE_CYCLES          12          /**< 轮询收发一字节：写DR、查RXNE、读DR、循环 */
+#define SD_EMU_DMA_CYCLES           300         /**< 一次DMA块传输：加锁、配置两个通道、完成中断、解锁 */
+
+/* 卡端时间估算（微秒，取Class 10卡SPI模式的常见值） */
+#define SD_EMU_READ_US              150         /**< CMD17/CMD18：命令到首个数据令牌 */
+#define SD_EMU_READ_NEXT_US         20          /**< CMD18：相邻数据块之间 */
+#define SD_EMU_WRITE_US             600         /**< CMD24：单块编程busy */
+#define SD_EMU_WRITE_NEXT_US        80          /**< CMD25：每块busy（ACMD23已预擦除） */
+#define SD_EMU_WRITE_NEXT_RAW_US    160         /**< CMD25：每块busy（未预擦除） */
+#define SD_EMU_STOP_US              250         /**< CMD25停止令牌后的busy */
+#define SD_EMU_CMD12_BUSY_US        10          /**< CMD12响应后的busy */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief 故障注入（一次性，命中后自动清除）
+ */
+typedef enum {
+    SD_EMU_FAULT_NONE = 0,
+    SD_EMU_FAULT_CMD12,         /**< 下一次CMD12的R1带参数错误位（0x40） */
+    SD_EMU_FAULT_CMD55,         /**< 初始化完成后的下一次CMD55返回非法命令（0x04） */
+    SD_EMU_FAULT_ACMD23,        /**< 下一次ACMD23返回非法命令（0x04） */
+    SD_EMU_FAULT_DMA,           /**< 下一次DMA传输不交换数据，等满超时后返回BSP_SPI_DMA_TIMEOUT */
+} sd_emu_fault_t;
+
+/**
+ * @brief 模拟器统计
+ */
+typedef struct {
+    unsigned long cmds[64];         /**< 各命令收到的次数（ACMD计入对应编号） */
+    unsigned long blocks_read;      /**< 完整发出的数据块数（不含CID） */
+    unsigned long blocks_written;   /**< 写入的数据块数 */
+    unsigned long pre_erased;       /**< 按ACMD23预擦除写入的块数 */
+    unsigned long spi_bytes;        /**< SPI交换的字节数 */
+} sd_emu_counts_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief 复位模拟器：卡回到上电状态、数据清零、时间与计数清零
+ */
+void sd_emu_reset(void);
+
+/**
+ * @brief 将卡格式化为FAT16（无分区表，卷从扇区0开始）
+ * @param sectors_per_cluster 每簇扇区数（1、2、4 ... 64）
+ */
+void sd_emu_format(uint32_t sectors_per_cluster);
+
+/**
+ * @brief 直接访问卡上扇区的数据（不经过SPI，不计时）
+ */
+uint8_t *sd_emu_sector(uint32_t sector);
+
+/**
+ * @brief 时间前进cycles个CPU周期
+ */
+void sd_emu_run(uint64_t cycles);
+
+/**
+ * @brief 当前时刻（CPU周期）
+ */
+uint64_t sd_emu_now(void);
+
+/**
+ * @brief 当前SPI时钟（Hz）
+ */
+uint32_t sd_emu_spi_hz(void);
+
+/**
+ * @brief 注入一次故障
+ */
+void sd_emu_fault(sd_emu_fault_t fault);
+
+/**
+ * @brief 读取并可选清零统计
+ */
+sd_emu_counts_t sd_emu_counts(bool clear);
+
+#endif /* __SD_EMU_H__ */
@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    sd_emu_hw.h
+  * @brief   SD卡主机模拟器：替代HAL/LL/CMSIS头文件的假硬件定义
+  *          编译BSP/bsp_sdcard.c、FatFs与Service层文件时用-include强制包含
+  * @note    预先定义HAL、LL SPI、main.h、gpio.h的包含保护宏；
+  *          SPI字节收发、SPI DMA、CS引脚、DWT周期计数由sd_emu.c按模拟时间实现；
+  *          FatFs要求DWORD为32位，这里预先定义integer.h的类型（主机long为64位）
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __SD_EMU_HW_H__
+#define __SD_EMU_HW_H__
+
+#define STM32G4xx_HAL_H         /* 屏蔽bsp_common.h中的stm32g4xx_hal.h */
+#define STM32G4xx_LL_SPI_H      /* 屏蔽stm32g4xx_ll_spi.h */
+#define __MAIN_H                /* 屏蔽main.h（LCD、LL全家桶） */
+#define __GPIO_H__              /* 屏蔽gpio.h */
+#define _FF_INTEGER             /* 屏蔽FatFs integer.h */
+
+#include <stdint.h>
+
+/* FatFs整数类型（integer.h） ------------------------------------------------*/
+
+typedef int                 INT;
+typedef unsigned int        UINT;
+typedef unsigned char       BYTE;
+typedef short               SHORT;
+typedef unsigned short      WORD;
+typedef unsigned short      WCHAR;
+typedef int32_t             LONG;
+typedef uint32_t            DWORD;
+typedef unsigned long long  QWORD;
+
+/* 内核 ----------------------------------------------------------------------*/
+
+typedef struct {
+    uint32_t CTRL;
+    uint32_t CYCCNT;        /**< 模拟时间（CPU周期）的低32位，随时间推进更新 */
+} DWT_Type;
+
+typedef struct {
+    uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type       sd_emu_dwt;
+extern CoreDebug_Type sd_emu_core_debug;
+extern uint32_t       SystemCoreClock;
+extern uint8_t        sd_emu_uid[12];
+
+#define DWT                         (&sd_emu_dwt)
+#define CoreDebug                   (&sd_emu_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+#define UID_BASE                    ((uintptr_t)sd_emu_uid)
+
+#define __disable_irq()             ((void)0)
+#define __enable_irq()              ((void)0)
+#define __DMB()                     ((void)0)
+
+uint32_t HAL_GetTick(void);
+void     HAL_Delay(uint32_t Delay);
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+
+/* GPIO（只有SD卡CS） --------------------------------------------------------*/
+
+typedef struct {
+    uint32_t unused;
+} GPIO_TypeDef;
+
+typedef enum {
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+extern GPIO_TypeDef sd_emu_gpiob;
+
+#define GPIOB                       (&sd_emu_gpiob)
+#define GPIO_PIN_10                 ((uint16_t)0x0400)
+#define SD_CS_Pin                   GPIO_PIN_10
+#define SD_CS_GPIO_Port             GPIOB
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+
+/* SPI1 ----------------------------------------------------------------------*/
+
+typedef struct {
+    uint32_t unused;
+} SPI_TypeDef;
+
+extern SPI_TypeDef sd_emu_spi1;
+
+#define SPI1                        (&sd_emu_spi1)
+
+/* 分频寄存器值（stm32g431xx.h / stm32g4xx_ll_spi.h） */
+#define SPI_CR1_BR_Pos              3U
+#define LL_SPI_BAUDRATEPRESCALER_DIV2   (0UL << SPI_CR1_BR_Pos)
+#define LL_SPI_BAUDRATEPRESCALER_DIV4   (1UL << SPI_CR1_BR_Pos)
+#define LL_SPI_BAUDRATEPRESCALER_DIV8   (2UL << SPI_CR1_BR_Pos)
+#define LL_SPI_BAUDRATEPRESCALER_DIV16  (3UL << SPI_CR1_BR_Pos)
+#define LL_SPI_BAUDRATEPRESCALER_DIV32  (4UL << SPI_CR1_BR_Pos)
+#define LL_SPI_BAUDRATEPRESCALER_DIV64  (5UL << SPI_CR1_BR_Pos)
+#define LL_SPI_BAUDRATEPRESCALER_DIV128 (6UL << SPI_CR1_BR_Pos)
+#define LL_SPI_BAUDRATEPRESCALER_DIV256 (7UL << SPI_CR1_BR_Pos)
+#define LL_SPI_DATAWIDTH_8BIT           (0x7UL << 8)
+
+/* 写DR即完成一个字节的全双工交换（按SPI时钟推进时间），RXNE恒为1 */
+void     LL_SPI_TransmitData8(SPI_TypeDef *SPIx, uint8_t TxData);
+uint8_t  LL_SPI_ReceiveData8(SPI_TypeDef *SPIx);
+uint32_t LL_SPI_IsActiveFlag_RXNE(SPI_TypeDef *SPIx);
+
+#endif /* __SD_EMU_HW_H__ */
@@ -0,0 +1,268 @@
+/**
+  ******************************************************************************
+  * @file    seek_bench.c
+  * @brief   镜像定位主机测试：按FAT链定位与按快速定位表（CLMT）定位的耗时对比
+  *          在模拟卡上运行FatFs + diskio_sdcard.c + Service/image_reader.c，
+  *          镜像为128KB、与其他文件交错存放的碎片化文件
+  * @note    用法：make -C tools/sd_emu run
+  *          冷定位（重新挂载并清空扇区缓存后第一次定位）与重复定位（平均）分别统计读卡扇区数与模型时间，
+  *          模型时间只含SD总线与卡端时间，不含CPU遍历FAT链的时间；
+  *          读出数据不符、CLMT定位读了卡、或CLMT未生效时返回非0
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "image_reader.h"
+#include "diskio_sdcard.h"
+#include "bsp_sdcard.h"
+#include "sd_emu.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define BENCH_IMAGE_SIZE    (128UL * 1024UL)    /* 镜像大小 */
+#define BENCH_CLUSTER       1                   /* 每簇扇区数（512字节簇） */
+#define BENCH_FILLER_SIZE   (64UL * 1024UL)     /* 每个镜像碎片之后的其他文件数据 */
+#define BENCH_BLOCK         512                 /* 随机读取的块大小 */
+#define BENCH_WARM_LOOPS    100                 /* 重复定位次数 */
+
+#define CYCLES_TO_US(c)     ((unsigned long)((c) / (SD_EMU_CPU_HZ / 1000000UL)))
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief 一次定位的测量结果
+ */
+typedef struct {
+    unsigned long cold_reads;   /**< 冷定位读卡扇区数 */
+    uint64_t      cold_cycles;  /**< 冷定位模型时间（CPU周期） */
+    unsigned long warm_reads;   /**< 重复定位平均读卡扇区数 */
+    uint64_t      warm_cycles;  /**< 重复定位平均模型时间 */
+} seek_result_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static FATFS          s_fs;
+static image_reader_t s_reader;
+static uint8_t        s_chunk[8192];
+static uint8_t        s_buf[BENCH_BLOCK];
+
+static const uint32_t s_offsets[] = {
+    0, 4096, 16384, 32768, 65536, 98304, BENCH_IMAGE_SIZE - BENCH_BLOCK,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 镜像第i字节的内容
+ */
+static uint8_t image_byte(uint32_t i)
+{
+    return (uint8_t)((i * 7U) ^ (i >> 9));
+}
+
+/**
+ * @brief 格式化并创建碎片化镜像：每写chunk字节镜像，就向另一个文件写BENCH_FILLER_SIZE字节
+ * @return 镜像的碎片数
+ */
+static uint32_t make_image(uint32_t chunk)
+{
+    FIL      img, filler;
+    UINT     bw;
+    uint32_t pos, i, n, frags = 0;
+
+    sd_emu_format(BENCH_CLUSTER);
+    disk_cache_invalidate();
+    if (f_mount(&s_fs, "0:", 1) != FR_OK ||
+        f_open(&img, "0:/FW.BIN", FA_CREATE_ALWAYS | FA_WRITE) != FR_OK ||
+        f_open(&filler, "0:/DATA.BIN", FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) {
+        return 0;
+    }
+
+    for (pos = 0; pos < BENCH_IMAGE_SIZE; pos += chunk) {
+        for (i = 0; i < chunk; i += n) {
+            n = chunk - i < sizeof(s_chunk) ? chunk - i : sizeof(s_chunk);
+            for (uint32_t k = 0; k < n; k++) {
+                s_chunk[k] = image_byte(pos + i + k);
+            }
+            f_write(&img, s_chunk, n, &bw);
+        }
+        f_sync(&img);
+        frags++;
+        memset(s_chunk, 0xEE, sizeof(s_chunk));
+        for (i = 0; i < BENCH_FILLER_SIZE; i += sizeof(s_chunk)) {
+            f_write(&filler, s_chunk, sizeof(s_chunk), &bw);
+        }
+        f_sync(&filler);
+    }
+    f_close(&img);
+    f_close(&filler);
+    return frags;
+}
+
+/**
+ * @brief 重新挂载并清空扇区缓存，之后打开镜像
+ * @param fast_seek false时丢弃CLMT，按修改前的方式遍历FAT链
+ */
+static FRESULT open_cold(bool fast_seek)
+{
+    FRESULT res;
+
+    f_mount(NULL, "0:", 0);
+    disk_cache_invalidate();
+    res = f_mount(&s_fs, "0:", 1);
+    if (res == FR_OK) {
+        res = image_reader_open(&s_reader, "0:/FW.BIN");
+    }
+    if (res == FR_OK && !fast_seek) {
+        s_reader.file.cltbl = NULL;
+        s_reader.fast_seek  = false;
+    }
+    return res;
+}
+
+/**
+ * @brief 从文件头定位到offset：冷定位一次，再重复定位BENCH_WARM_LOOPS次（回到文件头不计时）
+ */
+static bool measure_seek(bool fast_seek, uint32_t offset, seek_result_t *r)
+{
+    sd_emu_counts_t counts;
+    uint64_t        start, cycles = 0;
+    unsigned long   reads = 0;
+    uint32_t        i;
+    bool            ok;
+
+    if (open_cold(fast_seek) != FR_OK) {
+        return false;
+    }
+    sd_emu_counts(true);
+    start          = sd_emu_now();
+    ok             = f_lseek(&s_reader.file, offset) == FR_OK;
+    r->cold_cycles = sd_emu_now() - start;
+    counts         = sd_emu_counts(false);
+    r->cold_reads  = counts.blocks_read;
+
+    for (i = 0; i < BENCH_WARM_LOOPS && ok; i++) {
+        f_lseek(&s_reader.file, 0);
+        sd_emu_counts(true);
+        start   = sd_emu_now();
+        ok      = f_lseek(&s_reader.file, offset) == FR_OK;
+        cycles += sd_emu_now() - start;
+        counts  = sd_emu_counts(false);
+        reads  += counts.blocks_read;
+    }
+    r->warm_cycles = cycles / BENCH_WARM_LOOPS;
+    r->warm_reads  = reads / BENCH_WARM_LOOPS;
+
+    image_reader_close(&s_reader);
+    return ok;
+}
+
+/**
+ * @brief 按伪随机顺序读取全部块并核对数据
+ */
+static bool verify_random(bool fast_seek)
+{
+    uint32_t blocks = BENCH_IMAGE_SIZE / BENCH_BLOCK;
+    uint32_t i, k, blk, br;
+    bool     ok;
+
+    ok = open_cold(fast_seek) == FR_OK;
+    for (i = 0; i < blocks && ok; i++) {
+        blk = (i * 97U) % blocks;   /* 97与块数互质，每块恰好读一次 */
+        ok  = image_reader_read_at(&s_reader, blk * BENCH_BLOCK, s_buf, BENCH_BLOCK, &br) ==
+                  FR_OK && br == BENCH_BLOCK;
+        for (k = 0; k < BENCH_BLOCK && ok; k++) {
+            ok = s_buf[k] == image_byte(blk * BENCH_BLOCK + k);
+        }
+    }
+    image_reader_close(&s_reader);
+    return ok;
+}
+
+/**
+ * @brief 一种碎片化程度：逐个偏移对比FAT链与CLMT
+ */
+static int run_layout(uint32_t chunk)
+{
+    seek_result_t chain, clmt;
+    uint32_t      frags = make_image(chunk);
+    uint64_t      start;
+    bool          fast;
+    int           failures = 0;
+    size_t        i;
+
+    if (frags == 0) {
+        printf("image creation failed\n");
+        return 1;
+    }
+
+    /* 打开：CLMT构建需要把FAT链完整读一遍 */
+    f_mount(NULL, "0:", 0);
+    disk_cache_invalidate();
+    f_mount(&s_fs, "0:", 1);
+    start = sd_emu_now();
+    image_reader_open(&s_reader, "0:/FW.BIN");
+    fast = s_reader.fast_seek;
+    printf("%lu KB image, %lu fragment(s), CLMT %s, open %lu us\n",
+           (unsigned long)(BENCH_IMAGE_SIZE / 1024), (unsigned long)frags,
+           fast ? "built" : "too small (FAT chain fallback)",
+           CYCLES_TO_US(sd_emu_now() - start));
+    image_reader_close(&s_reader);
+
+    /* CLMT可容纳的碎片数以内必须构建成功 */
+    if (fast != (2 + 2 * frags <= IMAGE_READER_CLMT_SIZE)) {
+        failures++;
+    }
+
+    printf("%-8s   %-31s   %-31s\n", "offset", "FAT chain (before)", "CLMT (after)");
+    printf("%-8s   %15s %15s   %15s %15s\n", "", "cold", "repeated", "cold", "repeated");
+    printf("%-8s   %6s %8s %6s %8s   %6s %8s %6s %8s\n", "", "reads", "us", "reads", "us",
+           "reads", "us", "reads", "us");
+    for (i = 0; i < sizeof(s_offsets) / sizeof(s_offsets[0]); i++) {
+        uint32_t off = s_offsets[i];
+        bool     ok  = measure_seek(false, off, &chain) && measure_seek(true, off, &clmt);
+
+        printf("%-8lu   %6lu %8lu %6lu %8lu   %6lu %8lu %6lu %8lu%s\n", (unsigned long)off,
+               chain.cold_reads, CYCLES_TO_US(chain.cold_cycles), chain.warm_reads,
+               CYCLES_TO_US(chain.warm_cycles), clmt.cold_reads, CYCLES_TO_US(clmt.cold_cycles),
+               clmt.warm_reads, CYCLES_TO_US(clmt.warm_cycles), ok ? "" : "  SEEK FAILED");
+        /* CLMT在RAM中换算簇号，定位本身不读卡 */
+        if (!ok || (fast && (clmt.cold_reads != 0 || clmt.warm_reads != 0))) {
+            failures++;
+        }
+    }
+
+    if (!verify_random(false) || !verify_random(true)) {
+        printf("random-order read: DATA MISMATCH\n");
+        failures++;
+    }
+    printf("\n");
+    return failures;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+int main(void)
+{
+    int failures = 0;
+
+    sd_emu_reset();
+    sd_emu_format(BENCH_CLUSTER);
+    if (bsp_sdcard_init() != BSP_SDCARD_OK) {
+        printf("bsp_sdcard_init failed\n");
+        return 1;
+    }
+    printf("image seek on emulated SD (FAT16, %u-byte clusters), SPI %lu kHz\n\n",
+           (unsigned)(BENCH_CLUSTER * SD_EMU_SECTOR_SIZE),
+           (unsigned long)(sd_emu_spi_hz() / 1000));
+
+    failures += run_layout(BENCH_IMAGE_SIZE / 16);  /* 16个碎片：CLMT刚好容纳 */
+    failures += run_layout(BENCH_IMAGE_SIZE / 32);  /* 32个碎片：退回FAT链 */
+
+    printf("%d failure(s)\n", failures);
+    return failures ? 1 : 0;
+}
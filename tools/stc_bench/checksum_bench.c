@@ -0,0 +1,238 @@
+/**
+  ******************************************************************************
+  * @file    checksum_bench.c
+  * @brief   帧校验和主机测试：字内核与逐字节累加的结果与耗时
+  *          把stc_checksum_8bit/16bit/usb_block/copy与原来的逐字节循环
+  *          （填充帧时先memcpy再逐字节累加）逐个长度、逐个起始对齐对比，并测量帧长度下的耗时
+  * @note    用法：make -C tools/stc_bench run
+  *          主机编译使用SWAR内核，目标板（Cortex-M4）使用USADA8内核，目标板上的耗时须另行测量；
+  *          任一长度/对齐下结果或复制出的数据不一致时返回非0
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stc_packet.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define BENCH_MIN_NS        50000000.0  /* 每项至少计时50ms */
+#define BENCH_MAX_LEN       2100        /* 核对的最大长度（超过SWAR折叠的512字节） */
+#define BENCH_ALIGNS        4           /* 起始地址相对4字节对齐的偏移0..3 */
+
+/* Private types -------------------------------------------------------------*/
+
+/* dst只有copy类使用；返回值为校验和 */
+typedef uint16_t (*sum_fn)(uint8_t *dst, const uint8_t *src, uint16_t len);
+
+/**
+ * @brief 一种校验和：原实现与字内核
+ */
+typedef struct {
+    const char *name;
+    sum_fn      bytewise;
+    sum_fn      word;
+    bool        copies;     /**< 是否同时复制到dst */
+} bench_kernel_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint8_t           s_src[BENCH_MAX_LEN + BENCH_ALIGNS];
+static uint8_t           s_dst_a[BENCH_MAX_LEN + BENCH_ALIGNS];
+static uint8_t           s_dst_b[BENCH_MAX_LEN + BENCH_ALIGNS];
+static volatile uint32_t s_sink;
+
+/* 帧载荷长度：握手/选项帧、STC89的128字节块、STC8的512字节块，以及USB-ISP的块 */
+static const uint16_t s_lengths[] = { 8, 64, 128, 512, 1024 };
+
+/* Private functions ---------------------------------------------------------*/
+
+/* 原实现：逐字节累加 */
+static uint16_t bytewise_8bit(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    uint8_t sum = 0;
+
+    (void)dst;
+    while (len--) {
+        sum += *src++;
+    }
+    return sum;
+}
+
+static uint16_t bytewise_16bit(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    uint16_t sum = 0;
+
+    (void)dst;
+    while (len--) {
+        sum += *src++;
+    }
+    return sum;
+}
+
+static uint16_t bytewise_usb_block(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    uint8_t sum = 0;
+
+    (void)dst;
+    while (len--) {
+        sum -= *src++;
+    }
+    return sum;
+}
+
+static uint16_t bytewise_copy(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    memcpy(dst, src, len);
+    return bytewise_16bit(NULL, dst, len);
+}
+
+/* 库实现 */
+static uint16_t word_8bit(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    (void)dst;
+    return stc_checksum_8bit(src, len);
+}
+
+static uint16_t word_16bit(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    (void)dst;
+    return stc_checksum_16bit(src, len);
+}
+
+static uint16_t word_usb_block(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    (void)dst;
+    return stc_checksum_usb_block(src, len);
+}
+
+static uint16_t word_copy(uint8_t *dst, const uint8_t *src, uint16_t len)
+{
+    return stc_checksum_copy(dst, src, len);
+}
+
+static const bench_kernel_t s_kernels[] = {
+    { "8bit",      bytewise_8bit,      word_8bit,      false },
+    { "16bit",     bytewise_16bit,     word_16bit,     false },
+    { "usb_block", bytewise_usb_block, word_usb_block, false },
+    { "copy",      bytewise_copy,      word_copy,      true  },
+};
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief 填充数据：fill为0时为伪随机字节，否则全部为fill（0xFF检查通道溢出）
+ */
+static void fill_source(uint8_t fill)
+{
+    uint32_t seed = 0x12345678U;
+    size_t   i;
+
+    for (i = 0; i < sizeof(s_src); i++) {
+        seed = seed * 1103515245U + 12345U;
+        s_src[i] = fill ? fill : (uint8_t)(seed >> 16);
+    }
+}
+
+/**
+ * @brief 逐个长度与对齐对比结果（copy类同时比较复制出的数据），返回不一致的个数
+ */
+static uint32_t verify(const bench_kernel_t *k)
+{
+    uint32_t bad = 0;
+    uint16_t len;
+    int      src_off, dst_off;
+
+    for (len = 0; len <= BENCH_MAX_LEN; len++) {
+        for (src_off = 0; src_off < BENCH_ALIGNS; src_off++) {
+            for (dst_off = 0; dst_off < (k->copies ? BENCH_ALIGNS : 1); dst_off++) {
+                uint16_t a, b;
+
+                memset(s_dst_a, 0xA5, sizeof(s_dst_a));
+                memset(s_dst_b, 0xA5, sizeof(s_dst_b));
+                a = k->bytewise(s_dst_a + dst_off, s_src + src_off, len);
+                b = k->word(s_dst_b + dst_off, s_src + src_off, len);
+                if (a != b || memcmp(s_dst_a, s_dst_b, sizeof(s_dst_a)) != 0) {
+                    bad++;
+                }
+            }
+        }
+    }
+    return bad;
+}
+
+/**
+ * @brief 每次调用的平均耗时（ns）
+ */
+static double time_sum(sum_fn fn, int src_off, uint16_t len)
+{
+    uint32_t rounds = 0, sum = 0;
+    double   start = now_ns(), elapsed;
+
+    do {
+        uint32_t i;
+
+        for (i = 0; i < 1000; i++) {
+            sum += fn(s_dst_a, s_src + src_off, len);
+        }
+        rounds += 1000;
+        elapsed = now_ns() - start;
+    } while (elapsed < BENCH_MIN_NS);
+
+    s_sink = sum;
+    return elapsed / rounds;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+int main(void)
+{
+    size_t i, j;
+    int    failures = 0;
+
+    /* 核对：伪随机数据与全0xFF数据（每个累加通道的最大值） */
+    for (i = 0; i < sizeof(s_kernels) / sizeof(s_kernels[0]); i++) {
+        uint32_t bad;
+
+        fill_source(0);
+        bad = verify(&s_kernels[i]);
+        fill_source(0xFF);
+        bad += verify(&s_kernels[i]);
+        printf("%-10s lengths 0-%u, offsets 0-%u: %s\n", s_kernels[i].name,
+               (unsigned)BENCH_MAX_LEN, (unsigned)(BENCH_ALIGNS - 1), bad ? "MISMATCH" : "ok");
+        failures += bad ? 1 : 0;
+    }
+
+    fill_source(0);
+    printf("\n%-10s %6s %6s %11s %11s %10s %8s\n", "checksum", "bytes", "offset",
+           "bytewise ns", "word ns", "word MB/s", "speedup");
+    for (i = 0; i < sizeof(s_kernels) / sizeof(s_kernels[0]); i++) {
+        for (j = 0; j < sizeof(s_lengths) / sizeof(s_lengths[0]); j++) {
+            int src_off;
+
+            for (src_off = 0; src_off < 2; src_off++) {
+                uint16_t len = s_lengths[j];
+                double   t_byte = time_sum(s_kernels[i].bytewise, src_off, len);
+                double   t_word = time_sum(s_kernels[i].word, src_off, len);
+
+                printf("%-10s %6u %6d %11.1f %11.1f %10.0f %7.1fx\n", s_kernels[i].name,
+                       (unsigned)len, src_off, t_byte, t_word, len * 1e3 / t_word,
+                       t_byte / t_word);
+            }
+        }
+    }
+
+    printf("\n%d failure(s)\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file    model_bench.c
+  * @brief   型号数据库主机测试：按Magic/名称查找的结果与耗时
+  *          对整个生成的型号表（stc_model_db_table.h），把stc_find_model_by_magic/by_name
+  *          与原来在结构体数组上的线性查找逐条对比，并测量每次查找的平均耗时
+  * @note    用法：make -C tools/stc_bench run
+  *          命中与未命中的每个查询结果都须与线性查找一致，否则返回非0
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stc_model_db.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define BENCH_MIN_NS        50000000.0  /* 每项至少计时50ms */
+#define BENCH_MAX_MODELS    2048
+
+/* Private types -------------------------------------------------------------*/
+
+typedef int (*lookup_fn)(uint32_t query, stc_model_info_t *info);
+
+/* Private variables ---------------------------------------------------------*/
+
+static stc_model_info_t s_models[BENCH_MAX_MODELS];  /* 解包后的表，即原g_model_db的布局 */
+static uint16_t         s_count;
+static char             s_miss_names[BENCH_MAX_MODELS][STC_MODEL_NAME_MAX + 1];
+static volatile int     s_sink;
+
+/* Private functions ---------------------------------------------------------*/
+
+/* 原实现：逐条比较 */
+static int linear_by_magic(uint16_t magic, stc_model_info_t *info)
+{
+    uint16_t i;
+
+    for (i = 0; i < s_count; i++) {
+        if (s_models[i].magic == magic) {
+            *info = s_models[i];
+            return STC_OK;
+        }
+    }
+    return STC_ERR_UNKNOWN_MODEL;
+}
+
+static int linear_by_name(const char *name, stc_model_info_t *info)
+{
+    uint16_t i;
+
+    for (i = 0; i < s_count; i++) {
+        if (strcmp(s_models[i].name, name) == 0) {
+            *info = s_models[i];
+            return STC_OK;
+        }
+    }
+    return STC_ERR_UNKNOWN_MODEL;
+}
+
+/* 查询集：query为序号，各函数自行换算成Magic或名称 */
+static int magic_hit_linear(uint32_t q, stc_model_info_t *info)
+{
+    return linear_by_magic(s_models[q].magic, info);
+}
+
+static int magic_hit_indexed(uint32_t q, stc_model_info_t *info)
+{
+    return stc_find_model_by_magic(s_models[q].magic, info);
+}
+
+static int magic_all_linear(uint32_t q, stc_model_info_t *info)
+{
+    return linear_by_magic((uint16_t)q, info);
+}
+
+static int magic_all_indexed(uint32_t q, stc_model_info_t *info)
+{
+    return stc_find_model_by_magic((uint16_t)q, info);
+}
+
+static int name_hit_linear(uint32_t q, stc_model_info_t *info)
+{
+    return linear_by_name(s_models[q].name, info);
+}
+
+static int name_hit_indexed(uint32_t q, stc_model_info_t *info)
+{
+    return stc_find_model_by_name(s_models[q].name, info);
+}
+
+static int name_miss_linear(uint32_t q, stc_model_info_t *info)
+{
+    return linear_by_name(s_miss_names[q], info);
+}
+
+static int name_miss_indexed(uint32_t q, stc_model_info_t *info)
+{
+    return stc_find_model_by_name(s_miss_names[q], info);
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief 逐个查询对比结果，返回不一致的个数
+ */
+static uint32_t verify(lookup_fn ref, lookup_fn dut, uint32_t queries)
+{
+    stc_model_info_t a, b;
+    uint32_t         q, bad = 0;
+
+    for (q = 0; q < queries; q++) {
+        int ra, rb;
+
+        memset(&a, 0, sizeof(a));
+        memset(&b, 0, sizeof(b));
+        ra = ref(q, &a);
+        rb = dut(q, &b);
+        if (ra != rb || (ra == STC_OK && memcmp(&a, &b, sizeof(a)) != 0)) {
+            bad++;
+        }
+    }
+    return bad;
+}
+
+/**
+ * @brief 每次查询的平均耗时（ns）
+ */
+static double time_lookup(lookup_fn fn, uint32_t queries)
+{
+    stc_model_info_t info;
+    uint32_t         q, rounds = 0;
+    double           start = now_ns(), elapsed;
+    int              sum = 0;
+
+    do {
+        for (q = 0; q < queries; q++) {
+            sum += fn(q, &info);
+        }
+        rounds++;
+        elapsed = now_ns() - start;
+    } while (elapsed < BENCH_MIN_NS);
+
+    s_sink = sum;
+    return elapsed / ((double)rounds * queries);
+}
+
+/**
+ * @brief 一种查询：核对结果并输出两种实现的耗时
+ */
+static int run_case(const char *name, lookup_fn linear, lookup_fn indexed, uint32_t queries)
+{
+    uint32_t bad = verify(linear, indexed, queries);
+    double   t_linear = time_lookup(linear, queries);
+    double   t_indexed = time_lookup(indexed, queries);
+
+    printf("%-20s %8lu %12.1f %12.1f %8.1fx %s\n", name, (unsigned long)queries, t_linear,
+           t_indexed, t_linear / t_indexed, bad ? "MISMATCH" : "ok");
+    return bad ? 1 : 0;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+int main(void)
+{
+    uint16_t i;
+    int      failures = 0;
+
+    s_count = stc_get_model_count();
+    if (s_count > BENCH_MAX_MODELS) {
+        printf("model table has %u entries, bench holds %u\n", (unsigned)s_count,
+               (unsigned)BENCH_MAX_MODELS);
+        return 1;
+    }
+    for (i = 0; i < s_count; i++) {
+        stc_get_model_by_index(i, &s_models[i]);
+        snprintf(s_miss_names[i], sizeof(s_miss_names[i]), "%s?", s_models[i].name);
+    }
+
+    printf("model table: %u entries\n\n", (unsigned)s_count);
+    printf("%-20s %8s %12s %12s %9s %s\n", "query", "queries", "linear ns", "indexed ns",
+           "speedup", "result");
+
+    failures += run_case("magic, every model", magic_hit_linear, magic_hit_indexed, s_count);
+    failures += run_case("magic, 0x0000-0xFFFF", magic_all_linear, magic_all_indexed, 0x10000);
+    failures += run_case("name, every model", name_hit_linear, name_hit_indexed, s_count);
+    failures += run_case("name, not found", name_miss_linear, name_miss_indexed, s_count);
+
+    printf("\n%d failure(s)\n", failures);
+    return failures ? 1 : 0;
+}
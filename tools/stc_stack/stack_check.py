@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+STC协议栈深度检查工具
+
+读取gcc -fcallgraph-info=su生成的.ci文件（每个函数的栈帧大小与调用边），
+对协议源文件中每个stc_protocol_ops_t表的每个操作，沿调用图求最深路径的栈用量，
+超过预算即返回非0：
+- 栈帧为dynamic（alloca、变长数组）或调用图有环时视为失败，无法给出上界
+- 通过函数指针的调用（ctx->hal的串口收发、延时等）记为HAL，其栈用量不计入，
+  由HAL实现自行保证
+- 未编译进来的外部函数（memcpy等库函数）按0计
+
+用法:
+    python3 stack_check.py --src 源文件... --ci 调用图文件... [--budget 字节数]
+
+主机编译的栈帧大小与Cortex-M4不同（指针与寄存器压栈为8字节），
+预算用于发现回归（例如协议函数重新在栈上放大缓冲区），不代表目标板上的实际值。
+"""
+
+import argparse
+import os
+import re
+import sys
+
+INDIRECT = "__indirect_call"
+
+NODE_RE = re.compile(r'node: \{ title: "([^"]+)" label: "([^"]*)"')
+EDGE_RE = re.compile(r'edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+SIZE_RE = re.compile(r"\\n(\d+) bytes \(([a-z,]+)\)$")
+OPS_RE = re.compile(r"const\s+stc_protocol_ops_t\s+(\w+)\s*=\s*\{(.*?)\};", re.S)
+FIELD_RE = re.compile(r"\.(\w+)\s*=\s*(\w+)")
+
+
+def load_callgraph(paths):
+    """返回 (栈帧 {函数: (字节数, 类型)}, 调用边 {函数: [被调函数]})"""
+    frames = {}
+    calls = {}
+
+    for path in paths:
+        with open(path, encoding="utf-8") as f:
+            for line in f:
+                m = NODE_RE.search(line)
+                if m:
+                    size = SIZE_RE.search(m.group(2))
+                    if size:
+                        frames[m.group(1)] = (int(size.group(1)), size.group(2))
+                    continue
+                m = EDGE_RE.search(line)
+                if m:
+                    calls.setdefault(m.group(1), []).append(m.group(2))
+
+    return frames, calls
+
+
+def load_ops(paths, frames):
+    """返回 [(操作表, 操作, 调用图中的函数)]，跳过NULL"""
+    ops = []
+
+    for path in paths:
+        with open(path, encoding="utf-8") as f:
+            text = f.read()
+        for table, body in OPS_RE.findall(text):
+            for op, func in FIELD_RE.findall(body):
+                if func != "NULL":
+                    ops.append((table, op, resolve(func, path, frames)))
+
+    return ops
+
+
+def resolve(func, path, frames):
+    """static函数在调用图中的title为"源文件:函数"，按源文件名匹配"""
+    if func in frames:
+        return func
+    for title in frames:
+        file, _, name = title.rpartition(":")
+        if name == func and os.path.basename(file) == os.path.basename(path):
+            return title
+    return func
+
+
+class StackWalker:
+    """沿调用图求最深路径，结果按函数缓存"""
+
+    def __init__(self, frames, calls):
+        self.frames = frames
+        self.calls = calls
+        self.cache = {}
+
+    def peak(self, func, stack=()):
+        """返回 (最深路径字节数, 路径, 是否经过HAL, 错误说明或None)"""
+        if func in self.cache:
+            return self.cache[func]
+        if func in stack:
+            return 0, [func], False, "recursion: " + " -> ".join(stack + (func,))
+        if func == INDIRECT:
+            return 0, [], True, None
+        if func not in self.frames:
+            return 0, [], False, None
+
+        size, kind = self.frames[func]
+        error = None if kind == "static" else "%s frame in %s" % (kind, short(func))
+        best, best_path, hal = 0, [], False
+
+        for callee in self.calls.get(func, []):
+            depth, path, callee_hal, callee_error = self.peak(callee, stack + (func,))
+            hal = hal or callee_hal
+            error = error or callee_error
+            if depth > best:
+                best, best_path = depth, path
+
+        result = (size + best, [func] + best_path, hal, error)
+        self.cache[func] = result
+        return result
+
+
+def short(func):
+    """局部函数的title为"文件:函数"，只保留函数名"""
+    return func.rsplit(":", 1)[-1]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="STC协议各操作的最深栈用量检查")
+    parser.add_argument("--src", nargs="+", required=True, help="定义stc_protocol_ops_t的源文件")
+    parser.add_argument("--ci", nargs="+", required=True, help="-fcallgraph-info=su生成的.ci文件")
+    parser.add_argument("--budget", type=int, default=0, help="每个操作的栈预算（字节，0不检查）")
+    args = parser.parse_args()
+
+    frames, calls = load_callgraph(args.ci)
+    ops = load_ops(args.src, frames)
+    if not ops:
+        print("no stc_protocol_ops_t tables found")
+        return 1
+
+    walker = StackWalker(frames, calls)
+    failures = 0
+
+    print("%-22s %-20s %6s  %-4s %s" % ("table", "op", "bytes", "hal", "deepest path"))
+    for table, op, func in ops:
+        depth, path, hal, error = walker.peak(func)
+        over = args.budget and depth > args.budget
+        missing = func not in frames
+        status = "missing" if missing else error or ("over budget" if over else "")
+        print("%-22s %-20s %6d  %-4s %s%s" % (
+            table, op, depth, "yes" if hal else "", " -> ".join(short(f) for f in path),
+            "  FAIL: " + status if status else ""))
+        failures += bool(status)
+
+    worst = max((walker.peak(func)[0], table, op) for table, op, func in ops)
+    print("\nworst: %s.%s %d bytes, budget %d" % (worst[1], worst[2], worst[0], args.budget))
+    print("%d failure(s)" % failures)
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,268 @@
+/**
+  ******************************************************************************
+  * @file    uart_bench.c
+  * @brief   USART2接收驱动主机压力测试：高波特率连续接收的溢出与中断开销
+  *          在模拟器上运行BSP/bsp_uart.c，对端连续发送伪随机数据，
+  *          周期性屏蔽中断模拟临界区和同优先级中断，主循环每1ms取一次数据
+  * @note    用法：make -C tools/uart_emu run
+  *          FIFO模式（默认）任一项出现溢出、丢字节、数据不一致，或驱动的
+  *          错误计数与模拟器不符时返回非0；
+  *          BSP_UART_USE_FIFO=0编译的uart_bench_nofifo只输出对比数据
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "bsp_uart.h"
+#include "uart_emu.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define BENCH_BYTES         16384   /* 每项发送的字节数 */
+#define BENCH_POLL_US       1000    /* 主循环取数据的间隔 */
+#define BENCH_STEP_CYCLES   8       /* 空闲时的时间步长 */
+#define BENCH_TAIL_US       2000    /* 发送结束后继续运行的时间（等待接收超时与最后一次取数） */
+
+#define US_TO_CYCLES(us)    ((uint64_t)(us) * (UART_EMU_CPU_HZ / 1000000UL))
+
+/* Private types -------------------------------------------------------------*/
+
+/**
+ * @brief 测试项：波特率、中断屏蔽窗口、注入的错误字节数
+ */
+typedef struct {
+    const char *name;
+    uint32_t    baud;
+    uint32_t    block_us;       /**< 每个周期开头屏蔽中断的时长，0为不屏蔽 */
+    uint32_t    period_us;      /**< 屏蔽周期 */
+    uint32_t    errors;         /**< 注入的错误字节数（校验错误与帧错误交替） */
+} bench_case_t;
+
+/**
+ * @brief 单项结果
+ */
+typedef struct {
+    bsp_uart_stats_t  stats;
+    uart_emu_counts_t emu;
+    uint32_t          received;     /**< 主循环读到的字节数 */
+    uint32_t          expected;     /**< 应收到的字节数（不含错误字节） */
+    uint32_t          mismatch;     /**< 与发送数据不一致的字节数 */
+    uint64_t          irq_cycles;   /**< 中断中消耗的周期 */
+    uint64_t          send_cycles;  /**< 发送全部数据用的周期 */
+} bench_result_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+static uint8_t  s_tx[BENCH_BYTES];
+static uint32_t s_tx_errors[BENCH_BYTES];
+static uint8_t  s_expected[BENCH_BYTES];
+
+/* 2400为握手波特率；屏蔽窗口20us/40us对应SD卡/LCD DMA中断与关中断临界区叠加的情况 */
+static const bench_case_t s_cases[] = {
+    { "2400 idle",              2400,    0,   0, 0 },
+    { "115200 idle",            115200,  0,   0, 0 },
+    { "460800 idle",            460800,  0,   0, 0 },
+    { "921600 idle",            921600,  0,   0, 0 },
+    { "460800 mask 20us/200us", 460800,  20, 200, 0 },
+    { "921600 mask 20us/200us", 921600,  20, 200, 0 },
+    { "921600 mask 40us/200us", 921600,  40, 200, 0 },
+    { "921600 8 bad frames",    921600,  20, 200, 8 },
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * @brief 生成发送数据与期望接收的数据
+ * @return 期望接收的字节数
+ */
+static uint32_t make_stream(const bench_case_t *c, uint32_t len)
+{
+    uint32_t seed = 0x12345678U ^ c->baud;
+    uint32_t i, n = 0;
+
+    for (i = 0; i < len; i++) {
+        seed = seed * 1664525U + 1013904223U;
+        s_tx[i]        = (uint8_t)(seed >> 24);
+        s_tx_errors[i] = 0;
+    }
+    for (i = 1; i <= c->errors; i++) {
+        s_tx_errors[i * len / (c->errors + 1)] = (i & 1) ? USART_ISR_PE : USART_ISR_FE;
+    }
+    for (i = 0; i < len; i++) {
+        if (s_tx_errors[i] == 0) {
+            s_expected[n++] = s_tx[i];
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief 主循环：取走环形缓冲区中的数据并与期望值比较
+ */
+static void drain(bench_result_t *r)
+{
+    uint8_t  buf[64];
+    uint16_t n, i;
+
+    while ((n = bsp_uart_read(buf, sizeof(buf))) > 0) {
+        for (i = 0; i < n; i++, r->received++) {
+            if (r->received >= r->expected || buf[i] != s_expected[r->received]) {
+                r->mismatch++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief 运行一项测试
+ * @note  发送结束后再运行BENCH_TAIL_US，使接收超时中断取走阈值以下的尾巴
+ */
+static int run_case(const bench_case_t *c, bench_result_t *r)
+{
+    uint32_t len = (c->baud < 100000) ? 256 : BENCH_BYTES;
+    uint64_t now, start, end = 0, next_poll;
+    uint64_t period = US_TO_CYCLES(c->period_us);
+    uint64_t block  = US_TO_CYCLES(c->block_us);
+
+    memset(r, 0, sizeof(*r));
+    uart_emu_reset();
+    if (bsp_uart_init(c->baud) != BSP_OK) {
+        return -1;
+    }
+    bsp_uart_reset_stats();
+
+    r->expected = make_stream(c, len);
+    uart_emu_counts(true);
+    uart_emu_send(s_tx, s_tx_errors, len);
+    start     = uart_emu_now();
+    next_poll = start + US_TO_CYCLES(BENCH_POLL_US);
+
+    for (;;) {
+        now = uart_emu_now();
+
+        if (!(period && (now % period) < block) && uart_emu_irq_pending()) {
+            uart_emu_irq_enter();
+            bsp_uart_irq_handler();
+            r->irq_cycles += uart_emu_now() - now;
+            continue;
+        }
+
+        if (now >= next_poll) {
+            drain(r);
+            next_poll += US_TO_CYCLES(BENCH_POLL_US);
+        }
+
+        if (end == 0 && uart_emu_send_done()) {
+            end = now;
+            r->send_cycles = end - start;
+        }
+        if (end != 0 && now - end >= US_TO_CYCLES(BENCH_TAIL_US)) {
+            break;
+        }
+
+        uart_emu_run(BENCH_STEP_CYCLES);
+    }
+
+    drain(r);
+    bsp_uart_get_stats(&r->stats);
+    r->emu = uart_emu_counts(false);
+    return 0;
+}
+
+/**
+ * @brief 判断一项是否通过
+ * @param lossless 是否要求无溢出（FIFO模式）
+ */
+static bool check_result(const bench_case_t *c, const bench_result_t *r, bool lossless)
+{
+    bool     ok = true;
+    uint32_t errors;
+
+    /* 驱动计数与模拟器一致 */
+    if ((r->stats.overrun > 0) != (r->emu.lost > 0)) {
+        printf("    driver reports %lu ORE, emulator lost %lu frame(s)\n",
+               (unsigned long)r->stats.overrun, r->emu.lost);
+        ok = false;
+    }
+    /* 溢出时错误字节本身可能丢失，只在无丢失时核对 */
+    if (r->emu.lost == 0 &&
+        r->stats.parity_error + r->stats.frame_error + r->stats.noise_error != c->errors) {
+        printf("    driver counted %lu bad frame(s), %lu injected\n",
+               (unsigned long)(r->stats.parity_error + r->stats.frame_error + r->stats.noise_error),
+               (unsigned long)c->errors);
+        ok = false;
+    }
+    /* 每段连续出错一条告警：有错误才写，且不多于出错次数 */
+    errors = r->stats.overrun + r->stats.parity_error + r->stats.frame_error +
+             r->stats.noise_error + r->stats.ring_dropped;
+    if ((r->emu.logs > 0) != (errors > 0) || r->emu.logs > errors) {
+        printf("    driver logged %lu warning(s) for %lu error(s)\n", r->emu.logs,
+               (unsigned long)errors);
+        ok = false;
+    }
+    if (r->stats.rx_bytes != r->received) {
+        printf("    driver stored %lu byte(s), main loop read %lu\n",
+               (unsigned long)r->stats.rx_bytes, (unsigned long)r->received);
+        ok = false;
+    }
+    if (!lossless) {
+        return ok;
+    }
+
+    if (r->emu.lost || r->stats.ring_dropped) {
+        printf("    %lu frame(s) lost in FIFO, %lu dropped by ring\n",
+               r->emu.lost, (unsigned long)r->stats.ring_dropped);
+        ok = false;
+    }
+    if (r->received != r->expected || r->mismatch) {
+        printf("    received %lu of %lu byte(s), %lu mismatch\n", (unsigned long)r->received,
+               (unsigned long)r->expected, (unsigned long)r->mismatch);
+        ok = false;
+    }
+    return ok;
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+int main(void)
+{
+    bench_result_t r;
+    bool           lossless = (BSP_UART_USE_FIFO != 0);
+    bool           ok;
+    int            failures = 0;
+    size_t         i;
+
+    printf("USART2 RX, %s, ring %u bytes, main loop every %u us\n\n",
+           lossless ? "FIFO threshold + receiver timeout" : "FIFO off, RXNE per byte",
+           (unsigned)BSP_UART_RX_RING_SIZE, (unsigned)BENCH_POLL_US);
+    printf("%-24s %6s %6s %8s %6s %6s %6s %6s %5s %8s\n", "case", "bytes", "irqs", "byte/irq",
+           "burst", "isr%", "ORE", "lost", "logs", "result");
+
+    for (i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++) {
+        const bench_case_t *c = &s_cases[i];
+
+        if (run_case(c, &r) != 0) {
+            printf("%-24s bsp_uart_init failed\n", c->name);
+            failures++;
+            continue;
+        }
+
+        ok = check_result(c, &r, lossless);
+        printf("%-24s %6lu %6lu %8.2f %6lu %6.1f %6lu %6lu %5lu %8s\n", c->name,
+               (unsigned long)r.received, (unsigned long)r.stats.irqs,
+               r.stats.irqs ? (double)r.stats.rx_bytes / r.stats.irqs : 0.0,
+               (unsigned long)r.stats.max_burst,
+               r.send_cycles ? 100.0 * (double)r.irq_cycles / (double)r.send_cycles : 0.0,
+               (unsigned long)r.stats.overrun, r.emu.lost, r.emu.logs,
+               !ok ? "FAIL" : (r.emu.lost ? "overrun" : "ok"));
+        if (!ok) {
+            failures++;
+        }
+    }
+
+    printf("%d failure(s)\n", failures);
+    return failures ? 1 : 0;
+}
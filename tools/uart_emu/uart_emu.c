@@ -0,0 +1,326 @@
+/**
+  ******************************************************************************
+  * @file    uart_emu.c
+  * @brief   USART主机模拟器实现文件
+  *          USART2接收通道模型 + bsp_uart.c用到的LL函数与日志接口
+  * @note    FIFO关闭时深度为1（RDR），打开时为8；FIFO满时再完成一帧即置ORE，该帧丢失。
+  *          PE/FE/NE在出错字节到达FIFO头部（RDR）时置位；
+  *          接收超时从最后一帧停止位结束起计时，每收到一帧重新开始
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "uart_emu_hw.h"
+#include "uart_emu.h"
+#include "../../Service/log.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+
+#define RX_ERRORS       (USART_ISR_PE | USART_ISR_FE | USART_ISR_NE)
+#define STICKY_FLAGS    (RX_ERRORS | USART_ISR_ORE | USART_ISR_RTOF)
+
+/* Private types -------------------------------------------------------------*/
+
+typedef struct {
+    uint8_t  data;
+    uint32_t errors;
+} rx_entry_t;
+
+/* Private variables ---------------------------------------------------------*/
+
+USART_TypeDef uart_emu_usart2;
+
+static uint64_t          s_now;
+static uint32_t          s_bit_cycles = UART_EMU_CPU_HZ / 2400;
+
+/* 配置 */
+static bool              s_enabled, s_fifo_en, s_rto_en, s_nvic_en;
+static bool              s_ie_rxne, s_ie_rxft, s_ie_rto, s_ie_pe, s_ie_err;
+static uint32_t          s_rx_threshold = 1;
+static uint32_t          s_rto_bits;
+
+/* 接收状态 */
+static rx_entry_t        s_fifo[UART_EMU_FIFO_DEPTH];
+static uint32_t          s_fifo_head, s_fifo_count;
+static uint32_t          s_flags;
+static bool              s_rto_armed;
+static uint64_t          s_last_rx_end;
+
+/* 对端发送 */
+static const uint8_t    *s_tx_data;
+static const uint32_t   *s_tx_errors;
+static uint32_t          s_tx_len, s_tx_pos;
+static uint64_t          s_next_frame_end;
+
+static uart_emu_counts_t s_counts;
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint32_t fifo_depth(void)
+{
+    return s_fifo_en ? UART_EMU_FIFO_DEPTH : 1;
+}
+
+static uint64_t frame_cycles(void)
+{
+    return (uint64_t)s_bit_cycles * UART_EMU_FRAME_BITS;
+}
+
+static void fifo_clear(void)
+{
+    s_fifo_head  = 0;
+    s_fifo_count = 0;
+    s_flags      = 0;
+    s_rto_armed  = false;
+}
+
+/**
+ * @brief 一帧停止位结束：存入FIFO或溢出
+ */
+static void deliver_frame(void)
+{
+    rx_entry_t *e;
+
+    s_counts.frames++;
+    s_last_rx_end = s_now;
+    s_rto_armed   = s_enabled;
+
+    if (!s_enabled) {
+        return;
+    }
+    if (s_fifo_count == fifo_depth()) {
+        s_flags |= USART_ISR_ORE;
+        s_counts.lost++;
+        return;
+    }
+
+    e = &s_fifo[(s_fifo_head + s_fifo_count) % UART_EMU_FIFO_DEPTH];
+    e->data   = s_tx_data[s_tx_pos];
+    e->errors = s_tx_errors ? (s_tx_errors[s_tx_pos] & RX_ERRORS) : 0;
+    if (s_fifo_count == 0) {
+        s_flags |= e->errors;       /* 直接到达头部 */
+    }
+    s_fifo_count++;
+}
+
+/**
+ * @brief 驱动访问寄存器：计入周期并推进时间
+ */
+static void reg_access(uint32_t cycles)
+{
+    s_counts.reg_access++;
+    uart_emu_run(cycles);
+}
+
+/* Exported functions --------------------------------------------------------*/
+
+void uart_emu_reset(void)
+{
+    s_now        = 0;
+    s_bit_cycles = UART_EMU_CPU_HZ / 2400;
+    s_enabled = s_fifo_en = s_rto_en = s_nvic_en = false;
+    s_ie_rxne = s_ie_rxft = s_ie_rto = s_ie_pe = s_ie_err = false;
+    s_rx_threshold = 1;
+    s_rto_bits     = 0;
+    fifo_clear();
+    s_tx_data   = NULL;
+    s_tx_errors = NULL;
+    s_tx_len = s_tx_pos = 0;
+    memset(&s_counts, 0, sizeof(s_counts));
+}
+
+void uart_emu_send(const uint8_t *data, const uint32_t *errors, uint32_t len)
+{
+    s_tx_data        = data;
+    s_tx_errors      = errors;
+    s_tx_len         = len;
+    s_tx_pos         = 0;
+    s_next_frame_end = s_now + frame_cycles();
+}
+
+void uart_emu_run(uint32_t cycles)
+{
+    uint64_t target = s_now + cycles;
+    uint64_t rto_at;
+
+    while (s_tx_pos < s_tx_len && s_next_frame_end <= target) {
+        s_now = s_next_frame_end;
+        deliver_frame();
+        s_tx_pos++;
+        s_next_frame_end += frame_cycles();
+    }
+    s_now = target;
+
+    rto_at = s_last_rx_end + (uint64_t)s_rto_bits * s_bit_cycles;
+    if (s_rto_en && s_rto_armed && s_now >= rto_at) {
+        s_flags    |= USART_ISR_RTOF;
+        s_rto_armed = false;
+    }
+}
+
+uint64_t uart_emu_now(void)
+{
+    return s_now;
+}
+
+bool uart_emu_send_done(void)
+{
+    return s_tx_pos >= s_tx_len;
+}
+
+bool uart_emu_irq_pending(void)
+{
+    if (!s_nvic_en) {
+        return false;
+    }
+    return (s_ie_rxne && s_fifo_count > 0) ||
+           (s_ie_rxft && s_fifo_en && s_fifo_count >= s_rx_threshold) ||
+           (s_ie_rto && (s_flags & USART_ISR_RTOF)) ||
+           (s_ie_pe && (s_flags & USART_ISR_PE)) ||
+           (s_ie_err && (s_flags & (USART_ISR_FE | USART_ISR_NE | USART_ISR_ORE)));
+}
+
+void uart_emu_irq_enter(void)
+{
+    uart_emu_run(UART_EMU_IRQ_CYCLES);
+}
+
+uart_emu_counts_t uart_emu_counts(bool clear)
+{
+    uart_emu_counts_t counts = s_counts;
+
+    if (clear) {
+        memset(&s_counts, 0, sizeof(s_counts));
+    }
+    return counts;
+}
+
+/* 寄存器 --------------------------------------------------------------------*/
+
+uint32_t uart_emu_read_isr(void)
+{
+    uint32_t isr;
+
+    reg_access(UART_EMU_REG_CYCLES);
+
+    isr = s_flags & STICKY_FLAGS;
+    if (s_fifo_count > 0) {
+        isr |= USART_ISR_RXNE_RXFNE;
+    }
+    if (s_fifo_en && s_fifo_count >= s_rx_threshold) {
+        isr |= USART_ISR_RXFT;
+    }
+    if (s_enabled) {
+        isr |= USART_ISR_TEACK | USART_ISR_REACK | USART_ISR_TXE_TXFNF | USART_ISR_TC;
+    }
+    return isr;
+}
+
+void uart_emu_write_icr(uint32_t value)
+{
+    reg_access(UART_EMU_REG_CYCLES);
+    s_flags &= ~(value & STICKY_FLAGS);
+}
+
+uint8_t LL_USART_ReceiveData8(USART_TypeDef *USARTx)
+{
+    rx_entry_t *e;
+    uint8_t     data;
+
+    (void)USARTx;
+    reg_access(UART_EMU_REG_CYCLES + UART_EMU_BYTE_CYCLES);
+
+    if (s_fifo_count == 0) {
+        return 0;
+    }
+    e    = &s_fifo[s_fifo_head];
+    data = e->data;
+    s_fifo_head = (s_fifo_head + 1) % UART_EMU_FIFO_DEPTH;
+    s_fifo_count--;
+    if (s_fifo_count > 0) {
+        s_flags |= s_fifo[s_fifo_head].errors;
+    }
+    return data;
+}
+
+void LL_USART_TransmitData8(USART_TypeDef *USARTx, uint8_t Value)
+{
+    (void)USARTx;
+    (void)Value;
+    reg_access(UART_EMU_REG_CYCLES);
+}
+
+void LL_USART_Enable(USART_TypeDef *USARTx)         { (void)USARTx; s_enabled = true; }
+void LL_USART_Disable(USART_TypeDef *USARTx)        { (void)USARTx; s_enabled = false; fifo_clear(); }
+void LL_USART_EnableFIFO(USART_TypeDef *USARTx)     { (void)USARTx; s_fifo_en = true; }
+void LL_USART_DisableFIFO(USART_TypeDef *USARTx)    { (void)USARTx; s_fifo_en = false; }
+void LL_USART_EnableRxTimeout(USART_TypeDef *USARTx)  { (void)USARTx; s_rto_en = true; }
+void LL_USART_DisableRxTimeout(USART_TypeDef *USARTx) { (void)USARTx; s_rto_en = false; }
+void LL_USART_SetRxTimeout(USART_TypeDef *USARTx, uint32_t Timeout) { (void)USARTx; s_rto_bits = Timeout; }
+
+void LL_USART_SetBaudRate(USART_TypeDef *USARTx, uint32_t PeriphClk, uint32_t PrescalerValue,
+                          uint32_t OverSampling, uint32_t BaudRate)
+{
+    (void)USARTx;
+    (void)PrescalerValue;
+    (void)OverSampling;
+    /* 16倍过采样：BRR = 四舍五入(PCLK / 波特率)，一位为BRR个时钟 */
+    s_bit_cycles = (PeriphClk + BaudRate / 2) / BaudRate;
+}
+
+void LL_USART_SetRXFIFOThreshold(USART_TypeDef *USARTx, uint32_t Threshold)
+{
+    static const uint32_t levels[] = { 1, 2, 4, 6, 7, 8 };
+
+    (void)USARTx;
+    s_rx_threshold = levels[Threshold];
+}
+
+uint32_t LL_USART_IsActiveFlag_TEACK(USART_TypeDef *USARTx)    { (void)USARTx; return s_enabled; }
+uint32_t LL_USART_IsActiveFlag_REACK(USART_TypeDef *USARTx)    { (void)USARTx; return s_enabled; }
+uint32_t LL_USART_IsActiveFlag_TXE_TXFNF(USART_TypeDef *USARTx) { (void)USARTx; return 1; }
+uint32_t LL_USART_IsActiveFlag_TC(USART_TypeDef *USARTx)       { (void)USARTx; return 1; }
+
+void LL_USART_EnableIT_RXNE_RXFNE(USART_TypeDef *USARTx)  { (void)USARTx; s_ie_rxne = true; }
+void LL_USART_DisableIT_RXNE_RXFNE(USART_TypeDef *USARTx) { (void)USARTx; s_ie_rxne = false; }
+void LL_USART_EnableIT_RXFT(USART_TypeDef *USARTx)        { (void)USARTx; s_ie_rxft = true; }
+void LL_USART_EnableIT_RTO(USART_TypeDef *USARTx)         { (void)USARTx; s_ie_rto = true; }
+void LL_USART_EnableIT_PE(USART_TypeDef *USARTx)          { (void)USARTx; s_ie_pe = true; }
+void LL_USART_EnableIT_ERROR(USART_TypeDef *USARTx)       { (void)USARTx; s_ie_err = true; }
+
+void NVIC_EnableIRQ(IRQn_Type IRQn)  { (void)IRQn; s_nvic_en = true; }
+void NVIC_DisableIRQ(IRQn_Type IRQn) { (void)IRQn; s_nvic_en = false; }
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+    return UART_EMU_CPU_HZ;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(s_now / (UART_EMU_CPU_HZ / 1000));
+}
+
+/* 日志 ----------------------------------------------------------------------*/
+
+void log_write_module(log_module_t module, log_level_t level, const char *format, ...)
+{
+    (void)module;
+    (void)level;
+    (void)format;
+    s_counts.logs++;
+    uart_emu_run(UART_EMU_LOG_CYCLES);
+}
+
+void log_write_bin(log_module_t module, log_level_t level, const char *format, uint32_t nargs, ...)
+{
+    (void)module;
+    (void)level;
+    (void)format;
+    (void)nargs;
+    s_counts.logs++;
+    uart_emu_run(UART_EMU_LOG_CYCLES);
+}
@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * @file    uart_emu.h
+  * @brief   USART主机模拟器头文件
+  *          按CPU周期推进时间，模拟USART2接收移位寄存器、RX FIFO、溢出、
+  *          接收超时和中断请求
+  * @note    时钟80MHz、16倍过采样，帧长11位（起始位+8数据位+偶校验+停止位）；
+  *          驱动的每次寄存器访问和每次进中断都消耗周期，期间对端继续发送
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __UART_EMU_H__
+#define __UART_EMU_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Exported constants --------------------------------------------------------*/
+
+#define UART_EMU_CPU_HZ         80000000UL  /**< SYSCLK/PCLK1（HSI 16MHz /2 x20 /2） */
+#define UART_EMU_FRAME_BITS     11          /**< 起始位+9位（8数据+校验）+停止位 */
+#define UART_EMU_FIFO_DEPTH     8           /**< RX FIFO深度 */
+
+/* 周期估算（偏保守）：进出中断含压栈/出栈和函数序言，寄存器访问含APB等待与前后指令 */
+#define UART_EMU_IRQ_CYCLES     40
+#define UART_EMU_REG_CYCLES     6
+#define UART_EMU_BYTE_CYCLES    12          /**< 每字节的软件开销（存环形缓冲区） */
+#define UART_EMU_LOG_CYCLES     2000        /**< 中断中写一条告警日志（格式化5个参数进队列） */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief 模拟器统计（真实值，用于核对驱动自身的计数）
+ */
+typedef struct {
+    unsigned long frames;       /**< 对端发出的帧数 */
+    unsigned long lost;         /**< FIFO满时到达而丢失的帧数 */
+    unsigned long reg_access;   /**< 驱动的寄存器访问次数 */
+    unsigned long logs;         /**< 驱动写入的日志条数 */
+} uart_emu_counts_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief 复位模拟器：USART关闭、FIFO清空、时间与计数清零
+ */
+void uart_emu_reset(void);
+
+/**
+ * @brief 对端从当前时刻起连续发送
+ * @param data 数据
+ * @param errors 每字节附带的错误标志（USART_ISR_PE/FE/NE），可为NULL
+ * @param len 字节数（数据须在发送完成前保持有效）
+ */
+void uart_emu_send(const uint8_t *data, const uint32_t *errors, uint32_t len);
+
+/**
+ * @brief 时间前进cycles个CPU周期
+ */
+void uart_emu_run(uint32_t cycles);
+
+/**
+ * @brief 当前时刻（CPU周期）
+ */
+uint64_t uart_emu_now(void);
+
+/**
+ * @brief 对端是否已发送完毕
+ */
+bool uart_emu_send_done(void);
+
+/**
+ * @brief USART2中断请求是否有效（已考虑NVIC使能）
+ */
+bool uart_emu_irq_pending(void);
+
+/**
+ * @brief 进入中断：计入进出中断的周期
+ */
+void uart_emu_irq_enter(void);
+
+/**
+ * @brief 读取并可选清零统计
+ */
+uart_emu_counts_t uart_emu_counts(bool clear);
+
+#endif /* __UART_EMU_H__ */
@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file    uart_emu_hw.h
+  * @brief   USART主机模拟器：替代HAL/LL头文件的假硬件定义
+  *          编译BSP/bsp_uart.c时用-include强制包含
+  * @note    预先定义HAL与LL USART头文件的包含保护宏，bsp_uart.c调用的
+  *          LL_USART_xxx由uart_emu.c按USART2的FIFO/中断行为实现；
+  *          寄存器位定义与stm32g431xx.h一致
+  * @version V2.0.0
+  * @date    2025-01-XX
+  ******************************************************************************
+  */
+
+#ifndef __UART_EMU_HW_H__
+#define __UART_EMU_HW_H__
+
+#define STM32G4xx_HAL_H         /* 屏蔽bsp_common.h中的stm32g4xx_hal.h */
+#define STM32G4xx_LL_USART_H    /* 屏蔽stm32g4xx_ll_usart.h */
+
+#include <stdint.h>
+
+/* 假USART：寄存器访问全部经过下面的LL函数 */
+typedef struct {
+    uint32_t unused;
+} USART_TypeDef;
+
+extern USART_TypeDef uart_emu_usart2;
+
+#define USART2                      (&uart_emu_usart2)
+
+typedef enum {
+    USART2_IRQn = 38
+} IRQn_Type;
+
+/* 寄存器位（stm32g431xx.h） */
+#define USART_ISR_PE                (1UL << 0)
+#define USART_ISR_FE                (1UL << 1)
+#define USART_ISR_NE                (1UL << 2)
+#define USART_ISR_ORE               (1UL << 3)
+#define USART_ISR_RXNE_RXFNE        (1UL << 5)
+#define USART_ISR_TC                (1UL << 6)
+#define USART_ISR_TXE_TXFNF         (1UL << 7)
+#define USART_ISR_RTOF              (1UL << 11)
+#define USART_ISR_TEACK             (1UL << 21)
+#define USART_ISR_REACK             (1UL << 22)
+#define USART_ISR_RXFT              (1UL << 26)
+
+#define USART_ICR_PECF              (1UL << 0)
+#define USART_ICR_FECF              (1UL << 1)
+#define USART_ICR_NECF              (1UL << 2)
+#define USART_ICR_ORECF             (1UL << 3)
+#define USART_ICR_RTOCF             (1UL << 11)
+
+#define LL_USART_PRESCALER_DIV1     0x00000000U
+#define LL_USART_OVERSAMPLING_16    0x00000000U
+
+#define LL_USART_FIFOTHRESHOLD_1_8  0x00000000U
+#define LL_USART_FIFOTHRESHOLD_1_4  0x00000001U
+#define LL_USART_FIFOTHRESHOLD_1_2  0x00000002U
+#define LL_USART_FIFOTHRESHOLD_3_4  0x00000003U
+#define LL_USART_FIFOTHRESHOLD_7_8  0x00000004U
+#define LL_USART_FIFOTHRESHOLD_8_8  0x00000005U
+
+/* 只模拟ISR读与ICR写 */
+uint32_t uart_emu_read_isr(void);
+void     uart_emu_write_icr(uint32_t value);
+
+#define LL_USART_ReadReg(__INSTANCE__, __REG__)             uart_emu_read_##__REG__()
+#define uart_emu_read_ISR                                   uart_emu_read_isr
+#define LL_USART_WriteReg(__INSTANCE__, __REG__, __VALUE__) uart_emu_write_##__REG__(__VALUE__)
+#define uart_emu_write_ICR                                  uart_emu_write_icr
+
+void     LL_USART_Enable(USART_TypeDef *USARTx);
+void     LL_USART_Disable(USART_TypeDef *USARTx);
+void     LL_USART_SetBaudRate(USART_TypeDef *USARTx, uint32_t PeriphClk, uint32_t PrescalerValue,
+                              uint32_t OverSampling, uint32_t BaudRate);
+void     LL_USART_EnableFIFO(USART_TypeDef *USARTx);
+void     LL_USART_DisableFIFO(USART_TypeDef *USARTx);
+void     LL_USART_SetRXFIFOThreshold(USART_TypeDef *USARTx, uint32_t Threshold);
+void     LL_USART_SetRxTimeout(USART_TypeDef *USARTx, uint32_t Timeout);
+void     LL_USART_EnableRxTimeout(USART_TypeDef *USARTx);
+void     LL_USART_DisableRxTimeout(USART_TypeDef *USARTx);
+uint32_t LL_USART_IsActiveFlag_TEACK(USART_TypeDef *USARTx);
+uint32_t LL_USART_IsActiveFlag_REACK(USART_TypeDef *USARTx);
+uint32_t LL_USART_IsActiveFlag_TXE_TXFNF(USART_TypeDef *USARTx);
+uint32_t LL_USART_IsActiveFlag_TC(USART_TypeDef *USARTx);
+void     LL_USART_EnableIT_RXNE_RXFNE(USART_TypeDef *USARTx);
+void     LL_USART_DisableIT_RXNE_RXFNE(USART_TypeDef *USARTx);
+void     LL_USART_EnableIT_RXFT(USART_TypeDef *USARTx);
+void     LL_USART_EnableIT_RTO(USART_TypeDef *USARTx);
+void     LL_USART_EnableIT_PE(USART_TypeDef *USARTx);
+void     LL_USART_EnableIT_ERROR(USART_TypeDef *USARTx);
+uint8_t  LL_USART_ReceiveData8(USART_TypeDef *USARTx);
+void     LL_USART_TransmitData8(USART_TypeDef *USARTx, uint8_t Value);
+
+void     NVIC_EnableIRQ(IRQn_Type IRQn);
+void     NVIC_DisableIRQ(IRQn_Type IRQn);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_GetTick(void);
+
+/* 单线程模拟：中断由测试程序在指令边界调用，屏障与开关中断为空操作 */
+#define __DMB()                     __asm__ volatile("" ::: "memory")
+#define __disable_irq()
+#define __enable_irq()
+
+#endif /* __UART_EMU_HW_H__ */